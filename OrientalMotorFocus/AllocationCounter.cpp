@@ -0,0 +1,4 @@
+#include "AllocationCounter.h"
+
+boost::atomic<unsigned long> AllocationCounter::count_( 0 );
+bool AllocationCounter::counting_ = false;
@@ -0,0 +1,30 @@
+#ifndef _ALLOCATION_COUNTER_
+#define _ALLOCATION_COUNTER_
+
+#include <boost/atomic.hpp>
+
+/*
+*  Process Wide Count of Heap Allocations, For Benchmarks and Tests
+*     Counted by the Replaced Global operator new in AllocationCounterNew.cpp, Which Only Tools and Tests Link
+*     (the Device Adapter Never Replaces the Allocator of the Process Hosting it), so Everywhere Else IsCounting() is false
+*     Note:  The Count is Process Wide, so Allocations on Other Threads Add Noise to a Measurement
+*/
+class AllocationCounter
+{
+	public:
+		//true Once the Replaced operator new is Linked Into This Program
+		static bool IsCounting( void ) { return counting_; }
+
+		//Allocations Since the Program Started (Take Differences Around the Code Measured)
+		static unsigned long GetCount( void ) { return count_.load( boost::memory_order_relaxed ); }
+
+		//Called by the Replaced Allocator Only
+		static void Record( void ) { count_.fetch_add( 1, boost::memory_order_relaxed ); }
+		static bool Enable( void ) { counting_ = true; return true; }
+
+	private:
+		static boost::atomic<unsigned long> count_;
+		static bool counting_;
+};
+
+#endif
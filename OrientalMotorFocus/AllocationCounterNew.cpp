@@ -0,0 +1,67 @@
+/*
+*  Replaced Global Allocation Functions That Count Every Allocation in AllocationCounter
+*     Link Into Tools and Tests Only, Never Into the Device Adapter
+*/
+#include "AllocationCounter.h"
+#include <stdlib.h>
+#include <new>
+
+static const bool g_AllocationCounterEnabled = AllocationCounter::Enable();
+
+void* operator new( size_t size )
+{
+	AllocationCounter::Record();
+	void* p = malloc( ( size > 0 ) ? size : 1 );
+	if( p == nullptr )
+	{
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void* operator new[]( size_t size )
+{
+	return operator new( size );
+}
+
+void* operator new( size_t size, const std::nothrow_t& ) throw()
+{
+	AllocationCounter::Record();
+	return malloc( ( size > 0 ) ? size : 1 );
+}
+
+void* operator new[]( size_t size, const std::nothrow_t& ) throw()
+{
+	return operator new( size, std::nothrow );
+}
+
+void operator delete( void* p ) throw()
+{
+	free( p );
+}
+
+void operator delete[]( void* p ) throw()
+{
+	free( p );
+}
+
+void operator delete( void* p, const std::nothrow_t& ) throw()
+{
+	free( p );
+}
+
+void operator delete[]( void* p, const std::nothrow_t& ) throw()
+{
+	free( p );
+}
+
+//Sized Forms (C++14), Called Instead of the Above When the Compiler Knows the Size
+void operator delete( void* p, size_t ) throw()
+{
+	free( p );
+}
+
+void operator delete[]( void* p, size_t ) throw()
+{
+	free( p );
+}
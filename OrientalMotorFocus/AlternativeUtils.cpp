@@ -8,6 +8,7 @@
    #define snprintf _snprintf 
 #else
    #include <unistd.h>
+   #include <time.h>
 #endif
 
 //TODO:  Need to produce some sort of check for overflowing of snprintf buffer with large numeric doubles
@@ -56,4 +57,61 @@ void CAlternativeUtils::SetFloatDecimalTag( unsigned int numPlaces ) {
 	os << "%." << numPlaces << "f";
 	m_floatTag = os.str();
 
-}
\ No newline at end of file
+}
+/**
+ * Milliseconds From an Arbitrary Fixed Point That Never Runs Backwards
+ * Note:  Unlike the System Clock, this is not adjusted by the user or NTP and is only meaningful as a difference
+ *
+ * This function is thread-safe.
+ */
+double CAlternativeUtils::GetMonotonicTimeMs( void ) {
+
+#ifdef WIN32
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER count;
+	QueryPerformanceFrequency( &frequency );
+	QueryPerformanceCounter( &count );
+	return ( static_cast<double>( count.QuadPart ) * 1000.0 ) / static_cast<double>( frequency.QuadPart );
+#else
+	struct timespec now;
+	clock_gettime( CLOCK_MONOTONIC, &now );
+	return static_cast<double>( now.tv_sec ) * 1000.0 + static_cast<double>( now.tv_nsec ) / 1000000.0;
+#endif
+
+}
+
+/**
+ * Block the Calling Thread For periodMs Milliseconds
+ * Note:  Same as CDeviceUtils::SleepMs(), Kept Here so the Controller Core Does Not Need DeviceBase.h
+ *
+ * This function is thread-safe.
+ */
+void CAlternativeUtils::SleepMs( long periodMs ) {
+
+#ifdef WIN32
+	Sleep( periodMs );
+#else
+	usleep( periodMs * 1000 );
+#endif
+
+}
+
+/**
+ * 32 Bit FNV-1a Hash of bytes, Continuing From hash
+ * Note:  Not a checksum against tampering, only a cheap fingerprint of a few register values
+ *
+ * This function is thread-safe.
+ */
+uint32_t CAlternativeUtils::Fnv1aHash( const unsigned char bytes[], size_t len, uint32_t hash ) {
+
+	static const uint32_t fnv1aPrime = 16777619u;
+
+	for( size_t i = 0; i < len; i++ )
+	{
+		hash ^= bytes[i];
+		hash *= fnv1aPrime;
+	}
+
+	return hash;
+
+}
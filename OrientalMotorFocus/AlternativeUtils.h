@@ -3,15 +3,18 @@
 *  Static Class Used For Modified Utilities From DeviceUtils.h
 *
 *    Current Implementations: Adjustable Conversion of String to Float Decimal Places
+*                             Monotonic Millisecond Clock For Timestamps and Cache Ages
+*                             FNV-1a Hash For Configuration Fingerprints
 *
 **************************************************************/
 
 #ifndef _ALTERNATIVE_UTILS_H_
 #define _ALTERNATIVE_UTILS_H_
 
-#include "../../MMDevice/MMDeviceConstants.h"
+#include "OrientalCoreDefs.h"
 #include <vector>
 #include <string>
+#include <stdint.h>
 
 class CAlternativeUtils
 {
@@ -20,6 +23,12 @@ public:
    static const char* ConvertToString(double dVal, unsigned int numPlaces);
    static const char* ConvertToString(double dVal);
    static void SetFloatDecimalTag( unsigned int numPlaces );
+   static double GetMonotonicTimeMs( void );
+   static void SleepMs( long periodMs );
+   //32 Bit FNV-1a, Continue a Hash by Passing its Previous Value
+   static uint32_t Fnv1aHash( const unsigned char bytes[], size_t len, uint32_t hash = fnv1aOffsetBasis_ );
+
+   static const uint32_t fnv1aOffsetBasis_ = 2166136261u;
 private:
 
    static char m_pszBuffer[MM::MaxStrLength];
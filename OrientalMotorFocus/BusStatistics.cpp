@@ -0,0 +1,233 @@
+#include "BusStatistics.h"
+#include "AlternativeUtils.h"
+#include <sstream>
+
+/******************************************
+
+ LatencyHistogram
+
+ *******************************************/
+
+unsigned int LatencyHistogram::BucketIndex( uint32_t valueUs )
+{
+	if( valueUs < subBuckets_ )
+	{
+		return valueUs;
+	}
+
+	//Position of the Highest Set Bit
+	unsigned int msb = 0;
+	for( uint32_t v = valueUs; v > 1; v >>= 1 )
+	{
+		msb++;
+	}
+
+	unsigned int sub = ( valueUs >> ( msb - subBucketBits_ ) ) & ( subBuckets_ - 1 );
+	return subBuckets_ + ( msb - subBucketBits_ ) * subBuckets_ + sub;
+}
+
+uint32_t LatencyHistogram::BucketUpperBound( unsigned int index )
+{
+	if( index < subBuckets_ )
+	{
+		return index;
+	}
+
+	unsigned int msb = ( index - subBuckets_ ) / subBuckets_ + subBucketBits_;
+	unsigned int sub = ( index - subBuckets_ ) % subBuckets_;
+	uint64_t width = static_cast< uint64_t >( 1 ) << ( msb - subBucketBits_ );
+	uint64_t upper = ( static_cast< uint64_t >( 1 ) << msb ) + ( sub + 1 ) * width - 1;
+
+	return ( upper > 0xFFFFFFFF ) ? 0xFFFFFFFF : static_cast< uint32_t >( upper );
+}
+
+void LatencyHistogram::Record( uint32_t valueUs )
+{
+	buckets_[ BucketIndex( valueUs ) ].fetch_add( 1, boost::memory_order_relaxed );
+
+	uint32_t currentMax = maxUs_.load( boost::memory_order_relaxed );
+	while( valueUs > currentMax && !maxUs_.compare_exchange_weak( currentMax, valueUs, boost::memory_order_relaxed ) )
+	{
+	}
+}
+
+void LatencyHistogram::Reset( void )
+{
+	for( unsigned int i = 0; i < numBuckets_; i++ )
+	{
+		buckets_[i].store( 0, boost::memory_order_relaxed );
+	}
+	maxUs_.store( 0, boost::memory_order_relaxed );
+}
+
+uint64_t LatencyHistogram::GetCount( void ) const
+{
+	uint64_t count = 0;
+	for( unsigned int i = 0; i < numBuckets_; i++ )
+	{
+		count += buckets_[i].load( boost::memory_order_relaxed );
+	}
+	return count;
+}
+
+/* Percentile From the Bucket Counts
+*   @param percentile - 0 to 100
+*   Returns - upper bound of the bucket holding the percentile (capped at the max seen), or 0 with no samples
+*/
+uint32_t LatencyHistogram::GetPercentileUs( double percentile ) const
+{
+	uint64_t count = GetCount();
+	if( count == 0 )
+	{
+		return 0;
+	}
+
+	//Rank of the Sample at the Percentile (1-Based)
+	uint64_t rank = static_cast< uint64_t >( percentile / 100.0 * count + 0.5 );
+	rank = ( rank < 1 ) ? 1 : ( ( rank > count ) ? count : rank );
+
+	uint64_t seen = 0;
+	uint32_t maxUs = GetMaxUs();
+	for( unsigned int i = 0; i < numBuckets_; i++ )
+	{
+		seen += buckets_[i].load( boost::memory_order_relaxed );
+		if( seen >= rank )
+		{
+			uint32_t upper = BucketUpperBound( i );
+			return ( upper > maxUs ) ? maxUs : upper;
+		}
+	}
+
+	return maxUs;
+}
+
+/******************************************
+
+ BusTransactionStats
+
+ *******************************************/
+
+void BusTransactionStats::Record( BusTransactionOutcome outcome, uint32_t latencyUs )
+{
+	transactions_.fetch_add( 1, boost::memory_order_relaxed );
+	latency_.Record( latencyUs );
+
+	switch( outcome )
+	{
+		case BusOutcomeTimeout:
+			timeouts_.fetch_add( 1, boost::memory_order_relaxed );
+			break;
+		case BusOutcomeCrcError:
+			crcErrors_.fetch_add( 1, boost::memory_order_relaxed );
+			break;
+		case BusOutcomeException:
+			exceptions_.fetch_add( 1, boost::memory_order_relaxed );
+			break;
+		case BusOutcomeError:
+			errors_.fetch_add( 1, boost::memory_order_relaxed );
+			break;
+		default:
+			break;
+	}
+}
+
+void BusTransactionStats::Reset( double nowMs )
+{
+	transactions_.store( 0, boost::memory_order_relaxed );
+	timeouts_.store( 0, boost::memory_order_relaxed );
+	crcErrors_.store( 0, boost::memory_order_relaxed );
+	exceptions_.store( 0, boost::memory_order_relaxed );
+	errors_.store( 0, boost::memory_order_relaxed );
+	retries_.store( 0, boost::memory_order_relaxed );
+	busyRejects_.store( 0, boost::memory_order_relaxed );
+	resetTimeMs_.store( nowMs, boost::memory_order_relaxed );
+	latency_.Reset();
+}
+
+std::string BusTransactionStats::Summary( double nowMs ) const
+{
+	std::ostringstream os;
+	double elapsedSec = ( nowMs - resetTimeMs_.load( boost::memory_order_relaxed ) ) / 1000.0;
+	uint32_t transactions = GetTransactions();
+
+	os.setf( std::ios::fixed );
+	os.precision( 2 );
+	os << "n=" << transactions
+		<< " tps=" << ( ( elapsedSec > 0 ) ? transactions / elapsedSec : 0.0 )
+		<< " p50=" << latency_.GetPercentileUs( 50 ) << "us"
+		<< " p99=" << latency_.GetPercentileUs( 99 ) << "us"
+		<< " max=" << latency_.GetMaxUs() << "us"
+		<< " timeouts=" << GetTimeouts()
+		<< " crc=" << GetCrcErrors()
+		<< " exceptions=" << GetExceptions()
+		<< " errors=" << GetErrors()
+		<< " retries=" << GetRetries()
+		<< " busy=" << GetBusyRejects();
+
+	return os.str();
+}
+
+/******************************************
+
+ BusStatistics
+
+ *******************************************/
+
+BusStatistics::FunctionSlot BusStatistics::SlotForFunctionCode( uint8_t functionCode )
+{
+	switch( functionCode )
+	{
+		case 0x03:
+			return FnRead;
+		case 0x06:
+			return FnWrite;
+		case 0x08:
+			return FnDiagnose;
+		case 0x10:
+			return FnMultiWrite;
+		default:
+			return FnOther;
+	}
+}
+
+const char* BusStatistics::FunctionSlotName( FunctionSlot slot )
+{
+	static const char* const names[ NumFunctionSlots ] = { "Read (0x03)", "Write (0x06)", "Diagnose (0x08)", "Multi-Write (0x10)", "Other" };
+	return names[ slot ];
+}
+
+void BusStatistics::Record( uint8_t slaveAddress, uint8_t functionCode, BusTransactionOutcome outcome, uint32_t latencyUs )
+{
+	total_.Record( outcome, latencyUs );
+	byFunction_[ SlotForFunctionCode( functionCode ) ].Record( outcome, latencyUs );
+	bySlave_[ SlaveSlot( slaveAddress ) ].Record( outcome, latencyUs );
+}
+
+void BusStatistics::RecordRetry( uint8_t slaveAddress, uint8_t functionCode )
+{
+	total_.RecordRetry();
+	byFunction_[ SlotForFunctionCode( functionCode ) ].RecordRetry();
+	bySlave_[ SlaveSlot( slaveAddress ) ].RecordRetry();
+}
+
+void BusStatistics::RecordBusyReject( uint8_t slaveAddress, uint8_t functionCode )
+{
+	total_.RecordBusyReject();
+	byFunction_[ SlotForFunctionCode( functionCode ) ].RecordBusyReject();
+	bySlave_[ SlaveSlot( slaveAddress ) ].RecordBusyReject();
+}
+
+void BusStatistics::Reset( void )
+{
+	double now = CAlternativeUtils::GetMonotonicTimeMs();
+
+	total_.Reset( now );
+	for( unsigned int i = 0; i < NumFunctionSlots; i++ )
+	{
+		byFunction_[i].Reset( now );
+	}
+	for( unsigned int i = 0; i < numSlaveSlots_; i++ )
+	{
+		bySlave_[i].Reset( now );
+	}
+}
@@ -0,0 +1,125 @@
+#ifndef _BUS_STATISTICS_
+#define _BUS_STATISTICS_
+
+#include <stdint.h>
+#include <string>
+#include <boost/atomic.hpp>
+
+/*
+*  Lock-Free Serial Bus Instrumentation
+*     Every Counter is a Relaxed boost::atomic, so Recording From the Transaction Path Never Waits
+*     Readers (Property Handlers) See a Consistent-Enough Snapshot, Not an Atomic One
+*/
+
+//How a Transaction Ended, Classified by SerialControllerBus::SerialCommunicate()
+enum BusTransactionOutcome
+{
+	BusOutcomeOk = 0,
+	BusOutcomeTimeout,			//Fewer Bytes Returned Than Expected
+	BusOutcomeCrcError,			//Response Failed the Frame Check
+	BusOutcomeException,		//Slave Answered With an Exception Response
+	BusOutcomeError				//Any Other Failure (Write, Address Mismatch, Parse)
+};
+
+/*  Log-Linear Latency Histogram in Microseconds
+*     Values Below 4 Have Their Own Buckets, Every Power of Two Above is Split Into 4 Linear Sub-Buckets
+*     Reported Percentiles Are the Upper Bound of the Bucket, so Within 25% of the True Value
+*/
+class LatencyHistogram
+{
+	public:
+		static const unsigned int subBucketBits_ = 2;
+		static const unsigned int subBuckets_ = 1 << subBucketBits_;
+		//Covers up to 2^32 us (~70 Minutes)
+		static const unsigned int numBuckets_ = subBuckets_ + ( 32 - subBucketBits_ ) * subBuckets_;
+
+		LatencyHistogram() { Reset(); }
+
+		void Record( uint32_t valueUs );
+		void Reset( void );
+
+		uint64_t GetCount( void ) const;
+		uint32_t GetMaxUs( void ) const { return maxUs_.load( boost::memory_order_relaxed ); }
+		//@param percentile - 0 to 100
+		uint32_t GetPercentileUs( double percentile ) const;
+
+	private:
+		static unsigned int BucketIndex( uint32_t valueUs );
+		static uint32_t BucketUpperBound( unsigned int index );
+
+		boost::atomic<uint32_t> buckets_[ numBuckets_ ];
+		boost::atomic<uint32_t> maxUs_;
+};
+
+/*  Counters For One Slice of Traffic (A Function Code, or a Slave Address)
+*/
+class BusTransactionStats
+{
+	public:
+		BusTransactionStats() { Reset( 0 ); }
+
+		void Record( BusTransactionOutcome outcome, uint32_t latencyUs );
+		void RecordRetry( void ) { retries_.fetch_add( 1, boost::memory_order_relaxed ); }
+		void RecordBusyReject( void ) { busyRejects_.fetch_add( 1, boost::memory_order_relaxed ); }
+		void Reset( double nowMs );
+
+		uint32_t GetTransactions( void ) const { return transactions_.load( boost::memory_order_relaxed ); }
+		uint32_t GetTimeouts( void ) const { return timeouts_.load( boost::memory_order_relaxed ); }
+		uint32_t GetCrcErrors( void ) const { return crcErrors_.load( boost::memory_order_relaxed ); }
+		uint32_t GetExceptions( void ) const { return exceptions_.load( boost::memory_order_relaxed ); }
+		uint32_t GetErrors( void ) const { return errors_.load( boost::memory_order_relaxed ); }
+		uint32_t GetRetries( void ) const { return retries_.load( boost::memory_order_relaxed ); }
+		uint32_t GetBusyRejects( void ) const { return busyRejects_.load( boost::memory_order_relaxed ); }
+		const LatencyHistogram& GetLatency( void ) const { return latency_; }
+
+		/* One-Line Summary For Properties
+		*   @param nowMs - CAlternativeUtils::GetMonotonicTimeMs(), used for transactions per second since the last reset
+		*/
+		std::string Summary( double nowMs ) const;
+
+	private:
+		boost::atomic<uint32_t> transactions_;
+		boost::atomic<uint32_t> timeouts_;
+		boost::atomic<uint32_t> crcErrors_;
+		boost::atomic<uint32_t> exceptions_;
+		boost::atomic<uint32_t> errors_;
+		boost::atomic<uint32_t> retries_;
+		boost::atomic<uint32_t> busyRejects_;
+		boost::atomic<double> resetTimeMs_;
+		LatencyHistogram latency_;
+};
+
+/*  Per Function Code and Per Slave Address Statistics For One Hub
+*     Function Codes Outside the Tracked Set Share the "Other" Slot, Slave Addresses Above maxSlaveAddress_ Share the Last Slot
+*/
+class BusStatistics
+{
+	public:
+		//Modbus Function Codes Used by the Controllers
+		enum FunctionSlot { FnRead = 0, FnWrite, FnDiagnose, FnMultiWrite, FnOther, NumFunctionSlots };
+		static const unsigned int maxSlaveAddress_ = 31;
+		static const unsigned int numSlaveSlots_ = maxSlaveAddress_ + 2;
+
+		BusStatistics() { Reset(); }
+
+		void Record( uint8_t slaveAddress, uint8_t functionCode, BusTransactionOutcome outcome, uint32_t latencyUs );
+		void RecordRetry( uint8_t slaveAddress, uint8_t functionCode );
+		void RecordBusyReject( uint8_t slaveAddress, uint8_t functionCode );
+		void Reset( void );
+
+		static FunctionSlot SlotForFunctionCode( uint8_t functionCode );
+		static const char* FunctionSlotName( FunctionSlot slot );
+
+		const BusTransactionStats& GetTotal( void ) const { return total_; }
+		const BusTransactionStats& GetByFunction( FunctionSlot slot ) const { return byFunction_[ slot ]; }
+		const BusTransactionStats& GetBySlave( uint8_t slaveAddress ) const { return bySlave_[ SlaveSlot( slaveAddress ) ]; }
+
+	private:
+		static unsigned int SlaveSlot( uint8_t slaveAddress ) { return ( slaveAddress > maxSlaveAddress_ ) ? maxSlaveAddress_ + 1 : slaveAddress; }
+
+		BusTransactionStats total_;
+		BusTransactionStats byFunction_[ NumFunctionSlots ];
+		BusTransactionStats bySlave_[ numSlaveSlots_ ];
+};
+
+#endif
@@ -0,0 +1,100 @@
+#include "ConfigFingerprintCache.h"
+#include <stdio.h>
+
+/* Read Persisted Fingerprints ("<bus> <address> <fingerprint hex>" Per Line)
+*   Note:  A missing file is an empty cache, it is created by the first Save() with a fingerprint
+*   Returns - number of fingerprints read
+*/
+int ConfigFingerprintCache::Load( const std::string& path )
+{
+	MMThreadGuard guard( lock_ );
+	path_ = path;
+	dirty_ = false;
+
+	if( path.empty() )
+	{
+		return 0;
+	}
+
+	FILE* file = fopen( path.c_str(), "r" );
+	if( file == nullptr )
+	{
+		return 0;
+	}
+
+	int numRead = 0;
+	char bus[64];
+	unsigned int address;
+	unsigned long fingerprint;
+	while( fscanf( file, "%63s %u %lx", bus, &address, &fingerprint ) == 3 )
+	{
+		fingerprints_[ Key( bus, address ) ] = static_cast< uint32_t >( fingerprint );
+		numRead++;
+	}
+
+	fclose( file );
+	return numRead;
+}
+
+//Rewrite the Cache File if a Fingerprint Changed Since the Last Load() or Save()
+void ConfigFingerprintCache::Save( void )
+{
+	MMThreadGuard guard( lock_ );
+
+	if( path_.empty() || dirty_ == false )
+	{
+		return;
+	}
+
+	FILE* file = fopen( path_.c_str(), "w" );
+	if( file == nullptr )
+	{
+		return;
+	}
+
+	//Keys Are Already "<bus> <address>"
+	for( std::map< std::string, uint32_t >::iterator it = fingerprints_.begin(); it != fingerprints_.end(); ++it )
+	{
+		fprintf( file, "%s %08lx\n", it->first.c_str(), static_cast< unsigned long >( it->second ) );
+	}
+
+	fclose( file );
+	dirty_ = false;
+}
+
+/* Fingerprint Stored For a Controller
+*   Returns - true if one is stored
+*/
+bool ConfigFingerprintCache::Get( const std::string& bus, unsigned int address, uint32_t& fingerprint )
+{
+	MMThreadGuard guard( lock_ );
+
+	std::map< std::string, uint32_t >::iterator it = fingerprints_.find( Key( bus, address ) );
+	if( it == fingerprints_.end() )
+	{
+		return false;
+	}
+
+	fingerprint = it->second;
+	return true;
+}
+
+void ConfigFingerprintCache::Set( const std::string& bus, unsigned int address, uint32_t fingerprint )
+{
+	MMThreadGuard guard( lock_ );
+
+	std::string key = Key( bus, address );
+	std::map< std::string, uint32_t >::iterator it = fingerprints_.find( key );
+	if( it == fingerprints_.end() || it->second != fingerprint )
+	{
+		fingerprints_[ key ] = fingerprint;
+		dirty_ = true;
+	}
+}
+
+std::string ConfigFingerprintCache::Key( const std::string& bus, unsigned int address )
+{
+	char addressText[16];
+	sprintf( addressText, " %u", address );
+	return bus + addressText;
+}
@@ -0,0 +1,49 @@
+#ifndef _CONFIG_FINGERPRINT_CACHE_
+#define _CONFIG_FINGERPRINT_CACHE_
+
+#include "OrientalCoreDefs.h"
+#include <stdint.h>
+#include <string>
+#include <map>
+
+/*
+*  Persisted Configuration Fingerprints, One Per Controller (Bus Serial Number and Slave Address)
+*     Holds the Fingerprint the Adapter Last Left Each Controller With (AbstractControllerInterface::GetConfigurationFingerprint())
+*     A Read at the Next Start That Differs From it Means the Configuration Was Changed Outside the Adapter (Power Cycle, Other Software)
+*     Note:  The Controller is Still Read Every Start, the Cache Only Tells an Expected Difference From an Unexpected One
+*/
+class ConfigFingerprintCache
+{
+	public:
+		ConfigFingerprintCache( void ) : dirty_(false) {}
+
+		/* Read Persisted Fingerprints ("<bus> <address> <fingerprint hex>" Per Line)
+		*   @param path - cache file, rewritten by Save() ("" disables persistence)
+		*   Returns - number of fingerprints read
+		*/
+		int Load( const std::string& path );
+
+		//Rewrite the Cache File if a Fingerprint Changed Since the Last Load() or Save()
+		void Save( void );
+
+		/* Fingerprint Stored For a Controller
+		*   @param bus - serial number of the bus (no whitespace)
+		*   Returns - true if one is stored
+		*/
+		bool Get( const std::string& bus, unsigned int address, uint32_t& fingerprint );
+		void Set( const std::string& bus, unsigned int address, uint32_t fingerprint );
+
+	private:
+
+		static std::string Key( const std::string& bus, unsigned int address );
+
+		MMThreadLock lock_;
+		std::map< std::string, uint32_t > fingerprints_;
+		std::string path_;
+		bool dirty_;
+
+		ConfigFingerprintCache( const ConfigFingerprintCache& );
+		ConfigFingerprintCache& operator=( const ConfigFingerprintCache& );
+};
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef _CONTROLLER_BUS_
+#define _CONTROLLER_BUS_
+
+#include "TelemetryRecorder.h"
+
+//Forward Declarations
+class AbstractControllerInterface;
+class ControllerStatusMonitorThread;
+class ControllerLogSink;
+
+/*
+*  Everything the Controller Core Needs From Whatever Owns the Serial Line
+*     OrientalFTDIHub Implements it Over a SerialTransport; Controllers Only See This Interface
+*     (AbstractControllerInterface::SerialCommFuncPtr Points at Members of it)
+*/
+class ControllerBus
+{
+	public:
+		virtual ~ControllerBus() {}
+
+		/* One Request/Response Exchange With controller's Slave
+		*   @param txMsgBuffer[] - complete request frame, including the check value
+		*   @param txMsgLen - number of bytes in txMsgBuffer
+		*   @param controller - controller the response is parsed by
+		*   @param broadcast - true if no response is expected
+		*   Returns - 0 (DEVICE_OK) or errCode otherwise
+		*/
+		virtual int SerialCommunicate( unsigned char txMsgBuffer[], int txMsgLen, AbstractControllerInterface* controller, bool broadcast ) = 0;
+
+		//Recording Register Reads and Moves are Appended To (May be Closed)
+		virtual TelemetryRecorder& GetTelemetryRecorder( void ) = 0;
+
+		//Monitor Thread Controllers Register With, or nullptr if the Bus Has None
+		virtual ControllerStatusMonitorThread* GetStatusMonitorThread( void ) = 0;
+
+		//Sink Controller Logging For This Bus Goes to (Open a ControllerLogScope With it), or nullptr
+		virtual ControllerLogSink* GetLogSink( void ) = 0;
+};
+
+/*  Bus That Accepts Every Frame Without Sending it (Scratch Controllers For Benchmarks)
+*/
+class NullControllerBus : public ControllerBus
+{
+	public:
+		int SerialCommunicate( unsigned char /*txMsgBuffer*/[], int /*txMsgLen*/, AbstractControllerInterface* /*controller*/, bool /*broadcast*/ ) { return 0; }
+		TelemetryRecorder& GetTelemetryRecorder( void ) { return telemetryRecorder_; }
+		ControllerStatusMonitorThread* GetStatusMonitorThread( void ) { return nullptr; }
+		ControllerLogSink* GetLogSink( void ) { return nullptr; }
+
+	private:
+		//Never Opened
+		TelemetryRecorder telemetryRecorder_;
+};
+
+#endif
@@ -0,0 +1,354 @@
+#include "ControllerLog.h"
+#include "AlternativeUtils.h"
+#include <stdio.h>
+
+boost::atomic<bool> ControllerLog::attached_( false );
+ControllerLog::LogRing ControllerLog::ring_;
+boost::atomic<unsigned long> ControllerLog::queuedCount_( 0 );
+boost::atomic<unsigned long> ControllerLog::droppedCount_( 0 );
+boost::atomic<unsigned long> ControllerLog::deliveredCount_( 0 );
+unsigned long ControllerLog::reportedDrops_ = 0;
+MMThreadLock ControllerLog::lock_;
+ControllerLogSink* ControllerLog::sinks_[ ControllerLog::maxSinks_ ] = { nullptr };
+unsigned int ControllerLog::numSinks_ = 0;
+ControllerLogThread* ControllerLog::thread_ = nullptr;
+MMThreadLock ControllerLog::drainLock_;
+ORIENTAL_THREAD_LOCAL ControllerLogSink* ControllerLog::threadChannel_ = nullptr;
+
+static const char* const g_LogLevelNames[ NumLogLevels + 1 ] = { "Trace", "Debug", "Info", "Warn", "Error", "Off" };
+
+/******************************************
+
+ ControllerLogRecord
+
+ *******************************************/
+
+std::string ControllerLogRecord::Format( void ) const
+{
+	std::string out;
+	char numBuf[32];
+	unsigned int nextArg = 0;
+
+	for( const char* f = format; *f != '\0'; f++ )
+	{
+		bool hex = false;
+		if( f[0] == '{' && f[1] == '}' )
+		{
+			f += 1;
+		}
+		else if( f[0] == '{' && f[1] == 'x' && f[2] == '}' )
+		{
+			hex = true;
+			f += 2;
+		}
+		else
+		{
+			out += *f;
+			continue;
+		}
+
+		//More Placeholders Than Arguments Are Left in Place
+		if( nextArg >= numArgs )
+		{
+			out += ( hex ) ? "{x}" : "{}";
+			continue;
+		}
+
+		const StoredArg& arg = args[ nextArg++ ];
+		switch( arg.type )
+		{
+			case ControllerLogArg::ArgSigned:
+				if( hex )
+					sprintf( numBuf, "0x%llX", static_cast< unsigned long long >( arg.value.i ) );
+				else
+					sprintf( numBuf, "%lld", static_cast< long long >( arg.value.i ) );
+				out += numBuf;
+				break;
+			case ControllerLogArg::ArgUnsigned:
+				sprintf( numBuf, ( hex ) ? "0x%llX" : "%llu", static_cast< unsigned long long >( arg.value.u ) );
+				out += numBuf;
+				break;
+			case ControllerLogArg::ArgDouble:
+				sprintf( numBuf, "%g", arg.value.d );
+				out += numBuf;
+				break;
+			case ControllerLogArg::ArgText:
+				out.append( &text[ arg.offset ], arg.length );
+				break;
+			case ControllerLogArg::ArgBytes:
+				for( unsigned int i = 0; i < arg.length; i++ )
+				{
+					sprintf( numBuf, ( i == 0 ) ? "%02X" : " %02X", static_cast< unsigned int >( static_cast< unsigned char >( text[ arg.offset + i ] ) ) );
+					out += numBuf;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+
+	return out;
+}
+
+/******************************************
+
+ ControllerLog
+
+ *******************************************/
+
+const char* ControllerLog::LevelName( int level )
+{
+	if( level < 0 || level > NumLogLevels )
+	{
+		return "Unknown";
+	}
+	return g_LogLevelNames[ level ];
+}
+
+int ControllerLog::LevelFromName( const std::string& name )
+{
+	for( int i = 0; i <= NumLogLevels; i++ )
+	{
+		if( name == g_LogLevelNames[i] )
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+/* Add sink to the Sinks Records Are Routed to
+*   @param sink - must stay valid until Detach( sink )
+*   Returns - 0, or 1 if maxSinks_ sinks are already attached (its records are then discarded)
+*/
+int ControllerLog::Attach( ControllerLogSink* sink )
+{
+	MMThreadGuard guard( lock_ );
+
+	for( unsigned int i = 0; i < numSinks_; i++ )
+	{
+		if( sinks_[i] == sink )
+		{
+			return 0;
+		}
+	}
+
+	if( numSinks_ == maxSinks_ )
+	{
+		return 1;
+	}
+
+	sinks_[ numSinks_++ ] = sink;
+
+	if( thread_ == nullptr )
+	{
+		thread_ = new ControllerLogThread();
+		thread_->Start();
+	}
+
+	attached_ = true;
+	return 0;
+}
+
+/* Flush Pending Records and Remove sink, Stopping the Log Thread if it Was the Last
+*   Note:  With the last sink, statements emitted by other threads during the flush are discarded
+*   @param sink - ignored if not attached
+*/
+void ControllerLog::Detach( ControllerLogSink* sink )
+{
+	ControllerLogThread* thread = nullptr;
+	{
+		MMThreadGuard guard( lock_ );
+		unsigned int i = 0;
+		while( i < numSinks_ && sinks_[i] != sink )
+		{
+			i++;
+		}
+		if( i == numSinks_ )
+		{
+			return;
+		}
+		if( numSinks_ == 1 )
+		{
+			attached_ = false;
+			thread = thread_;
+			thread_ = nullptr;
+		}
+	}
+
+	if( thread != nullptr )
+	{
+		thread->Stop();
+		thread->wait();
+		delete thread;
+	}
+
+	//sink is Still Attached, so its Queued Records Reach it
+	Drain();
+
+	MMThreadGuard guard( lock_ );
+	for( unsigned int i = 0; i < numSinks_; i++ )
+	{
+		if( sinks_[i] == sink )
+		{
+			sinks_[i] = sinks_[ --numSinks_ ];
+			sinks_[ numSinks_ ] = nullptr;
+			break;
+		}
+	}
+}
+
+void ControllerLog::Emit( int level, const char* format )
+{
+	Capture( level, format, nullptr, 0 );
+}
+
+void ControllerLog::Emit( int level, const char* format, const ControllerLogArg& a1 )
+{
+	const ControllerLogArg* args[] = { &a1 };
+	Capture( level, format, args, 1 );
+}
+
+void ControllerLog::Emit( int level, const char* format, const ControllerLogArg& a1, const ControllerLogArg& a2 )
+{
+	const ControllerLogArg* args[] = { &a1, &a2 };
+	Capture( level, format, args, 2 );
+}
+
+void ControllerLog::Emit( int level, const char* format, const ControllerLogArg& a1, const ControllerLogArg& a2, const ControllerLogArg& a3 )
+{
+	const ControllerLogArg* args[] = { &a1, &a2, &a3 };
+	Capture( level, format, args, 3 );
+}
+
+void ControllerLog::Emit( int level, const char* format, const ControllerLogArg& a1, const ControllerLogArg& a2, const ControllerLogArg& a3, const ControllerLogArg& a4 )
+{
+	const ControllerLogArg* args[] = { &a1, &a2, &a3, &a4 };
+	Capture( level, format, args, 4 );
+}
+
+/* Copy a Statement's Arguments Into a Record and Push it to the Ring For the Log Thread
+*   Note:  No formatting, locking or allocation is done here; a full ring drops the record
+*/
+void ControllerLog::Capture( int level, const char* format, const ControllerLogArg* args[], unsigned int numArgs )
+{
+	//Unscoped Statements Have No Sink to Go to
+	if( attached_ == false || threadChannel_ == nullptr )
+	{
+		return;
+	}
+
+	ControllerLogRecord record;
+	record.level = level;
+	record.format = format;
+	record.channel = threadChannel_;
+	record.numArgs = ( numArgs > ControllerLogRecord::maxArgs_ ) ? ControllerLogRecord::maxArgs_ : numArgs;
+	record.textUsed = 0;
+
+	for( unsigned int i = 0; i < record.numArgs; i++ )
+	{
+		const ControllerLogArg& arg = *args[i];
+		ControllerLogRecord::StoredArg& stored = record.args[i];
+
+		stored.type = static_cast< uint8_t >( arg.type_ );
+		stored.offset = 0;
+		stored.length = 0;
+		stored.value.u = arg.value_.u;
+
+		if( arg.type_ == ControllerLogArg::ArgText || arg.type_ == ControllerLogArg::ArgBytes )
+		{
+			size_t room = ControllerLogRecord::maxTextBytes_ - record.textUsed;
+			size_t len = ( arg.value_.data.n < room ) ? arg.value_.data.n : room;
+			if( len > 0 )
+			{
+				memcpy( &record.text[ record.textUsed ], arg.value_.data.p, len );
+			}
+			stored.offset = static_cast< uint16_t >( record.textUsed );
+			stored.length = static_cast< uint16_t >( len );
+			record.textUsed += static_cast< unsigned int >( len );
+		}
+	}
+
+	if( ring_.bounded_push( record ) )
+	{
+		queuedCount_.fetch_add( 1, boost::memory_order_relaxed );
+	}
+	else
+	{
+		droppedCount_.fetch_add( 1, boost::memory_order_relaxed );
+	}
+}
+
+/* Format and Send Everything in the Ring to the Sinks
+*   Note:  Trace and Debug records are sent as debug-only, so a sink's own debug switch (the core's debug log) still applies
+*          A record goes to its channel if that sink is attached, otherwise it is discarded
+*          Only one thread drains at a time (drainLock_)
+*/
+void ControllerLog::Drain( void )
+{
+	MMThreadGuard drainGuard( drainLock_ );
+
+	ControllerLogSink* sinks[ maxSinks_ ];
+	unsigned int numSinks;
+	{
+		MMThreadGuard guard( lock_ );
+		numSinks = numSinks_;
+		for( unsigned int i = 0; i < numSinks; i++ )
+		{
+			sinks[i] = sinks_[i];
+		}
+	}
+
+	ControllerLogRecord record;
+	while( ring_.pop( record ) )
+	{
+		ControllerLogSink* sink = nullptr;
+		for( unsigned int i = 0; i < numSinks; i++ )
+		{
+			if( sinks[i] == record.channel )
+			{
+				sink = sinks[i];
+				break;
+			}
+		}
+
+		//Unscoped, or its Sink Was Detached Meanwhile
+		if( sink == nullptr )
+		{
+			continue;
+		}
+
+		sink->LogMessage( record.Format().c_str(), record.level < LogLevelInfo );
+		deliveredCount_.fetch_add( 1, boost::memory_order_relaxed );
+	}
+
+	//Drops Are Not Attributed to a Channel, so Every Sink Hears About Them
+	unsigned long dropped = droppedCount_.load( boost::memory_order_relaxed );
+	if( dropped != reportedDrops_ && numSinks > 0 )
+	{
+		char msg[96];
+		sprintf( msg, "Controller Log Ring Full: %lu Records Dropped (%lu Total)", dropped - reportedDrops_, dropped );
+		for( unsigned int i = 0; i < numSinks; i++ )
+		{
+			sinks[i]->LogMessage( msg, false );
+		}
+		reportedDrops_ = dropped;
+	}
+}
+
+/******************************************
+
+ ControllerLogThread
+
+ *******************************************/
+
+int ControllerLogThread::svc( void )
+{
+	while( stop_ == false )
+	{
+		ControllerLog::Drain();
+		CAlternativeUtils::SleepMs( drainIntervalMS_ );
+	}
+
+	return 0;
+}
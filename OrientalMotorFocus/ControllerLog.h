@@ -0,0 +1,275 @@
+#ifndef _CONTROLLER_LOG_
+#define _CONTROLLER_LOG_
+
+#include "OrientalCoreDefs.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <string>
+#include <boost/atomic.hpp>
+#include <boost/lockfree/queue.hpp>
+
+/*
+*  Level-Gated, Deferred-Format Logging For the Controller Hot Path
+*     A Statement Below ORIENTAL_LOG_COMPILE_LEVEL is Compiled Out, One Below the Run-Time Level Costs a Thread-Local Load and One Branch
+*     Enabled Statements Copy Their Arguments Into a Record and Push it to a Bounded Lock-Free Ring (Any Number of Producers)
+*     Formatting and the ControllerLogSink Happen on the Log Thread, so No Statement Ever Waits on the Sink (the Core's Logger in the Adapter)
+*     A Full Ring Drops the Record and Counts it; the Log Thread Reports New Drops in the Log Itself
+*     Formats Use "{}" For Each Argument, "{x}" For Hexadecimal Integers
+*
+*  Usage:  ORIENTAL_LOG_DEBUG( "Wrote {} Bytes to Slave {}", len, address );
+*     format Must Be a String Literal (Only the Pointer is Kept), Arguments Are Not Evaluated When the Level is Off
+*     Preformatted Text is Logged as ORIENTAL_LOG_INFO( "{}", text ) (Truncated to ControllerLogRecord::maxTextBytes_)
+*
+*  Several Hubs:  Each Attaches its Own Sink, and a Record Goes to the Sink of the ControllerLogScope Open on the Emitting Thread
+*     The Run-Time Level is the Scope's Sink's (ControllerLogSink::SetLevel()), so Each Hub Sets its Own
+*     Statements Emitted Outside Any Scope Are Discarded, as Are Records Whose Sink Was Detached Before They Were Drained
+*/
+
+enum ControllerLogLevel
+{
+	LogLevelTrace = 0,		//Per Frame Step Chatter
+	LogLevelDebug,			//Per Transaction Detail (Frames, Values)
+	LogLevelInfo,			//Configuration and Lifecycle
+	LogLevelWarn,			//Failed Transactions the Caller Recovers From
+	LogLevelError,
+	LogLevelOff,
+	NumLogLevels = LogLevelOff
+};
+
+//Lowest Level Compiled In (Override in the Project Settings to Strip More)
+#ifndef ORIENTAL_LOG_COMPILE_LEVEL
+#ifdef _DEBUG
+#define ORIENTAL_LOG_COMPILE_LEVEL LogLevelTrace
+#else
+#define ORIENTAL_LOG_COMPILE_LEVEL LogLevelDebug
+#endif
+#endif
+
+//Thread-Local Storage For PODs (Statically Sized, so the Loader Sets it Up For Every Thread)
+#ifdef WIN32
+#define ORIENTAL_THREAD_LOCAL __declspec(thread)
+#else
+#define ORIENTAL_THREAD_LOCAL __thread
+#endif
+
+/*  One Log Argument, Held by Reference Until ControllerLog::Emit() Copies it Into a Record
+*     Strings and Byte Buffers Only Need to Outlive the Statement
+*/
+class ControllerLogArg
+{
+	public:
+		enum Type { ArgNone = 0, ArgSigned, ArgUnsigned, ArgDouble, ArgText, ArgBytes };
+
+		ControllerLogArg() : type_(ArgNone) { value_.i = 0; }
+		ControllerLogArg( int v ) : type_(ArgSigned) { value_.i = v; }
+		ControllerLogArg( long v ) : type_(ArgSigned) { value_.i = v; }
+		ControllerLogArg( long long v ) : type_(ArgSigned) { value_.i = v; }
+		ControllerLogArg( unsigned int v ) : type_(ArgUnsigned) { value_.u = v; }
+		ControllerLogArg( unsigned long v ) : type_(ArgUnsigned) { value_.u = v; }
+		ControllerLogArg( unsigned long long v ) : type_(ArgUnsigned) { value_.u = v; }
+		ControllerLogArg( double v ) : type_(ArgDouble) { value_.d = v; }
+		ControllerLogArg( const char* v ) : type_(ArgText) { value_.data.p = v; value_.data.n = ( v == nullptr ) ? 0 : strlen( v ); }
+		ControllerLogArg( const std::string& v ) : type_(ArgText) { value_.data.p = v.data(); value_.data.n = v.size(); }
+
+		//Byte Buffer, Formatted as Space Separated Hex Pairs
+		static ControllerLogArg Bytes( const unsigned char buffer[], size_t len ) { ControllerLogArg arg; arg.type_ = ArgBytes; arg.value_.data.p = buffer; arg.value_.data.n = len; return arg; }
+
+		Type type_;
+		union
+		{
+			int64_t i;
+			uint64_t u;
+			double d;
+			struct { const void* p; size_t n; } data;
+		} value_;
+};
+
+class ControllerLogSink;
+
+/*  Captured Statement Waiting For the Log Thread
+*     Text and Byte Arguments Are Packed Into text (Truncated Once it is Full)
+*/
+struct ControllerLogRecord
+{
+	static const unsigned int maxArgs_ = 4;
+	static const unsigned int maxTextBytes_ = 256;
+
+	struct StoredArg
+	{
+		uint8_t type;				//ControllerLogArg::Type
+		uint16_t offset;			//Into text For Text and Bytes
+		uint16_t length;
+		union { int64_t i; uint64_t u; double d; } value;
+	};
+
+	int level;
+	const char* format;
+	//Sink of the Emitting Thread's Scope
+	ControllerLogSink* channel;
+	unsigned int numArgs;
+	unsigned int textUsed;
+	StoredArg args[ maxArgs_ ];
+	char text[ maxTextBytes_ ];
+
+	//Expand format With the Stored Arguments
+	std::string Format( void ) const;
+};
+
+class ControllerLogThread;
+class ControllerTrace;
+
+/*  Destination of Formatted Records, Only Called From the Log Thread (or Detach() Once it Has Stopped)
+*     Also Holds What Threads in its Scope Are Gated by:  the Run-Time Level, and the Span Trace (ControllerTrace.h) They Record Into
+*/
+class ControllerLogSink
+{
+	public:
+		ControllerLogSink() : level_(LogLevelInfo), trace_(nullptr) {}
+		virtual ~ControllerLogSink() {}
+
+		/* @param text - formatted record
+		*  @param debugOnly - true For Trace and Debug records
+		*/
+		virtual void LogMessage( const char* text, bool debugOnly ) = 0;
+
+		//Run-Time Level of Statements Emitted in This Sink's Scope
+		bool IsEnabled( int level ) const { return level >= level_.load( boost::memory_order_relaxed ); }
+		void SetLevel( int level ) { level_.store( level, boost::memory_order_relaxed ); }
+		int GetLevel( void ) const { return level_.load( boost::memory_order_relaxed ); }
+
+		//Trace Spans Opened in This Sink's Scope Record Into trace (nullptr For None, Must Outlive the Scopes)
+		void SetTrace( ControllerTrace* trace ) { trace_ = trace; }
+		ControllerTrace* GetTrace( void ) const { return trace_; }
+
+	private:
+		boost::atomic<int> level_;
+		ControllerTrace* trace_;
+};
+
+/*  Process-Wide Logger Behind the ORIENTAL_LOG Macros
+*     Attach() Adds a Sink (Starting the Log Thread With the First), Detach() Flushes and Removes it (Stopping the Thread With the Last)
+*     Statements Emitted While Nothing is Attached Are Discarded
+*/
+class ControllerLog
+{
+	public:
+		//Records the Ring Holds (Fixed So Pushing Never Allocates; boost::lockfree Allows up to 65534)
+		static const size_t ringCapacity_ = 1024;
+		//Sinks Attached at Once (One Per Hub)
+		static const unsigned int maxSinks_ = 8;
+
+		//The One Test Made by Every Statement That Survived Compilation:  Inside a Scope, at or Above its Sink's Level
+		static bool IsEnabled( int level ) { ControllerLogSink* sink = threadChannel_; return sink != nullptr && sink->IsEnabled( level ); }
+
+		static const char* LevelName( int level );
+		//Returns - the level named, or -1 if name is not a level name
+		static int LevelFromName( const std::string& name );
+
+		/* Add sink to the Sinks Records Are Routed to
+		*   @param sink - must stay valid until Detach( sink )
+		*   Returns - 0, or 1 if maxSinks_ sinks are already attached (its records are then discarded)
+		*/
+		static int Attach( ControllerLogSink* sink );
+		/* Flush Pending Records and Remove sink, Stopping the Log Thread if it Was the Last
+		*   @param sink - ignored if not attached
+		*/
+		static void Detach( ControllerLogSink* sink );
+
+		//Sink Records Emitted by the Calling Thread Go to (Use Through ControllerLogScope)
+		static ControllerLogSink* GetThreadChannel( void ) { return threadChannel_; }
+		static void SetThreadChannel( ControllerLogSink* sink ) { threadChannel_ = sink; }
+
+		//Counters (Since the Process Started)
+		static unsigned long GetQueuedCount( void ) { return queuedCount_.load( boost::memory_order_relaxed ); }
+		static unsigned long GetDroppedCount( void ) { return droppedCount_.load( boost::memory_order_relaxed ); }
+		static unsigned long GetDeliveredCount( void ) { return deliveredCount_.load( boost::memory_order_relaxed ); }
+
+		//Capture a Statement, Use Through the ORIENTAL_LOG Macros
+		static void Emit( int level, const char* format );
+		static void Emit( int level, const char* format, const ControllerLogArg& a1 );
+		static void Emit( int level, const char* format, const ControllerLogArg& a1, const ControllerLogArg& a2 );
+		static void Emit( int level, const char* format, const ControllerLogArg& a1, const ControllerLogArg& a2, const ControllerLogArg& a3 );
+		static void Emit( int level, const char* format, const ControllerLogArg& a1, const ControllerLogArg& a2, const ControllerLogArg& a3, const ControllerLogArg& a4 );
+
+	private:
+		friend class ControllerLogThread;
+
+		ControllerLog();
+
+		static void Capture( int level, const char* format, const ControllerLogArg* args[], unsigned int numArgs );
+		//Format and Send Everything in the Ring to the Sinks (Log Thread or Detach())
+		static void Drain( void );
+
+		typedef boost::lockfree::queue< ControllerLogRecord, boost::lockfree::capacity< ringCapacity_ > > LogRing;
+
+		static boost::atomic<bool> attached_;
+
+		static LogRing ring_;
+		static boost::atomic<unsigned long> queuedCount_;
+		static boost::atomic<unsigned long> droppedCount_;
+		static boost::atomic<unsigned long> deliveredCount_;
+		//Drops Already Reported by Drain()
+		static unsigned long reportedDrops_;
+
+		//Protects sinks_, numSinks_ and thread_, Never Taken by Producers
+		static MMThreadLock lock_;
+		static ControllerLogSink* sinks_[ maxSinks_ ];
+		static unsigned int numSinks_;
+		static ControllerLogThread* thread_;
+		//Only One Thread Drains at a Time
+		static MMThreadLock drainLock_;
+
+		static ORIENTAL_THREAD_LOCAL ControllerLogSink* threadChannel_;
+};
+
+/*  Scoped Routing of the Calling Thread's Records to One Sink (Restores the Previous Sink on Destruction)
+*     Opened by a Hub Around Everything it Runs For its Controllers (Transactions, its Monitor Thread, Property Handlers)
+*/
+class ControllerLogScope
+{
+	public:
+		ControllerLogScope( ControllerLogSink* sink ) : previous_( ControllerLog::GetThreadChannel() ) { ControllerLog::SetThreadChannel( sink ); }
+		~ControllerLogScope() { ControllerLog::SetThreadChannel( previous_ ); }
+
+	private:
+		ControllerLogSink* previous_;
+
+		ControllerLogScope( const ControllerLogScope& );
+		ControllerLogScope& operator=( const ControllerLogScope& );
+};
+
+/*  Log Thread: Wakes Every Few Milliseconds and Drains the Ring Into the Sink
+*/
+class ControllerLogThread : public MMDeviceThreadBase
+{
+	public:
+		static const long drainIntervalMS_ = 5;
+
+		ControllerLogThread() : stop_(false) {}
+
+		int svc( void );
+		int open (void*) { return 0;}
+		int close(unsigned long) {return 0;}
+
+		void Start() { stop_ = false; activate(); }
+		void Stop() { stop_ = true; }
+
+	private:
+		boost::atomic<bool> stop_;
+};
+
+//Statement Macros:  The Compile-Time Test Folds Away, the Run-Time Test is a Relaxed Load and a Compare
+#define ORIENTAL_LOG( level, ... ) \
+	do { if( (level) >= ORIENTAL_LOG_COMPILE_LEVEL && ControllerLog::IsEnabled( level ) ) ControllerLog::Emit( level, __VA_ARGS__ ); } while( 0 )
+
+#define ORIENTAL_LOG_TRACE( ... ) ORIENTAL_LOG( LogLevelTrace, __VA_ARGS__ )
+#define ORIENTAL_LOG_DEBUG( ... ) ORIENTAL_LOG( LogLevelDebug, __VA_ARGS__ )
+#define ORIENTAL_LOG_INFO( ... ) ORIENTAL_LOG( LogLevelInfo, __VA_ARGS__ )
+#define ORIENTAL_LOG_WARN( ... ) ORIENTAL_LOG( LogLevelWarn, __VA_ARGS__ )
+#define ORIENTAL_LOG_ERROR( ... ) ORIENTAL_LOG( LogLevelError, __VA_ARGS__ )
+
+//Byte Buffer Argument
+#define ORIENTAL_LOG_BYTES( buffer, len ) ControllerLogArg::Bytes( buffer, len )
+
+#endif
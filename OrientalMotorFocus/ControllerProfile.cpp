@@ -0,0 +1,224 @@
+#include "ControllerProfile.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Read Every Profile in a File
+*   Note:  Settings before the first "[Profile Name]", empty or repeated profile names are errors
+*   Returns - 0 if read, otherwise non-zero (profiles is then empty)
+*/
+int ControllerProfileFile::Load( const std::string& path, std::vector< ControllerProfile >& profiles, std::string& error )
+{
+	profiles.clear();
+
+	FILE* file = fopen( path.c_str(), "r" );
+	if( file == nullptr )
+	{
+		error = "Cannot Open " + path;
+		return 1;
+	}
+
+	char buffer[ maxLineLength_ + 2 ];
+	char lineText[ 32 ];
+	unsigned int lineNum = 0;
+	int ret = 0;
+
+	while( ret == 0 && fgets( buffer, sizeof( buffer ), file ) != nullptr )
+	{
+		lineNum++;
+		sprintf( lineText, "Line %u: ", lineNum );
+
+		if( strlen( buffer ) > static_cast< size_t >( maxLineLength_ ) && buffer[ strlen( buffer ) - 1 ] != '\n' )
+		{
+			error = std::string( lineText ) + "Too Long";
+			ret = 1;
+			break;
+		}
+
+		std::string line( buffer );
+		std::string::size_type comment = line.find( '#' );
+		if( comment != std::string::npos )
+		{
+			line.erase( comment );
+		}
+		line = Trim( line );
+
+		if( line.empty() )
+		{
+			continue;
+		}
+
+		if( line[0] == '[' )
+		{
+			std::string name = ( line[ line.size() - 1 ] == ']' ) ? Trim( line.substr( 1, line.size() - 2 ) ) : "";
+			if( name.empty() )
+			{
+				error = std::string( lineText ) + "Expected [Profile Name]";
+				ret = 1;
+				break;
+			}
+			for( size_t i = 0; i < profiles.size(); i++ )
+			{
+				if( profiles[i].name == name )
+				{
+					error = std::string( lineText ) + "Profile " + name + " Defined Twice";
+					ret = 1;
+				}
+			}
+			if( ret != 0 )
+			{
+				break;
+			}
+
+			ControllerProfile profile;
+			profile.name = name;
+			profiles.push_back( profile );
+			continue;
+		}
+
+		std::string::size_type equals = line.find( '=' );
+		ControllerProfileSetting setting;
+		setting.line = lineNum;
+
+		if( equals == std::string::npos || ( setting.registerName = Trim( line.substr( 0, equals ) ) ).empty() )
+		{
+			error = std::string( lineText ) + "Expected registerName = value";
+			ret = 1;
+		}
+		else if( ParseValue( Trim( line.substr( equals + 1 ) ), setting.value ) == false )
+		{
+			error = std::string( lineText ) + "Value of " + setting.registerName + " is Not a Number";
+			ret = 1;
+		}
+		else if( profiles.empty() )
+		{
+			error = std::string( lineText ) + "Setting Before the First [Profile Name]";
+			ret = 1;
+		}
+		else
+		{
+			profiles.back().settings.push_back( setting );
+		}
+	}
+
+	fclose( file );
+
+	if( ret != 0 )
+	{
+		profiles.clear();
+	}
+
+	return ret;
+}
+
+/* Write Profiles in the Format Load() Reads
+*   Note:  Every line of comment gets its own '#'
+*   Returns - 0 if written, otherwise non-zero
+*/
+int ControllerProfileFile::Save( const std::string& path, const std::vector< ControllerProfile >& profiles, const std::string& comment )
+{
+	FILE* file = fopen( path.c_str(), "w" );
+	if( file == nullptr )
+	{
+		return 1;
+	}
+
+	std::string::size_type start = 0;
+	while( start < comment.size() )
+	{
+		std::string::size_type end = comment.find( '\n', start );
+		if( end == std::string::npos )
+		{
+			end = comment.size();
+		}
+		fprintf( file, "# %s\n", comment.substr( start, end - start ).c_str() );
+		start = end + 1;
+	}
+
+	for( size_t i = 0; i < profiles.size(); i++ )
+	{
+		fprintf( file, "%s[%s]\n", ( i == 0 && comment.empty() ) ? "" : "\n", profiles[i].name.c_str() );
+		for( size_t s = 0; s < profiles[i].settings.size(); s++ )
+		{
+			fprintf( file, "%s = %lld\n", profiles[i].settings[s].registerName.c_str(), profiles[i].settings[s].value );
+		}
+	}
+
+	int ret = ( ferror( file ) != 0 ) ? 1 : 0;
+	fclose( file );
+	return ret;
+}
+
+//Strip Leading and Trailing Whitespace
+std::string ControllerProfileFile::Trim( const std::string& text )
+{
+	static const char* const whitespace = " \t\r\n";
+	std::string::size_type first = text.find_first_not_of( whitespace );
+
+	if( first == std::string::npos )
+	{
+		return "";
+	}
+
+	return text.substr( first, text.find_last_not_of( whitespace ) - first + 1 );
+}
+
+/* Parse a Decimal or 0x Hex Value, Optionally Negative
+*   Note:  Leading zeros are decimal (no octal), so "010" is 10
+*   Returns - true if all of text was the value
+*/
+bool ControllerProfileFile::ParseValue( const std::string& text, long long& value )
+{
+	size_t pos = 0;
+	bool negative = false;
+
+	if( pos < text.size() && ( text[pos] == '-' || text[pos] == '+' ) )
+	{
+		negative = ( text[pos] == '-' );
+		pos++;
+	}
+
+	unsigned long long magnitude = 0;
+	unsigned int base = 10;
+	if( text.size() > pos + 2 && text[pos] == '0' && ( text[pos + 1] == 'x' || text[pos + 1] == 'X' ) )
+	{
+		base = 16;
+		pos += 2;
+	}
+
+	if( pos == text.size() )
+	{
+		return false;
+	}
+
+	for( ; pos < text.size(); pos++ )
+	{
+		char c = text[pos];
+		unsigned int digit;
+		if( c >= '0' && c <= '9' )
+		{
+			digit = c - '0';
+		}
+		else if( base == 16 && c >= 'a' && c <= 'f' )
+		{
+			digit = c - 'a' + 10;
+		}
+		else if( base == 16 && c >= 'A' && c <= 'F' )
+		{
+			digit = c - 'A' + 10;
+		}
+		else
+		{
+			return false;
+		}
+
+		magnitude = magnitude * base + digit;
+		//Registers Are at Most 32 Bits, Anything Past That is Only Kept From Wrapping
+		if( magnitude > 0xFFFFFFFFFFull )
+		{
+			return false;
+		}
+	}
+
+	value = ( negative ) ? -static_cast< long long >( magnitude ) : static_cast< long long >( magnitude );
+	return true;
+}
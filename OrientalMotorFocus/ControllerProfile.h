@@ -0,0 +1,58 @@
+#ifndef _CONTROLLER_PROFILE_
+#define _CONTROLLER_PROFILE_
+
+#include <string>
+#include <vector>
+
+/*  One "register = value" Line of a Profile
+*     registerName is the Controller's Profile Name For a Register, or its Address in Hex ("0x0228")
+*     value is in the Register's Own Units (See the Controller's Register Comments)
+*/
+struct ControllerProfileSetting
+{
+	std::string registerName;
+	long long value;
+	unsigned int line;			//Line in the Profile File, For Error Messages
+};
+
+struct ControllerProfile
+{
+	std::string name;
+	std::vector< ControllerProfileSetting > settings;
+};
+
+/*
+*  Named Register Profiles Kept in a Text File
+*     "[Profile Name]" Starts a Profile, "registerName = value" Lines Add to it (Decimal or 0x Hex), '#' Starts a Comment
+*     Note:  Only the syntax is checked here; AbstractControllerInterface::ValidateProfile() checks names and values
+*/
+class ControllerProfileFile
+{
+	public:
+		//Longest Line Read (Longer Lines Are an Error)
+		static const int maxLineLength_ = 256;
+
+		/* Read Every Profile in a File
+		*   @param profiles - filled with the profiles in file order (cleared first, left empty on an error)
+		*   @param error - set to a description of the first problem
+		*   Returns - 0 if read, otherwise non-zero
+		*/
+		static int Load( const std::string& path, std::vector< ControllerProfile >& profiles, std::string& error );
+
+		/* Write Profiles in the Format Load() Reads
+		*   @param comment - written as '#' lines ahead of the profiles ("" for none)
+		*   Returns - 0 if written, otherwise non-zero
+		*/
+		static int Save( const std::string& path, const std::vector< ControllerProfile >& profiles, const std::string& comment = "" );
+
+	private:
+		//Strip Leading and Trailing Whitespace
+		static std::string Trim( const std::string& text );
+
+		/* Parse a Decimal or 0x Hex Value, Optionally Negative
+		*   Returns - true if all of text was the value
+		*/
+		static bool ParseValue( const std::string& text, long long& value );
+};
+
+#endif
@@ -1,9 +1,13 @@
 #include "ControllerStatusMonitorThread.h"
 #include "OrientalControllerTemplate.h"
+#include "ControllerLog.h"
+#include "ControllerTrace.h"
+#include "AlternativeUtils.h"
 
 int ControllerStatusMonitorThread::svc() {
 
 	assert( minTickIntervalMS_ > 0 );
+	ControllerLogScope logScope( logSink_ );
 
 	int errCode;
 
@@ -13,12 +17,11 @@ int ControllerStatusMonitorThread::svc() {
 	while( GetStopCondition() == false )
 	{
 		//Note, Sleep Resolution is 1 ms min (Windows), so that will be predominant most of the time
-		CDeviceUtils::SleepMs( minTickIntervalMS_ );
+		CAlternativeUtils::SleepMs( minTickIntervalMS_ );
+		TraceSpan tickSpan( "Monitor Tick", g_TraceCategoryMonitor, "controllers", getCurrentListSize() );
 		for( int i = 0; i < getCurrentListSize(); i++ )
 		{
 
-			std::ostringstream es;
-
 			//Destructor ends at each iteration: prioritizes controller Addition
 			MMThreadGuard guard( mutex_ );
 			cont = monitorList_[i].first;
@@ -27,19 +30,17 @@ int ControllerStatusMonitorThread::svc() {
 			cont->IncCurrentMonitorTime( (minTickIntervalMS_*1000)/stepPeriodUS );
 			if( cont->IsPastMonitorTimeInc() )
 			{
-				core_.LogMessage( &device_, "The PastMonitorTime Triggered" , false );
+				ORIENTAL_LOG_TRACE( "Monitor Time Elapsed, Checking Busy" );
 				if( ( errCode = cont->IsMotorBusy() ) == 0 )
 				{
 					errCode = cont->PermitBusyDependentProcesses();
-					es << "PermitPosWrite Errcode =  " << errCode << "\n";
 					cont->restartTimeMonitor();
 					monitorList_.erase( monitorList_.begin() + i );
-					core_.LogMessage( &device_, es.str().c_str(), false );
+					ORIENTAL_LOG_DEBUG( "Motor Idle, Busy Dependent Processes Returned {}", errCode );
 				}
 				else 
 				{
-					es << "This is The errCode from Motor Busy() " << errCode;
-					core_.LogMessage( &device_, es.str().c_str(), false );
+					ORIENTAL_LOG_TRACE( "Motor Busy Check Returned {}", errCode );
 				}
 			}
 		}
@@ -88,7 +89,7 @@ int ControllerStatusMonitorThread::removeController( AbstractControllerInterface
 		if( monitorList_[i].first == controller )
 		{
 			monitorList_.erase( monitorList_.begin() + i );
-			core_.LogMessage( &device_, "We Removed a Controller", false);
+			ORIENTAL_LOG_DEBUG( "Removed a Controller From the Monitor" );
 			return 0;
 		}
 	}
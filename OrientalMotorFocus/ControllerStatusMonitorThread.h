@@ -1,14 +1,13 @@
 #ifndef _CONTROLLER_STATUS_MONITOR_THREAD
 #define _CONTROLLER_STATUS_MONITOR_THREAD
 
-#include "../../MMDevice/MMDevice.h"
-#include "../../MMDevice/DeviceBase.h"
-#include "../../MMDevice/DeviceThreads.h"
+#include "OrientalCoreDefs.h"
 #include <vector>
 #include <assert.h>
 
 //Forward Declaration of AbstractControllerInterface
 class AbstractControllerInterface;
+class ControllerLogSink;
 
 /*  MonitoringThread For Any Given Hub Instance That Uses A Controller-Motor Interface Similar to OrientalMotorHub
 *     Asynchronously checks (via controller protocol) to see if it's busy and updates the given register or boolean
@@ -18,12 +17,13 @@ class AbstractControllerInterface;
 class ControllerStatusMonitorThread: public MMDeviceThreadBase
 {
    public:
-	   ControllerStatusMonitorThread( MM::Device& device, MM::Core& core, long minTickIntervalMS = 1 ): 
+	   /* @param logSink - sink the thread's controller logging goes to (its hub's), or nullptr
+	   */
+	   ControllerStatusMonitorThread( long minTickIntervalMS = 1, ControllerLogSink* logSink = nullptr ): 
 			stop_(false),
-			core_(core),
-			device_(device),
 			minTickIntervalMS_(minTickIntervalMS),
-			listSize_(0)
+			listSize_(0),
+			logSink_(logSink)
 			{ } 
 	  ~ControllerStatusMonitorThread() {  }; 
       
@@ -68,11 +68,10 @@ class ControllerStatusMonitorThread: public MMDeviceThreadBase
 	  //Used to Lock The Thread From Changing it's Value in svc
 	  MMThreadLock mutex_;
 	  MMThreadLock stopLock_;
-      MM::Core& core_;
-	  MM::Device& device_;
       bool stop_;
 	  int listSize_;
       const long minTickIntervalMS_;
+	  ControllerLogSink* const logSink_;
 	  //Monitor List Consists of The Interface and the Step Speed at Which it was Registered
 	  std::vector< std::pair< AbstractControllerInterface*, long> > monitorList_;
 
@@ -0,0 +1,159 @@
+#include "ControllerTrace.h"
+#include "AlternativeUtils.h"
+#include <stdio.h>
+#include <new>
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+ControllerTrace::ControllerTrace() :
+	enabled_(false),
+	generation_(0),
+	next_(0),
+	dropped_(0),
+	events_(nullptr)
+{ }
+
+//Spans Must Not Outlive the Trace (Scopes Using its Sink Are Closed First)
+ControllerTrace::~ControllerTrace()
+{
+	enabled_ = false;
+	delete [] events_;
+}
+
+/* Start a New Recording (Discards the Previous One)
+*   Note:  Slots are not cleared; bumping the generation is what hides the previous recording
+*   Returns - 0 if started, otherwise non-zero (buffer could not be allocated)
+*/
+int ControllerTrace::Start( void )
+{
+	enabled_ = false;
+
+	if( events_ == nullptr )
+	{
+		events_ = new (std::nothrow) TraceEvent[ capacity_ ];
+		if( events_ == nullptr )
+		{
+			return 1;
+		}
+		for( size_t i = 0; i < capacity_; i++ )
+		{
+			events_[i].generation = 0;
+		}
+	}
+
+	next_ = 0;
+	dropped_ = 0;
+	generation_.fetch_add( 1, boost::memory_order_release );
+	enabled_ = true;
+
+	return 0;
+}
+
+void ControllerTrace::Stop( void )
+{
+	enabled_ = false;
+}
+
+unsigned long ControllerTrace::GetEventCount( void ) const
+{
+	unsigned long claimed = next_.load( boost::memory_order_relaxed );
+	return ( claimed > capacity_ ) ? static_cast< unsigned long >( capacity_ ) : claimed;
+}
+
+/* Store a Finished Span
+*   Note:  One fetch_add claims the slot; spans from an older generation or past the end of the buffer are dropped
+*/
+void ControllerTrace::Record( const char* name, const char* category, const char* argName, long argValue, double startUs, double endUs, uint32_t generation )
+{
+	if( generation != generation_.load( boost::memory_order_acquire ) )
+	{
+		return;
+	}
+
+	unsigned long slot = next_.fetch_add( 1, boost::memory_order_relaxed );
+	if( slot >= capacity_ )
+	{
+		dropped_.fetch_add( 1, boost::memory_order_relaxed );
+		return;
+	}
+
+	TraceEvent& ev = events_[ slot ];
+	ev.name = name;
+	ev.category = category;
+	ev.argName = argName;
+	ev.argValue = argValue;
+	ev.startUs = startUs;
+	ev.durationUs = endUs - startUs;
+	ev.threadId = CurrentThreadId();
+
+	//Publish Last, Export Only Reads Slots Carrying the Current Generation
+	boost::atomic_thread_fence( boost::memory_order_release );
+	ev.generation = generation;
+}
+
+/* Write the Current Recording as Chrome Trace Event JSON
+*   Note:  May be called while recording; spans still open are not included
+*   @param path - file to create (overwritten if present)
+*   Returns - 0 if written, otherwise non-zero
+*/
+int ControllerTrace::ExportChromeJson( const std::string& path ) const
+{
+	if( path.empty() )
+	{
+		return 1;
+	}
+
+	FILE* file = fopen( path.c_str(), "w" );
+	if( file == nullptr )
+	{
+		return 1;
+	}
+
+	uint32_t generation = GetGeneration();
+	unsigned long count = GetEventCount();
+	bool first = true;
+
+	fprintf( file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" );
+
+	for( unsigned long i = 0; events_ != nullptr && i < count; i++ )
+	{
+		const TraceEvent& ev = events_[i];
+		if( ev.generation != generation )
+		{
+			continue;
+		}
+		boost::atomic_thread_fence( boost::memory_order_acquire );
+
+		fprintf( file, "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%lu",
+					( first ) ? "" : ",", ev.name, ev.category, ev.startUs, ev.durationUs, ev.threadId );
+		if( ev.argName != nullptr )
+		{
+			fprintf( file, ",\"args\":{\"%s\":%ld}", ev.argName, ev.argValue );
+		}
+		fprintf( file, "}" );
+		first = false;
+	}
+
+	fprintf( file, "\n],\"otherData\":{\"droppedEvents\":%lu}}\n", GetDroppedCount() );
+
+	int ret = ( ferror( file ) != 0 ) ? 1 : 0;
+	fclose( file );
+	return ret;
+}
+
+double ControllerTrace::NowUs( void )
+{
+	return CAlternativeUtils::GetMonotonicTimeMs() * 1000;
+}
+
+unsigned long ControllerTrace::CurrentThreadId( void )
+{
+#ifdef WIN32
+	return static_cast< unsigned long >( GetCurrentThreadId() );
+#else
+	return (unsigned long) pthread_self();
+#endif
+}
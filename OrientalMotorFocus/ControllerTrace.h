@@ -0,0 +1,135 @@
+#ifndef _CONTROLLER_TRACE_
+#define _CONTROLLER_TRACE_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <boost/atomic.hpp>
+#include "ControllerLog.h"
+
+/*
+*  In-Memory Span Tracing Exported to the Chrome Trace Event Format (chrome://tracing, Perfetto)
+*     Spans Are Claimed From a Preallocated Buffer With One Atomic Increment, Nothing is Formatted Until Export
+*     When Tracing is Off a Span Costs a Thread-Local Load and One Relaxed Load; Once the Buffer is Full Further Spans Are Counted and Dropped
+*
+*  Usage:  TraceSpan span( "Write", g_TraceCategoryBus );   //Recorded When span Leaves Scope or at span.End()
+*     Names, Categories and Argument Names Must Be String Literals (Only the Pointers Are Kept)
+*
+*  Several Hubs:  Each Owns a ControllerTrace and Sets it on its Log Sink, a Span Records Into the Trace of the
+*     ControllerLogScope Open on its Thread (Spans Outside Any Scope Are Not Recorded)
+*/
+
+//Categories Used by the Adapter
+const char* const g_TraceCategoryMotion = "motion";
+const char* const g_TraceCategoryBus = "bus";
+const char* const g_TraceCategoryMonitor = "monitor";
+
+//One Completed Span ("X" Event)
+struct TraceEvent
+{
+	const char* name;
+	const char* category;
+	const char* argName;		//nullptr For No Argument
+	long argValue;
+	double startUs;
+	double durationUs;
+	unsigned long threadId;
+	uint32_t generation;		//Recording the Span Belongs To (Written Last)
+};
+
+/*  One Hub's Trace Buffer
+*/
+class ControllerTrace
+{
+	public:
+		//Events Kept Per Recording (Allocated on the First Start())
+		static const size_t capacity_ = 65536;
+
+		ControllerTrace();
+		~ControllerTrace();
+
+		bool IsEnabled( void ) const { return enabled_.load( boost::memory_order_relaxed ); }
+
+		/* Start a New Recording (Discards the Previous One)
+		*   Returns - 0 if started, otherwise non-zero (buffer could not be allocated)
+		*/
+		int Start( void );
+		//Stop Recording, Events Stay in the Buffer For Export
+		void Stop( void );
+
+		unsigned long GetEventCount( void ) const;
+		unsigned long GetDroppedCount( void ) const { return dropped_.load( boost::memory_order_relaxed ); }
+
+		/* Write the Current Recording as Chrome Trace Event JSON
+		*   Note:  May be called while recording; spans still open are not included
+		*   @param path - file to create (overwritten if present)
+		*   Returns - 0 if written, otherwise non-zero
+		*/
+		int ExportChromeJson( const std::string& path ) const;
+
+		//Current Generation, Spans Opened Under an Older One Are Discarded
+		uint32_t GetGeneration( void ) const { return generation_.load( boost::memory_order_acquire ); }
+
+		//Store a Finished Span, Use Through TraceSpan
+		void Record( const char* name, const char* category, const char* argName, long argValue, double startUs, double endUs, uint32_t generation );
+
+		//Monotonic Microseconds (Same Clock as CAlternativeUtils::GetMonotonicTimeMs())
+		static double NowUs( void );
+		static unsigned long CurrentThreadId( void );
+
+	private:
+		boost::atomic<bool> enabled_;
+		boost::atomic<uint32_t> generation_;
+		boost::atomic<unsigned long> next_;
+		boost::atomic<unsigned long> dropped_;
+		TraceEvent* events_;
+
+		ControllerTrace( const ControllerTrace& );
+		ControllerTrace& operator=( const ControllerTrace& );
+};
+
+/*  RAII Span:  Timestamps at Construction, Records at End() or Destruction Into the Trace of the Thread's ControllerLogScope
+*/
+class TraceSpan
+{
+	public:
+		TraceSpan( const char* name, const char* category ) : name_(name), category_(category), argName_(nullptr), argValue_(0) { Begin(); }
+		TraceSpan( const char* name, const char* category, const char* argName, long argValue ) : name_(name), category_(category), argName_(argName), argValue_(argValue) { Begin(); }
+		~TraceSpan() { End(); }
+
+		//Close the Span Early (Later Calls and the Destructor Do Nothing)
+		void End( void )
+		{
+			if( startUs_ >= 0 )
+			{
+				trace_->Record( name_, category_, argName_, argValue_, startUs_, ControllerTrace::NowUs(), generation_ );
+				startUs_ = -1;
+			}
+		}
+
+	private:
+		void Begin( void )
+		{
+			startUs_ = -1;
+			ControllerLogSink* sink = ControllerLog::GetThreadChannel();
+			trace_ = ( sink != nullptr ) ? sink->GetTrace() : nullptr;
+			if( trace_ != nullptr && trace_->IsEnabled() )
+			{
+				generation_ = trace_->GetGeneration();
+				startUs_ = ControllerTrace::NowUs();
+			}
+		}
+
+		ControllerTrace* trace_;
+		const char* name_;
+		const char* category_;
+		const char* argName_;
+		long argValue_;
+		double startUs_;
+		uint32_t generation_;
+
+		TraceSpan( const TraceSpan& );
+		TraceSpan& operator=( const TraceSpan& );
+};
+
+#endif
@@ -0,0 +1,66 @@
+#include "FTDIConnectionManager.h"
+#include <string.h>
+
+/* Make device the Open Device
+*   Note:  Returns immediately if device's serial number is already open
+*   Returns - 0 if device is open, otherwise the last FT_STATUS of the open attempts (nothing is open then)
+*/
+int FTDIConnectionManager::Select( const FT_DEVICE_LIST_INFO_NODE& device )
+{
+	if( handle_ != 0 && strncmp( device_.SerialNumber, device.SerialNumber, sizeof( device_.SerialNumber ) ) == 0 )
+	{
+		return 0;
+	}
+
+	//Close Previous Connection (Without Notifying, the Listener Hears the Outcome Below)
+	if( handle_ != 0 )
+	{
+		FT_Close( handle_ );
+		handle_ = 0;
+	}
+
+	//FT_OpenEx() Does Not Modify the Serial Number, the Copy Only Satisfies its Signature
+	char serialNum[ sizeof( device.SerialNumber ) ];
+	memcpy( serialNum, device.SerialNumber, sizeof( serialNum ) );
+
+	FT_STATUS ret = FT_OTHER_ERROR;
+	for( int i = 0; i < maxConnRetries_; i++ )
+	{
+		FT_HANDLE handle = 0;
+		ret = FT_OpenEx( serialNum, FT_OPEN_BY_SERIAL_NUMBER, &handle );
+		if( ret == FT_OK )
+		{
+			handle_ = handle;
+			device_ = device;
+			device_.ftHandle = handle;
+			openCount_++;
+			break;
+		}
+	}
+
+	if( listener_ != nullptr )
+	{
+		listener_->OnFTDIConnectionChanged( handle_, GetDevice() );
+	}
+
+	return ( ret == FT_OK ) ? 0 : static_cast< int >( ret );
+}
+
+/* Close the Open Device (if Any)
+*   @param notify - false skips the listener (shutdown, where it must not call back into the core)
+*/
+void FTDIConnectionManager::Close( bool notify )
+{
+	if( handle_ == 0 )
+	{
+		return;
+	}
+
+	FT_Close( handle_ );
+	handle_ = 0;
+
+	if( notify && listener_ != nullptr )
+	{
+		listener_->OnFTDIConnectionChanged( 0, nullptr );
+	}
+}
@@ -0,0 +1,71 @@
+#ifndef _FTDI_CONNECTION_MANAGER_
+#define _FTDI_CONNECTION_MANAGER_
+
+#include "ftd2xx.h"
+#include <assert.h>
+
+/*  Told When the Open FTDI Device Changes (a Different Serial Number Was Opened, or the Device Was Closed)
+*/
+class FTDIConnectionListener
+{
+	public:
+		virtual ~FTDIConnectionListener() {}
+
+		/* @param handle - newly opened handle, or 0 when nothing is open
+		*  @param device - info of the opened device (valid until the next change), or nullptr when nothing is open
+		*/
+		virtual void OnFTDIConnectionChanged( FT_HANDLE handle, const FT_DEVICE_LIST_INFO_NODE* device ) = 0;
+};
+
+/*
+*  The One Open Handle of a Hub
+*     Selecting the Serial Number That is Already Open Does Nothing, so Property Refreshes Never Touch the Device
+*     Only a Different Serial Number Closes and Reopens (With Retries, in Case the Device is Still Enumerating)
+*     Note:  Not Locked Itself; the Hub Calls it While Holding its Serial Line Lock, so No Transaction Sees the Handle Change
+*/
+class FTDIConnectionManager
+{
+	public:
+		FTDIConnectionManager( int maxConnRetries ) :
+			handle_(0),
+			maxConnRetries_( ( maxConnRetries < 1 ) ? 1 : maxConnRetries ),
+			listener_(nullptr),
+			openCount_(0)
+			{ }
+		//Closes Without Notifying (the Listener May Already be Gone)
+		~FTDIConnectionManager() { Close( false ); }
+
+		void SetListener( FTDIConnectionListener* listener ) { listener_ = listener; }
+
+		/* Make device the Open Device
+		*   Note:  Returns immediately if device's serial number is already open
+		*   Returns - 0 if device is open, otherwise the last FT_STATUS of the open attempts (nothing is open then)
+		*/
+		int Select( const FT_DEVICE_LIST_INFO_NODE& device );
+
+		/* Close the Open Device (if Any)
+		*   @param notify - false skips the listener (shutdown, where it must not call back into the core)
+		*/
+		void Close( bool notify = true );
+
+		bool IsOpen( void ) const { return handle_ != 0; }
+		FT_HANDLE GetHandle( void ) const { return handle_; }
+
+		//Cached Info of the Open Device, or nullptr
+		const FT_DEVICE_LIST_INFO_NODE* GetDevice( void ) const { return ( handle_ != 0 ) ? &device_ : nullptr; }
+
+		//FT_OpenEx() Calls That Succeeded (Each is a Reopen of the USB Device)
+		unsigned long GetOpenCount( void ) const { return openCount_; }
+
+	private:
+		FT_HANDLE handle_;
+		FT_DEVICE_LIST_INFO_NODE device_;
+		const int maxConnRetries_;
+		FTDIConnectionListener* listener_;
+		unsigned long openCount_;
+
+		FTDIConnectionManager( const FTDIConnectionManager& );
+		FTDIConnectionManager& operator=( const FTDIConnectionManager& );
+};
+
+#endif
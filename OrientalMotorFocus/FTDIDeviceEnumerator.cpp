@@ -0,0 +1,235 @@
+#include "FTDIDeviceEnumerator.h"
+#include "AlternativeUtils.h"
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+int FTDIEnumerationThread::svc( void )
+{
+	enumerator_.Scan();
+	return 0;
+}
+
+FTDIDeviceEnumerator::FTDIDeviceEnumerator( void ) :
+	thread_(nullptr),
+	scanning_(false),
+	generation_(0)
+{ }
+
+FTDIDeviceEnumerator::~FTDIDeviceEnumerator()
+{
+	if( thread_ != nullptr )
+	{
+		thread_->wait();
+		delete thread_;
+	}
+}
+
+/* Read Persisted COM Ports ("<serial number> <com port>" Per Line)
+*   Note:  A missing file is an empty cache, it is created by the first scan that resolves a port
+*   Returns - number of cached ports read
+*/
+int FTDIDeviceEnumerator::LoadCache( const std::string& path )
+{
+	MMThreadGuard guard( lock_ );
+	cachePath_ = path;
+
+	if( path.empty() )
+	{
+		return 0;
+	}
+
+	FILE* file = fopen( path.c_str(), "r" );
+	if( file == nullptr )
+	{
+		return 0;
+	}
+
+	int numRead = 0;
+	char serial[ sizeof( ((FT_DEVICE_LIST_INFO_NODE*)0)->SerialNumber ) ];
+	long comPort;
+	while( fscanf( file, "%15s %ld", serial, &comPort ) == 2 )
+	{
+		comPortCache_[ serial ] = comPort;
+		numRead++;
+	}
+
+	fclose( file );
+	return numRead;
+}
+
+/* Start a Scan on the Background Thread
+*   Returns - 0 if started, or 1 if a scan is already running
+*/
+int FTDIDeviceEnumerator::StartScan( void )
+{
+	bool expected = false;
+	if( scanning_.compare_exchange_strong( expected, true ) == false )
+	{
+		return 1;
+	}
+
+	//The Previous Scan Has Finished (scanning_ Was Clear), so its Thread Only Needs Joining
+	if( thread_ != nullptr )
+	{
+		thread_->wait();
+		delete thread_;
+	}
+
+	thread_ = new FTDIEnumerationThread( *this );
+	thread_->activate();
+
+	return 0;
+}
+
+/* Wait For the Running Scan
+*   Returns - true if no scan is running any more
+*/
+bool FTDIDeviceEnumerator::WaitForScan( long timeoutMS )
+{
+	double endMs = CAlternativeUtils::GetMonotonicTimeMs() + timeoutMS;
+
+	while( scanning_ )
+	{
+		if( CAlternativeUtils::GetMonotonicTimeMs() >= endMs )
+		{
+			return false;
+		}
+		CAlternativeUtils::SleepMs( 1 );
+	}
+
+	return true;
+}
+
+/* Copy of the Devices Found by the Last Scan
+*   Returns - generation of the copy (See GetGeneration())
+*/
+unsigned long FTDIDeviceEnumerator::GetDevices( std::map< std::string, FTDIDeviceEntry >& devices )
+{
+	MMThreadGuard guard( lock_ );
+	devices = devices_;
+	return generation_.load( boost::memory_order_acquire );
+}
+
+/* One Scan:  List, Drop Removed Devices, Name New Ones From the Cache or by Opening Them
+*   Note:  Devices opened elsewhere (including by a hub of this adapter) can only be listed if their port is already known
+*/
+void FTDIDeviceEnumerator::Scan( void )
+{
+	DWORD numDevices = 0;
+	std::vector< FT_DEVICE_LIST_INFO_NODE > listed;
+
+	if( FT_CreateDeviceInfoList( &numDevices ) == FT_OK && numDevices > 0 )
+	{
+		listed.resize( numDevices );
+		if( FT_GetDeviceInfoList( &listed[0], &numDevices ) != FT_OK )
+		{
+			numDevices = 0;
+		}
+		listed.resize( numDevices );
+	}
+
+	std::map< std::string, FTDIDeviceEntry > known;
+	std::map< std::string, long > cache;
+	{
+		MMThreadGuard guard( lock_ );
+		known = devices_;
+		cache = comPortCache_;
+	}
+
+	std::map< std::string, FTDIDeviceEntry > found;
+	bool resolvedNew = false;
+
+	for( size_t i = 0; i < listed.size(); i++ )
+	{
+		std::string serial( listed[i].SerialNumber, strnlen( listed[i].SerialNumber, sizeof( listed[i].SerialNumber ) ) );
+		if( serial.empty() )
+		{
+			continue;
+		}
+
+		FTDIDeviceEntry entry;
+		entry.info = listed[i];
+
+		std::map< std::string, FTDIDeviceEntry >::iterator knownIt = known.find( serial );
+		std::map< std::string, long >::iterator cacheIt = cache.find( serial );
+		if( knownIt != known.end() )
+		{
+			entry.comPort = knownIt->second.comPort;
+		}
+		else if( cacheIt != cache.end() )
+		{
+			entry.comPort = cacheIt->second;
+		}
+		else if( ( listed[i].Flags & 1 ) == 0 )
+		{
+			//New and Not Opened Elsewhere:  the Only Case That Opens the Device
+			FT_HANDLE handle;
+			if( FT_OpenEx( listed[i].SerialNumber, FT_OPEN_BY_SERIAL_NUMBER, &handle ) != FT_OK )
+			{
+				//Softly Discarded Until the Next Scan
+				continue;
+			}
+			entry.comPort = -1;
+			FT_GetComPortNumber( handle, &entry.comPort );
+			FT_Close( handle );
+
+			cache[ serial ] = entry.comPort;
+			resolvedNew = true;
+		}
+		else
+		{
+			continue;
+		}
+
+		found[ serial ] = entry;
+	}
+
+	bool changed = ( found.size() != known.size() );
+	for( std::map< std::string, FTDIDeviceEntry >::iterator it = found.begin(); changed == false && it != found.end(); ++it )
+	{
+		std::map< std::string, FTDIDeviceEntry >::iterator knownIt = known.find( it->first );
+		changed = ( knownIt == known.end() || knownIt->second.comPort != it->second.comPort );
+	}
+
+	{
+		MMThreadGuard guard( lock_ );
+		devices_ = found;
+		comPortCache_ = cache;
+		if( changed )
+		{
+			generation_.fetch_add( 1, boost::memory_order_release );
+		}
+	}
+
+	if( resolvedNew )
+	{
+		SaveCache();
+	}
+
+	scanning_ = false;
+}
+
+//Rewrite the Cache File With Every Known Port
+void FTDIDeviceEnumerator::SaveCache( void )
+{
+	MMThreadGuard guard( lock_ );
+
+	if( cachePath_.empty() )
+	{
+		return;
+	}
+
+	FILE* file = fopen( cachePath_.c_str(), "w" );
+	if( file == nullptr )
+	{
+		return;
+	}
+
+	for( std::map< std::string, long >::iterator it = comPortCache_.begin(); it != comPortCache_.end(); ++it )
+	{
+		fprintf( file, "%s %ld\n", it->first.c_str(), it->second );
+	}
+
+	fclose( file );
+}
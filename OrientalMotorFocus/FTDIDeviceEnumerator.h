@@ -0,0 +1,97 @@
+#ifndef _FTDI_DEVICE_ENUMERATOR_
+#define _FTDI_DEVICE_ENUMERATOR_
+
+#include "../../MMDevice/DeviceThreads.h"
+#include "ftd2xx.h"
+#include <string>
+#include <map>
+#include <boost/atomic.hpp>
+
+class FTDIDeviceEnumerator;
+
+/*  Known FTDI Device:  Listing Info and COM Port (Opening the Device is the Only Way D2XX Reports the Port)
+*/
+struct FTDIDeviceEntry
+{
+	FT_DEVICE_LIST_INFO_NODE info;
+	long comPort;
+};
+
+/*  Scan Thread of an FTDIDeviceEnumerator
+*/
+class FTDIEnumerationThread : public MMDeviceThreadBase
+{
+	public:
+		FTDIEnumerationThread( FTDIDeviceEnumerator& enumerator ) : enumerator_(enumerator) {}
+
+		int svc( void );
+		int open (void*) { return 0;}
+		int close(unsigned long) {return 0;}
+
+	private:
+		FTDIDeviceEnumerator& enumerator_;
+
+		FTDIEnumerationThread& operator=( const FTDIEnumerationThread& );
+};
+
+/*
+*  Cached FTDI Device Enumeration, Keyed by Serial Number
+*     A Scan Lists the Devices (Cheap), Drops Removed Ones and Only Opens New Serial Numbers Whose COM Port is Not Cached
+*     COM Ports Are Persisted Between Runs, so a Known Device is Never Opened Just to Name it
+*     Scans Run on a Background Thread; Callers Wait as Long as They Can Afford and Pick Up Late Results by GetGeneration()
+*     Note:  D2XX Cannot Cancel an FT_OpenEx(), so the Time Bound is on the Waiting Caller, Not on the Open Itself
+*/
+class FTDIDeviceEnumerator
+{
+	public:
+		FTDIDeviceEnumerator( void );
+		~FTDIDeviceEnumerator();
+
+		/* Read Persisted COM Ports ("<serial number> <com port>" Per Line)
+		*   @param path - cache file, rewritten after every scan that resolved a port ("" disables persistence)
+		*   Returns - number of cached ports read
+		*/
+		int LoadCache( const std::string& path );
+
+		/* Start a Scan on the Background Thread
+		*   Returns - 0 if started, or 1 if a scan is already running
+		*/
+		int StartScan( void );
+
+		/* Wait For the Running Scan
+		*   @param timeoutMS - longest wait
+		*   Returns - true if no scan is running any more
+		*/
+		bool WaitForScan( long timeoutMS );
+
+		/* Copy of the Devices Found by the Last Scan
+		*   @param devices - filled with entries keyed by serial number
+		*   Returns - generation of the copy (See GetGeneration())
+		*/
+		unsigned long GetDevices( std::map< std::string, FTDIDeviceEntry >& devices );
+
+		//Incremented Whenever a Scan Changed the Device List
+		unsigned long GetGeneration( void ) const { return generation_.load( boost::memory_order_acquire ); }
+
+	private:
+		friend class FTDIEnumerationThread;
+
+		//One Scan (Enumeration Thread)
+		void Scan( void );
+		void SaveCache( void );
+
+		//Protects devices_ and comPortCache_, Never Held While Opening a Device
+		MMThreadLock lock_;
+		std::map< std::string, FTDIDeviceEntry > devices_;
+		std::map< std::string, long > comPortCache_;
+		std::string cachePath_;
+
+		FTDIEnumerationThread* thread_;
+		boost::atomic<bool> scanning_;
+		boost::atomic<unsigned long> generation_;
+
+		FTDIDeviceEnumerator( const FTDIDeviceEnumerator& );
+		FTDIDeviceEnumerator& operator=( const FTDIDeviceEnumerator& );
+};
+
+#endif
@@ -0,0 +1,45 @@
+#include "FTDISerialTransport.h"
+
+/******************************************
+
+ FTDISerialTransport
+
+ *******************************************/
+
+int FTDISerialTransport::Configure( unsigned long baudRate )
+{
+	FT_STATUS status;
+
+	if( ( status = FT_SetBaudRate( handle_, baudRate ) ) != FT_OK )
+	{
+		return static_cast< int >( status );
+	}
+
+	if( ( status = FT_SetDataCharacteristics( handle_, FT_BITS_8, FT_STOP_BITS_1, FT_PARITY_EVEN ) ) != FT_OK )
+	{
+		return static_cast< int >( status );
+	}
+
+	return static_cast< int >( FT_SetTimeouts( handle_, readTimeoutMS_, 0 ) );
+}
+
+int FTDISerialTransport::Write( const unsigned char buffer[], unsigned long len, unsigned long& bytesWritten )
+{
+	DWORD written = 0;
+	FT_STATUS status = FT_Write( handle_, const_cast< unsigned char* >( buffer ), len, &written );
+	bytesWritten = written;
+	return static_cast< int >( status );
+}
+
+int FTDISerialTransport::Read( unsigned char buffer[], unsigned long len, unsigned long& bytesRead )
+{
+	DWORD read = 0;
+	FT_STATUS status = FT_Read( handle_, buffer, len, &read );
+	bytesRead = read;
+	return static_cast< int >( status );
+}
+
+int FTDISerialTransport::Purge( void )
+{
+	return static_cast< int >( FT_Purge( handle_, FT_PURGE_RX | FT_PURGE_TX ) );
+}
@@ -0,0 +1,29 @@
+#ifndef _FTDI_SERIAL_TRANSPORT_
+#define _FTDI_SERIAL_TRANSPORT_
+
+#include "SerialTransport.h"
+#include "ftd2xx.h"
+
+/*  Live Transport Through an Opened FTDI Device
+*     The Hub Owns the Handle, and Passes Every Change Through SetHandle()
+*/
+class FTDISerialTransport : public SerialTransport
+{
+	public:
+		//Longest a Read() Waits For its Bytes:  Far Past Any Answer at 9600 Baud, Short Enough That a Retried Request Stays Within SerialControllerBus::maxRetryWindowMS_
+		static const unsigned long readTimeoutMS_ = 500;
+
+		FTDISerialTransport() : handle_(0) {}
+
+		void SetHandle( FT_HANDLE handle ) { handle_ = handle; }
+
+		int Configure( unsigned long baudRate );
+		int Write( const unsigned char buffer[], unsigned long len, unsigned long& bytesWritten );
+		int Read( unsigned char buffer[], unsigned long len, unsigned long& bytesRead );
+		int Purge( void );
+
+	private:
+		FT_HANDLE handle_;
+};
+
+#endif
@@ -0,0 +1,81 @@
+#include "MotionPlanner.h"
+#include <math.h>
+
+/* Plan a Move
+*   Note:  numDecelCandidates_ closed form evaluations, cheap enough for every OnPosition()
+*   Returns - 0, or non-zero if there is nothing to plan
+*/
+int MotionPlanner::Plan( long steps, double stepAngleDeg, double travelUmPerRev, MotionPlan& plan ) const
+{
+
+	double distance = fabs( static_cast< double >( steps ) );
+	if( distance == 0 || stepAngleDeg <= 0 || travelUmPerRev <= 0 || config_.maxSpeedRevPerS <= 0 || config_.maxAccelRevPerS2 <= 0 )
+	{
+		return 1;
+	}
+
+	double stepsPerRev = 360 / stepAngleDeg;
+	double maxSpeedHz = config_.maxSpeedRevPerS * stepsPerRev;
+	double accelHzPerS = config_.maxAccelRevPerS2 * stepsPerRev;
+	double startHz = ( config_.startSpeedHz < maxSpeedHz ) ? config_.startSpeedHz : maxSpeedHz;
+	double ratio = pow( 1.0 / decelRange_, 1.0 / ( numDecelCandidates_ - 1 ) );
+	double bestMs = -1;
+
+	for( int i = 0; i < numDecelCandidates_; i++ )
+	{
+		double decelHzPerS = accelHzPerS * pow( ratio, i );
+		double peakHz;
+		double moveMs = 1000 * MoveTimeS( distance, startHz, maxSpeedHz, accelHzPerS, decelHzPerS, peakHz );
+		double settleMs = SettleMs( decelHzPerS / stepsPerRev, travelUmPerRev );
+
+		//Ties Keep the Harder Stop (Less Time at Low Speed)
+		if( bestMs < 0 || moveMs + settleMs < bestMs )
+		{
+			bestMs = moveMs + settleMs;
+			plan.speedHz = peakHz;
+			plan.accelHzPerS = accelHzPerS;
+			plan.decelHzPerS = decelHzPerS;
+			plan.moveMs = moveMs;
+			plan.settleMs = settleMs;
+		}
+	}
+
+	return 0;
+}
+
+/* Travel Time of a Trapezoidal (or Triangular, if speedHz is Not Reached) Move
+*   Note:  The move starts and ends at startHz, as the controller's start speed does
+*   Returns - seconds
+*/
+double MotionPlanner::MoveTimeS( double steps, double startHz, double speedHz, double accelHzPerS, double decelHzPerS, double& peakHz )
+{
+
+	//Peak Where the Acceleration and Deceleration Ramps Meet:  steps = ( peak^2 - start^2 ) ( 1/2a + 1/2d )
+	peakHz = sqrt( startHz * startHz + 2 * steps * accelHzPerS * decelHzPerS / ( accelHzPerS + decelHzPerS ) );
+	double cruiseSteps = 0;
+
+	if( peakHz > speedHz )
+	{
+		peakHz = speedHz;
+		cruiseSteps = steps - ( speedHz * speedHz - startHz * startHz ) * ( 1 / ( 2 * accelHzPerS ) + 1 / ( 2 * decelHzPerS ) );
+	}
+
+	return ( peakHz - startHz ) / accelHzPerS + ( peakHz - startHz ) / decelHzPerS + cruiseSteps / peakHz;
+}
+
+/* Settle Time After Stopping at a Deceleration
+*   Note:  Exponential decay of the ringing, so the time grows with the log of how far it starts over the tolerance
+*   Returns - milliseconds
+*/
+double MotionPlanner::SettleMs( double decelRevPerS2, double travelUmPerRev ) const
+{
+
+	double ringingUm = config_.ringingRevPerRevPerS2 * decelRevPerS2 * travelUmPerRev;
+
+	if( config_.settleToleranceUm <= 0 || ringingUm <= config_.settleToleranceUm )
+	{
+		return 0;
+	}
+
+	return config_.settleTimeConstantMs * log( ringingUm / config_.settleToleranceUm );
+}
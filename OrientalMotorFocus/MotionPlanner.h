@@ -0,0 +1,84 @@
+#ifndef _MOTION_PLANNER_
+#define _MOTION_PLANNER_
+
+/*  Speed and Rates of One Move, in Steps (Controllers Convert to Their Register Units)
+*     moveMs and settleMs Are the Planner's Predictions, Kept For Logging and Tuning
+*/
+struct MotionPlan
+{
+	double speedHz;				//Operating Speed (Steps/s)
+	double accelHzPerS;			//Steps/s^2
+	double decelHzPerS;			//Steps/s^2
+	double moveMs;
+	double settleMs;
+};
+
+/*  Limits and Settle Model of a MotionPlanner
+*     Speeds and Rates Are in Knob Revolutions, so They Hold Across Base Angle Partitions
+*     Settle Model:  Stopping at decel Leaves a Ringing of ringingRevPerRevPerS2 * decel Revolutions (Times the Knob's um/rev),
+*                    Decaying With settleTimeConstantMs Until it is Under settleToleranceUm (a Tolerance of 0 Turns the Model Off)
+*/
+struct MotionPlannerConfig
+{
+	double maxSpeedRevPerS;
+	double maxAccelRevPerS2;
+	double startSpeedHz;			//Controller Start Speed (Steps/s), Moves Begin and End There
+	double ringingRevPerRevPerS2;
+	double settleTimeConstantMs;
+	double settleToleranceUm;
+
+	//Conservative Defaults (Factory Start Speed of the CRK Series)
+	MotionPlannerConfig( void ) :
+		maxSpeedRevPerS(10),
+		maxAccelRevPerS2(50),
+		startSpeedHz(100),
+		ringingRevPerRevPerS2(0.0001),
+		settleTimeConstantMs(10),
+		settleToleranceUm(0.05)
+	{}
+};
+
+/*
+*  Picks Speed, Acceleration and Deceleration For Each Move to Reach Target-and-Settled Soonest
+*     Acceleration is Always the Limit (the Settle Model Only Depends on How the Move Stops), Speed is the Limit or the Peak
+*     of a Triangular Move; Deceleration is Searched Over numDecelCandidates_ Steps From the Limit Down to decelRange_ Below it:
+*     Large Moves Stop Hard (Travel Time Dominates), Small Autofocus Steps Stop Gently (Ringing Dominates)
+*     Note:  Not Thread Safe, Owned and Used by One Device
+*/
+class MotionPlanner
+{
+	public:
+		static const int numDecelCandidates_ = 32;
+		//Gentlest Deceleration Tried is the Acceleration Limit Divided by This
+		static const int decelRange_ = 1000;
+
+		MotionPlanner( void ) {}
+
+		MotionPlannerConfig& GetConfig( void ) { return config_; }
+		const MotionPlannerConfig& GetConfig( void ) const { return config_; }
+
+		/* Plan a Move
+		*   @param steps - length of the move (sign is ignored)
+		*   @param stepAngleDeg - degrees per step (the controller's base angle partition)
+		*   @param travelUmPerRev - knob travel per revolution (AdjusterKnob::single_rot_travel_um_)
+		*   @param plan - filled with the fastest plan
+		*   Returns - 0, or non-zero if there is nothing to plan (0 steps) or the geometry or limits are not positive
+		*/
+		int Plan( long steps, double stepAngleDeg, double travelUmPerRev, MotionPlan& plan ) const;
+
+		/* Travel Time of a Trapezoidal (or Triangular, if speedHz is Not Reached) Move
+		*   @param peakHz - set to the highest speed reached
+		*   Returns - seconds
+		*/
+		static double MoveTimeS( double steps, double startHz, double speedHz, double accelHzPerS, double decelHzPerS, double& peakHz );
+
+		/* Settle Time After Stopping at a Deceleration (See MotionPlannerConfig)
+		*   Returns - milliseconds
+		*/
+		double SettleMs( double decelRevPerS2, double travelUmPerRev ) const;
+
+	private:
+		MotionPlannerConfig config_;
+};
+
+#endif
@@ -0,0 +1,272 @@
+#include "MotionProfileTuner.h"
+#include "MoveLatencyBenchmark.h"
+#include "OrientalMotorFocus.h"
+#include <algorithm>
+#include <cmath>
+#include <stdio.h>
+
+//Default Grid:  Rates of 100 to 3 ms/kHz, 1 to 8 kHz, Half to Full Current
+static const uint32_t g_DefaultAccelRates[] = { 100000, 30000, 10000, 3000 };
+static const uint32_t g_DefaultOperatingSpeeds[] = { 1000, 2000, 4000, 8000 };
+static const uint32_t g_DefaultOperatingCurrents[] = { 50, 75, 100 };
+//An Autofocus Step, a Z-Stack Step and a Repositioning Move
+static const double g_DefaultTunerStepSizesUm[] = { 1.0, 10.0, 50.0 };
+
+//accelRateType Value That Makes the Operation Data Rates Apply (Separate)
+static const long long g_SeparateAccelRates = 1;
+
+MotionProfileTuner::MotionProfileTuner( OrientalMotorFocus& stage, AbstractControllerInterface* controller ) :
+	stage_(stage),
+	controller_(controller),
+	accelRates_( g_DefaultAccelRates, g_DefaultAccelRates + sizeof( g_DefaultAccelRates )/sizeof( g_DefaultAccelRates[0] ) ),
+	operatingSpeeds_( g_DefaultOperatingSpeeds, g_DefaultOperatingSpeeds + sizeof( g_DefaultOperatingSpeeds )/sizeof( g_DefaultOperatingSpeeds[0] ) ),
+	operatingCurrents_( g_DefaultOperatingCurrents, g_DefaultOperatingCurrents + sizeof( g_DefaultOperatingCurrents )/sizeof( g_DefaultOperatingCurrents[0] ) ),
+	stepSizesUm_( g_DefaultTunerStepSizesUm, g_DefaultTunerStepSizesUm + sizeof( g_DefaultTunerStepSizesUm )/sizeof( g_DefaultTunerStepSizesUm[0] ) ),
+	deviationToleranceUm_(0.1),
+	repeats_(0),
+	stepOutDetection_(false),
+	encoderReadback_(false)
+{ }
+
+/* Run Every Grid Point
+*   Note:  A trial that fails is ranked unsafe and the sweep goes on; only a failed snapshot stops it before it starts
+*   Note:  A snapshot the controller would not accept back is logged and not restored
+*   Returns - 0 if the sweep ran and the settings were restored, otherwise the first error that stopped it or the restore
+*/
+int MotionProfileTuner::Run( unsigned int repeats )
+{
+	int ret;
+	results_.clear();
+	repeats_ = repeats;
+
+	MotionProfileTrial first = { 0 };
+	ControllerProfile original = TrialProfile( first );
+	original.name = "Before Tuning";
+	if( ( ret = controller_->ReadProfile( original ) ) != 0 )
+	{
+		return ret;
+	}
+
+	//Registers Never Written (on the Simulated Bus) Read Back as Values They Do Not Accept
+	std::string error;
+	bool restorable = ( controller_->ValidateProfile( original, error ) == 0 );
+	if( restorable == false )
+	{
+		ORIENTAL_LOG_WARN( "Settings Before Tuning Cannot be Restored: {}", error );
+	}
+
+	ControllerFaultState faults;
+	if( ( ret = controller_->ReadFaultState( faults ) ) != 0 )
+	{
+		return ret;
+	}
+	stepOutDetection_ = faults.stepOutDetection;
+	encoderReadback_ = controller_->GetEncoderReadback();
+	if( stepOutDetection_ == false && encoderReadback_ == false )
+	{
+		ORIENTAL_LOG_WARN( "Neither Encoder Readback Nor Step-Out Detection is On, Every Trial Will be Unverified" );
+	}
+	if( faults.alarmCode != 0 || faults.warningCode != 0 )
+	{
+		controller_->ClearFaults();
+	}
+
+	for( size_t a = 0; a < accelRates_.size(); a++ )
+	{
+		for( size_t s = 0; s < operatingSpeeds_.size(); s++ )
+		{
+			for( size_t c = 0; c < operatingCurrents_.size(); c++ )
+			{
+				MotionProfileTrial trial = { 0 };
+				trial.accelRate = accelRates_[a];
+				trial.operatingSpeed = operatingSpeeds_[s];
+				trial.operatingCurrent = operatingCurrents_[c];
+				RunTrial( trial, repeats );
+				results_.push_back( trial );
+			}
+		}
+	}
+
+	std::stable_sort( results_.begin(), results_.end(), TrialBefore );
+
+	return ( restorable ) ? controller_->ApplyProfile( original ) : 0;
+}
+
+/* Apply, Time and Check One Grid Point
+*   Note:  Faults are cleared after being recorded, so the next trial starts clean
+*   Note:  Without encoder readback the position read back is the commanded one, so the deviation is always 0
+*   Returns - 0 if the trial ran (safe or not), otherwise the error that stopped it
+*/
+int MotionProfileTuner::RunTrial( MotionProfileTrial& trial, unsigned int repeats )
+{
+	int ret;
+	double beforeUm;
+	double afterUm;
+
+	trial.safe = false;
+	trial.unverified = false;
+	if( ( ret = controller_->ApplyProfile( TrialProfile( trial ) ) ) != 0 || ( ret = stage_.GetPositionUm( beforeUm ) ) != 0 )
+	{
+		trial.failures = 1;
+		return ret;
+	}
+
+	MoveLatencyBenchmark benchmark( stage_, controller_ );
+	benchmark.SetStepSizes( stepSizesUm_ );
+	benchmark.Run( repeats );
+
+	const std::vector< MoveLatencyStats >& stats = benchmark.GetResults();
+	for( size_t i = 0; i < stats.size(); i++ )
+	{
+		trial.totalMs += stats[i].meanMs;
+		trial.moves += stats[i].samples + stats[i].failures;
+		trial.failures += stats[i].failures;
+	}
+
+	ControllerFaultState faults;
+	if( ( ret = controller_->ReadFaultState( faults ) ) != 0 )
+	{
+		trial.failures++;
+		return ret;
+	}
+	trial.alarmCode = faults.alarmCode;
+	trial.warningCode = faults.warningCode;
+	if( faults.alarmCode != 0 || faults.warningCode != 0 )
+	{
+		controller_->ClearFaults();
+	}
+
+	if( ( ret = stage_.GetPositionUm( afterUm ) ) != 0 )
+	{
+		trial.failures++;
+		return ret;
+	}
+	trial.deviationUm = afterUm - beforeUm;
+
+	bool clean = ( trial.failures == 0 && trial.alarmCode == 0 && trial.warningCode == 0 && std::fabs( trial.deviationUm ) <= deviationToleranceUm_ );
+	bool verifiable = ( encoderReadback_ || stepOutDetection_ );
+	trial.safe = ( clean && verifiable );
+	trial.unverified = ( clean && verifiable == false );
+	return 0;
+}
+
+//Settings of a Grid Point:  Both Rates, Speed and Current, With the Operation Data Rates Selected
+ControllerProfile MotionProfileTuner::TrialProfile( const MotionProfileTrial& trial )
+{
+	ControllerProfile profile;
+	profile.name = "Tuned";
+
+	const char* const names[] = { "decelRate", "accelRate", "operatingSpeed", "operatingCurrent", "accelRateType" };
+	long long values[] = { trial.accelRate, trial.accelRate, trial.operatingSpeed, trial.operatingCurrent, g_SeparateAccelRates };
+
+	for( size_t i = 0; i < sizeof( names )/sizeof( names[0] ); i++ )
+	{
+		ControllerProfileSetting setting;
+		setting.registerName = names[i];
+		setting.value = values[i];
+		setting.line = 0;
+		profile.settings.push_back( setting );
+	}
+
+	return profile;
+}
+
+//Rank Order:  Safe, Unverified, Unsafe, Then Faster
+bool MotionProfileTuner::TrialBefore( const MotionProfileTrial& a, const MotionProfileTrial& b )
+{
+	if( a.safe != b.safe )
+	{
+		return a.safe;
+	}
+	if( a.unverified != b.unverified )
+	{
+		return a.unverified;
+	}
+	return a.totalMs < b.totalMs;
+}
+
+/* Write the Ranked Trials as JSON, With the Hub's Simulated Bus Parameters When it is Active
+*   @param path - file to create (overwritten if present)
+*   Returns - 0 if written, otherwise non-zero
+*/
+int MotionProfileTuner::WriteJson( const std::string& path, OrientalFTDIHub* hub ) const
+{
+	if( path.empty() )
+	{
+		return 1;
+	}
+
+	FILE* file = fopen( path.c_str(), "w" );
+	if( file == nullptr )
+	{
+		return 1;
+	}
+
+	unsigned long baudRate = 0;
+	double usbLatencyMs = 0;
+	double motorSpeed = 0;
+	bool simulated = ( hub != nullptr && hub->GetBusSimulation( baudRate, usbLatencyMs, motorSpeed ) );
+
+	fprintf( file, "{\"benchmark\":\"motionProfileTuner\",\"transport\":\"%s\",", ( simulated ) ? "simulated" : "live" );
+	if( simulated )
+	{
+		fprintf( file, "\"simulation\":{\"baudRate\":%lu,\"usbLatencyMs\":%g,\"motorSpeedStepsPerSec\":%g},", baudRate, usbLatencyMs, motorSpeed );
+	}
+	fprintf( file, "\"repeats\":%u,\"stepOutDetection\":%s,\"encoderReadback\":%s,\"deviationToleranceUm\":%g,\"stepSizesUm\":[", repeats_,
+				( stepOutDetection_ ) ? "true" : "false", ( encoderReadback_ ) ? "true" : "false", deviationToleranceUm_ );
+	for( size_t i = 0; i < stepSizesUm_.size(); i++ )
+	{
+		fprintf( file, "%s%g", ( i == 0 ) ? "" : ",", stepSizesUm_[i] );
+	}
+	fprintf( file, "],\"results\":[" );
+
+	for( size_t i = 0; i < results_.size(); i++ )
+	{
+		const MotionProfileTrial& t = results_[i];
+		fprintf( file, "%s\n{\"rank\":%u,\"accelRate\":%lu,\"operatingSpeed\":%lu,\"operatingCurrent\":%lu,\"totalMs\":%.3f,\"moves\":%lu,\"failures\":%lu,\"alarmCode\":%u,\"warningCode\":%u,\"deviationUm\":%g,\"safe\":%s,\"unverified\":%s}",
+					( i == 0 ) ? "" : ",", (unsigned int) ( i + 1 ), (unsigned long) t.accelRate, (unsigned long) t.operatingSpeed, (unsigned long) t.operatingCurrent,
+					t.totalMs, t.moves, t.failures, t.alarmCode, t.warningCode, t.deviationUm, ( t.safe ) ? "true" : "false", ( t.unverified ) ? "true" : "false" );
+	}
+
+	fprintf( file, "\n]}\n" );
+
+	int ret = ( ferror( file ) != 0 ) ? 1 : 0;
+	fclose( file );
+	return ret;
+}
+
+/* Write the Best Safe Trial as a Controller Profile File
+*   Note:  Unverified trials rank after safe ones, so an unverified first result means there is nothing safe to write
+*   Returns - 0 if written, otherwise non-zero (also when no trial was safe, an unverified trial is never written)
+*/
+int MotionProfileTuner::WriteProfile( const std::string& path ) const
+{
+	if( path.empty() || results_.empty() || results_[0].safe == false )
+	{
+		return 1;
+	}
+
+	const MotionProfileTrial& best = results_[0];
+	char comment[160];
+	sprintf( comment, "Motion Profile Tuner:  Fastest Safe of %u Trials, %.1f ms Over %u Step Sizes", (unsigned int) results_.size(), best.totalMs, (unsigned int) stepSizesUm_.size() );
+
+	return ControllerProfileFile::Save( path, std::vector< ControllerProfile >( 1, TrialProfile( best ) ), comment );
+}
+
+//Best Trials For the Log
+std::string MotionProfileTuner::Summary( void ) const
+{
+	std::string summary;
+	char line[200];
+
+	for( size_t i = 0; i < results_.size() && i < summaryTrials_; i++ )
+	{
+		const MotionProfileTrial& t = results_[i];
+		sprintf( line, "%u. accelRate %lu, %lu Hz, %lu%% Current: %.1f ms%s (%lu of %lu moves failed, alarm %x, warning %x, deviation %g um)\n",
+					(unsigned int) ( i + 1 ), (unsigned long) t.accelRate, (unsigned long) t.operatingSpeed, (unsigned long) t.operatingCurrent, t.totalMs,
+					( t.safe ) ? "" : ( ( t.unverified ) ? " UNVERIFIED" : " UNSAFE" ), t.failures, t.moves, t.alarmCode, t.warningCode, t.deviationUm );
+		summary += line;
+	}
+
+	return summary;
+}
@@ -0,0 +1,111 @@
+#ifndef _MOTION_PROFILE_TUNER_
+#define _MOTION_PROFILE_TUNER_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "ControllerProfile.h"
+
+//Forward Declarations
+class OrientalMotorFocus;
+class OrientalFTDIHub;
+class AbstractControllerInterface;
+
+/*  One Grid Point of a Tuning Sweep and What it Measured
+*     Values Are in Register Units:  accelRate is Written to accelRateReg and decelRateReg (0.001 ms/kHz), operatingSpeed in Hz,
+*     operatingCurrent in Percent
+*/
+struct MotionProfileTrial
+{
+	uint32_t accelRate;
+	uint32_t operatingSpeed;
+	uint32_t operatingCurrent;
+	double totalMs;				//Sum of the Mean Settled Move Time of Every Step Size
+	unsigned long moves;
+	unsigned long failures;		//Moves Rejected, Failed on the Bus or Not Settled (or the Settings Were Not Accepted)
+	unsigned int alarmCode;
+	unsigned int warningCode;
+	double deviationUm;			//Readback Change Over the Trial's Moves, Which Return to Where They Started
+	bool safe;					//No Failures, Alarm, Warning or Deviation Past the Tolerance, and a Step-Out Would Have Shown
+	bool unverified;			//Nothing Seen, but Neither Encoder Readback Nor Step-Out Detection Was On to See a Step-Out
+};
+
+/*
+*  Sweeps a Grid of Acceleration Rate, Operating Speed and Operating Current Over a Set of Step Sizes
+*     Each Grid Point is Applied as a Controller Profile, Timed With a MoveLatencyBenchmark and Checked For Step-Out
+*     (the Controller's Alarm and Warning, Plus the Position Readback, Which Only an Encoder Readback Makes Meaningful)
+*     Without Encoder Readback or the Controller's Step-Out Detection a Step-Out Cannot be Seen:  Trials Are Then Unverified, Never Safe
+*     Results Are Ranked Safe, Unverified, Unsafe, Then by Total Time; the Best Safe Point Can be Written as a Profile For "Controller Profile File"
+*     The Registers a Trial Writes Are Read Before the Sweep and Restored After it
+*     Meant For the Hub's Simulated Bus or Live Hardware (the Stage Really Moves, Some Grid Points Are Expected to Step Out)
+*     Note:  Setting Names Are the OrientalCRK525MAKD Profile Names
+*/
+class MotionProfileTuner
+{
+	public:
+		static const unsigned int defaultRepeats_ = 2;
+		//Lines of Summary()
+		static const unsigned int summaryTrials_ = 5;
+
+		MotionProfileTuner( OrientalMotorFocus& stage, AbstractControllerInterface* controller );
+
+		//Grid and Step Sizes Swept by Run()
+		void SetAccelRates( const std::vector< uint32_t >& accelRates ) { accelRates_ = accelRates; }
+		void SetOperatingSpeeds( const std::vector< uint32_t >& operatingSpeeds ) { operatingSpeeds_ = operatingSpeeds; }
+		void SetOperatingCurrents( const std::vector< uint32_t >& operatingCurrents ) { operatingCurrents_ = operatingCurrents; }
+		void SetStepSizes( const std::vector< double >& stepSizesUm ) { stepSizesUm_ = stepSizesUm; }
+		//Readback Deviation That Counts as a Step-Out
+		void SetDeviationToleranceUm( double toleranceUm ) { deviationToleranceUm_ = toleranceUm; }
+
+		/* Run Every Grid Point
+		*   @param repeats - moves per step size and grid point (back and forth)
+		*   Returns - 0 if the sweep ran and the settings were restored, otherwise the first error that stopped it or the restore
+		*/
+		int Run( unsigned int repeats = defaultRepeats_ );
+
+		//Ranked Trials of the Last Run()
+		const std::vector< MotionProfileTrial >& GetResults( void ) const { return results_; }
+
+		/* Write the Ranked Trials as JSON, With the Hub's Simulated Bus Parameters When it is Active
+		*   @param path - file to create (overwritten if present)
+		*   Returns - 0 if written, otherwise non-zero
+		*/
+		int WriteJson( const std::string& path, OrientalFTDIHub* hub ) const;
+
+		/* Write the Best Safe Trial as a Controller Profile File
+		*   Returns - 0 if written, otherwise non-zero (also when no trial was safe, an unverified trial is never written)
+		*/
+		int WriteProfile( const std::string& path ) const;
+
+		//Best Trials For the Log
+		std::string Summary( void ) const;
+
+	private:
+
+		/* Apply, Time and Check One Grid Point
+		*   Returns - 0 if the trial ran (safe or not), otherwise the error that stopped it
+		*/
+		int RunTrial( MotionProfileTrial& trial, unsigned int repeats );
+
+		//Settings of a Grid Point (Its Names Are Also the Snapshot Restored After the Sweep)
+		static ControllerProfile TrialProfile( const MotionProfileTrial& trial );
+
+		//Rank Order:  Safe, Unverified, Unsafe, Then Faster
+		static bool TrialBefore( const MotionProfileTrial& a, const MotionProfileTrial& b );
+
+		OrientalMotorFocus& stage_;
+		AbstractControllerInterface* controller_;
+		std::vector< uint32_t > accelRates_;
+		std::vector< uint32_t > operatingSpeeds_;
+		std::vector< uint32_t > operatingCurrents_;
+		std::vector< double > stepSizesUm_;
+		double deviationToleranceUm_;
+		std::vector< MotionProfileTrial > results_;
+		unsigned int repeats_;
+		bool stepOutDetection_;
+		bool encoderReadback_;
+
+		MotionProfileTuner& operator=( const MotionProfileTuner& );
+};
+
+#endif
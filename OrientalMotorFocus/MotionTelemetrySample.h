@@ -0,0 +1,19 @@
+#ifndef _MOTION_TELEMETRY_SAMPLE_
+#define _MOTION_TELEMETRY_SAMPLE_
+
+#include <stdint.h>
+
+/*  One Timestamped Snapshot of a Controller's Motion Monitor Registers
+*     timeMs - CAlternativeUtils::GetMonotonicTimeMs() when the registers were requested
+*     ioStatus - Raw I/O Status Bits (MOVE, READY, etc. as Defined by the Controller)
+*/
+struct MotionTelemetrySample
+{
+	double timeMs;
+	int32_t commandPos;
+	int32_t commandSpeed;
+	int32_t encoderCount;
+	uint32_t ioStatus;
+};
+
+#endif
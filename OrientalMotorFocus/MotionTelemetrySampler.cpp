@@ -0,0 +1,199 @@
+#include "MotionTelemetrySampler.h"
+#include "OrientalControllerTemplate.h"
+#include "SerialControllerBus.h"
+#include "ControllerLog.h"
+#include "AlternativeUtils.h"
+
+MotionTelemetrySampler::MotionTelemetrySampler( AbstractControllerInterface* controller, SerialControllerBus* bus, long intervalMS ):
+	controller_(controller),
+	bus_(bus),
+	stop_(false),
+	running_(false),
+	intervalMS_( ( intervalMS < 1 ) ? 1 : intervalMS ),
+	sampleCount_(0),
+	droppedCount_(0),
+	busSkippedCount_(0),
+	readErrorCount_(0),
+	fileSink_(nullptr),
+	sinkOpen_(false)
+{
+
+	assert( controller_ != nullptr && bus_ != nullptr );
+
+}
+
+MotionTelemetrySampler::~MotionTelemetrySampler()
+{
+
+	CloseFileSink();
+
+}
+
+int MotionTelemetrySampler::svc( void ) {
+
+	ControllerLogScope logScope( bus_->GetLogSink() );
+	double nextTickMs = CAlternativeUtils::GetMonotonicTimeMs();
+
+	while( stop_ == false )
+	{
+		//Note, Sleep Resolution is 1 ms min (Windows), so the interval is only as accurate as that
+		if( CAlternativeUtils::GetMonotonicTimeMs() < nextTickMs )
+		{
+			CAlternativeUtils::SleepMs( 1 );
+			continue;
+		}
+
+		SampleOnce();
+
+		if( sinkOpen_ )
+		{
+			DrainToFileSink();
+		}
+
+		nextTickMs += intervalMS_;
+		//Don't Try to Catch Up After a Long Serial Transaction, Just Resume the Cadence From Now
+		double now = CAlternativeUtils::GetMonotonicTimeMs();
+		if( nextTickMs < now )
+		{
+			nextTickMs = now;
+		}
+	}
+
+	running_ = false;
+
+	return 0;
+
+}
+
+/* Take One Sample if the Serial Line is Idle and Push it to the Ring
+*   Note:  The push neither allocates nor waits; a full ring drops the sample
+*/
+void MotionTelemetrySampler::SampleOnce( void ) {
+
+	MotionTelemetrySample sample;
+
+	if( bus_->IsSerialLineIdle() == false )
+	{
+		busSkippedCount_++;
+		return;
+	}
+
+	if( controller_->ReadMotionTelemetry( sample ) != 0 )
+	{
+		readErrorCount_++;
+		return;
+	}
+
+	if( ring_.push( sample ) == false )
+	{
+		droppedCount_++;
+		return;
+	}
+
+	sampleCount_++;
+
+}
+
+/* Consumer API: Copy Out and Remove the Oldest Samples From the Ring
+*   Note:  Must only be called from one thread, and returns 0 while a file sink is open (the sink is the consumer)
+*   @param samples[] - destination for the samples
+*   @param maxSamples - size of samples[]
+*   Returns - Number of Samples Copied
+*/
+size_t MotionTelemetrySampler::PopSamples( MotionTelemetrySample samples[], size_t maxSamples ) {
+
+	//Consumers Are Serialized Against the File Sink Drain, the Producer Never Takes This Lock
+	MMThreadGuard guard( sinkLock_ );
+
+	if( fileSink_ != nullptr )
+	{
+		return 0;
+	}
+
+	return ring_.pop( samples, maxSamples );
+
+}
+
+/* Move Everything in the Ring to the File Sink
+*   Note:  Runs on the sampling thread after the sample is pushed, so file I/O never delays a sample already taken
+*/
+void MotionTelemetrySampler::DrainToFileSink( void ) {
+
+	MotionTelemetrySample sample;
+
+	MMThreadGuard guard( sinkLock_ );
+
+	if( fileSink_ == nullptr )
+	{
+		return;
+	}
+
+	while( ring_.pop( sample ) )
+	{
+		fprintf( fileSink_, "%.3f,%ld,%ld,%ld,0x%08lX\n", sample.timeMs, (long) sample.commandPos, (long) sample.commandSpeed,
+					(long) sample.encoderCount, (unsigned long) sample.ioStatus );
+	}
+
+}
+
+/* Write Every Sample to a CSV File as it is Taken
+*   @param path - file to create (overwritten if present)
+*   Returns - 0 if the file was opened, otherwise non-zero
+*/
+int MotionTelemetrySampler::OpenFileSink( const std::string& path ) {
+
+	CloseFileSink();
+
+	MMThreadGuard guard( sinkLock_ );
+
+	if( path.empty() )
+	{
+		return 1;
+	}
+
+	if( ( fileSink_ = fopen( path.c_str(), "w" ) ) == nullptr )
+	{
+		ControllerLogScope logScope( bus_->GetLogSink() );
+		ORIENTAL_LOG_WARN( "Could Not Open Telemetry File {}", path.c_str() );
+		return 1;
+	}
+
+	fprintf( fileSink_, "TimeMs,CommandPosition,CommandSpeed,EncoderCounter,IOStatus\n" );
+	fileSinkPath_ = path;
+	sinkOpen_ = true;
+
+	return 0;
+
+}
+
+void MotionTelemetrySampler::CloseFileSink( void ) {
+
+	MMThreadGuard guard( sinkLock_ );
+
+	sinkOpen_ = false;
+
+	if( fileSink_ != nullptr )
+	{
+		fclose( fileSink_ );
+		fileSink_ = nullptr;
+	}
+
+	fileSinkPath_.clear();
+
+}
+
+std::string MotionTelemetrySampler::GetFileSinkPath( void ) {
+
+	MMThreadGuard guard( sinkLock_ );
+	return fileSinkPath_;
+
+}
+
+void MotionTelemetrySampler::ResetCounters( void ) {
+
+	sampleCount_ = 0;
+	droppedCount_ = 0;
+	busSkippedCount_ = 0;
+	readErrorCount_ = 0;
+
+}
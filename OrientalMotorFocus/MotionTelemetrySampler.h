@@ -0,0 +1,107 @@
+#ifndef _MOTION_TELEMETRY_SAMPLER_
+#define _MOTION_TELEMETRY_SAMPLER_
+
+#include "OrientalCoreDefs.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <assert.h>
+#include <boost/atomic.hpp>
+#include <boost/lockfree/spsc_queue.hpp>
+#include "MotionTelemetrySample.h"
+
+//Forward Declarations
+class AbstractControllerInterface;
+class SerialControllerBus;
+
+/*  Sampling Thread That Polls a Controller's Motion Monitor Registers at a Set Interval
+*     Samples are only taken while the bus' serial line is idle, so telemetry never delays a command
+*     Samples are stored in a preallocated single-producer/single-consumer ring; once full, new samples are dropped and counted
+*     The Consumer is either the caller of PopSamples() or the file sink, never both
+*/
+class MotionTelemetrySampler: public MMDeviceThreadBase
+{
+   public:
+	  //Ring Capacity in Samples (Fixed at Compile Time So the Ring Never Allocates)
+	  static const size_t ringCapacity_ = 4096;
+
+	  MotionTelemetrySampler( AbstractControllerInterface* controller, SerialControllerBus* bus, long intervalMS = 100 );
+	  ~MotionTelemetrySampler();
+
+	  /* Sampling Loop, Runs Until Stop() is Called
+	  *    Returns - 0 on completion
+	  */
+	  int svc( void );
+
+	  int open (void*) { return 0;}
+	  int close(unsigned long) {return 0;}
+
+	  //Used to Start the Thread Loop
+	  void Start() { stop_ = false; running_ = true; activate(); }
+	  //Used to Stop the Thread Loop (Follow With wait() Before Deleting)
+	  void Stop() { stop_ = true; }
+	  bool IsRunning() const { return running_; }
+
+	  /* Set the Time Between Samples
+	  *   Note:  A sample is skipped (and counted) when its tick falls on a busy serial line
+	  *   @param intervalMS - milliseconds between samples (minimum 1)
+	  */
+	  void SetIntervalMS( long intervalMS ) { intervalMS_ = ( intervalMS < 1 ) ? 1 : intervalMS; }
+	  long GetIntervalMS( void ) const { return intervalMS_; }
+
+	  /* Consumer API: Copy Out and Remove the Oldest Samples From the Ring
+	  *   Note:  Must only be called from one thread, and returns 0 while a file sink is open (the sink is the consumer)
+	  *   @param samples[] - destination for the samples
+	  *   @param maxSamples - size of samples[]
+	  *   Returns - Number of Samples Copied
+	  */
+	  size_t PopSamples( MotionTelemetrySample samples[], size_t maxSamples );
+
+	  /* Write Every Sample to a CSV File as it is Taken
+	  *   @param path - file to create (overwritten if present)
+	  *   Returns - 0 if the file was opened, otherwise non-zero
+	  */
+	  int OpenFileSink( const std::string& path );
+	  void CloseFileSink( void );
+	  std::string GetFileSinkPath( void );
+
+	  //Counters
+	  unsigned long GetSampleCount( void ) const { return sampleCount_; }
+	  unsigned long GetDroppedCount( void ) const { return droppedCount_; }
+	  unsigned long GetBusSkippedCount( void ) const { return busSkippedCount_; }
+	  unsigned long GetReadErrorCount( void ) const { return readErrorCount_; }
+	  void ResetCounters( void );
+
+   private:
+
+	  typedef boost::lockfree::spsc_queue< MotionTelemetrySample, boost::lockfree::capacity< ringCapacity_ > > TelemetryRing;
+
+	  //Take One Sample if the Serial Line is Idle and Push it to the Ring
+	  void SampleOnce( void );
+	  //Move Everything in the Ring to the File Sink
+	  void DrainToFileSink( void );
+
+	  AbstractControllerInterface* controller_;
+	  SerialControllerBus* bus_;
+
+	  TelemetryRing ring_;
+
+	  boost::atomic<bool> stop_;
+	  boost::atomic<bool> running_;
+	  boost::atomic<long> intervalMS_;
+
+	  boost::atomic<unsigned long> sampleCount_;
+	  boost::atomic<unsigned long> droppedCount_;
+	  boost::atomic<unsigned long> busSkippedCount_;
+	  boost::atomic<unsigned long> readErrorCount_;
+
+	  //Protects fileSink_ and fileSinkPath_ and Serializes Consumers, Never Taken While Pushing
+	  MMThreadLock sinkLock_;
+	  FILE* fileSink_;
+	  std::string fileSinkPath_;
+	  boost::atomic<bool> sinkOpen_;
+
+	  MotionTelemetrySampler& operator=(MotionTelemetrySampler& ) {assert(false); return *this;}
+};
+
+#endif
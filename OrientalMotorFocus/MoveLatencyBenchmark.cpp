@@ -0,0 +1,183 @@
+#include "MoveLatencyBenchmark.h"
+#include "OrientalControllerTemplate.h"
+#include "AlternativeUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <stdio.h>
+
+static const double g_DefaultStepSizesUm[] = { 0.1, 0.25, 0.5, 1.0, 2.0, 5.0, 10.0, 25.0 };
+
+MoveLatencyBenchmark::MoveLatencyBenchmark( BenchmarkedStage& stage, AbstractControllerInterface* controller ) :
+	stage_(stage),
+	controller_(controller),
+	stepSizesUm_( g_DefaultStepSizesUm, g_DefaultStepSizesUm + sizeof( g_DefaultStepSizesUm )/sizeof( g_DefaultStepSizesUm[0] ) ),
+	repeats_(0)
+{ }
+
+/* Measure repeats Moves of Every Step Size
+*   Note:  Moves alternate away from and back to the starting position, away is toward the upper limit unless that would pass it
+*   Returns - 0 if every move settled, otherwise the first error (results are still kept)
+*/
+int MoveLatencyBenchmark::Run( unsigned int repeats )
+{
+	int errCode = 0;
+	int ret;
+	double startUm;
+	double lowerUm;
+	double upperUm;
+	double latencyMs;
+
+	results_.clear();
+	repeats_ = repeats;
+
+	if( ( ret = stage_.GetPositionUm( startUm ) ) != 0 || ( ret = stage_.GetLimits( lowerUm, upperUm ) ) != 0 )
+	{
+		return ret;
+	}
+
+	for( size_t s = 0; s < stepSizesUm_.size(); s++ )
+	{
+		double awayUm = ( startUm + stepSizesUm_[s] <= upperUm ) ? startUm + stepSizesUm_[s] : startUm - stepSizesUm_[s];
+		std::vector< double > latenciesMs;
+		MoveLatencyStats stats;
+		stats.stepUm = stepSizesUm_[s];
+		stats.failures = 0;
+
+		for( unsigned int i = 0; i < repeats; i++ )
+		{
+			ret = MeasureMove( ( i % 2 == 0 ) ? awayUm : startUm, latencyMs );
+			if( ret != 0 )
+			{
+				stats.failures++;
+				if( errCode == 0 )
+				{
+					errCode = ret;
+				}
+				continue;
+			}
+			latenciesMs.push_back( latencyMs );
+		}
+
+		//An Odd Count Ends Away From the Start
+		if( repeats % 2 != 0 )
+		{
+			MeasureMove( startUm, latencyMs );
+		}
+
+		Summarize( latenciesMs, stats );
+		results_.push_back( stats );
+	}
+
+	return errCode;
+}
+
+/* Move to targetUm and Wait For the Controller to Report the Move Finished
+*   Note:  Each busy check is a serial read, so polling cost is part of the measured latency (as it is for any caller)
+*   Returns - 0 if settled, otherwise the failing error code
+*/
+int MoveLatencyBenchmark::MeasureMove( double targetUm, double& latencyMs )
+{
+	int ret;
+	double startMs = CAlternativeUtils::GetMonotonicTimeMs();
+
+	if( ( ret = stage_.SetPositionUm( targetUm ) ) != 0 )
+	{
+		return ret;
+	}
+
+	//IsMotorBusy() is 1 While Moving, 0 Once Stopped, Any Other Value an Error
+	while( ( ret = controller_->IsMotorBusy() ) == 1 )
+	{
+		if( CAlternativeUtils::GetMonotonicTimeMs() - startMs > settleTimeoutMS_ )
+		{
+			return DEVICE_ERR;
+		}
+	}
+
+	latencyMs = CAlternativeUtils::GetMonotonicTimeMs() - startMs;
+	return ret;
+}
+
+//Fill a Result From the Settled Latencies (Sorted in Place), Percentiles Are Nearest Rank
+void MoveLatencyBenchmark::Summarize( std::vector< double >& latenciesMs, MoveLatencyStats& stats )
+{
+	stats.samples = static_cast< unsigned long >( latenciesMs.size() );
+	stats.meanMs = stats.minMs = stats.p50Ms = stats.p90Ms = stats.p99Ms = stats.maxMs = 0;
+
+	if( latenciesMs.empty() )
+	{
+		return;
+	}
+
+	std::sort( latenciesMs.begin(), latenciesMs.end() );
+
+	double sumMs = 0;
+	for( size_t i = 0; i < latenciesMs.size(); i++ )
+	{
+		sumMs += latenciesMs[i];
+	}
+
+	size_t n = latenciesMs.size();
+	stats.meanMs = sumMs / n;
+	stats.minMs = latenciesMs.front();
+	stats.maxMs = latenciesMs.back();
+	stats.p50Ms = latenciesMs[ static_cast< size_t >( std::ceil( 0.50 * n ) ) - 1 ];
+	stats.p90Ms = latenciesMs[ static_cast< size_t >( std::ceil( 0.90 * n ) ) - 1 ];
+	stats.p99Ms = latenciesMs[ static_cast< size_t >( std::ceil( 0.99 * n ) ) - 1 ];
+}
+
+/* Write the Results as JSON, With the Simulated Bus Parameters When the Bus Was Simulated
+*   @param path - file to create (overwritten if present)
+*   @param bus - bus the results were measured on
+*   Returns - 0 if written, otherwise non-zero
+*/
+int MoveLatencyBenchmark::WriteJson( const std::string& path, const MoveLatencyBusInfo& bus ) const
+{
+	if( path.empty() )
+	{
+		return 1;
+	}
+
+	FILE* file = fopen( path.c_str(), "w" );
+	if( file == nullptr )
+	{
+		return 1;
+	}
+
+	fprintf( file, "{\"benchmark\":\"moveLatency\",\"transport\":\"%s\",", ( bus.simulated ) ? "simulated" : "live" );
+	if( bus.simulated )
+	{
+		fprintf( file, "\"simulation\":{\"baudRate\":%lu,\"usbLatencyMs\":%g,\"motorSpeedStepsPerSec\":%g},", bus.baudRate, bus.usbLatencyMs, bus.motorSpeedStepsPerSec );
+	}
+	fprintf( file, "\"repeats\":%u,\"settleTimeoutMs\":%ld,\"results\":[", repeats_, settleTimeoutMS_ );
+
+	for( size_t i = 0; i < results_.size(); i++ )
+	{
+		const MoveLatencyStats& r = results_[i];
+		fprintf( file, "%s\n{\"stepUm\":%g,\"samples\":%lu,\"failures\":%lu,\"meanMs\":%.3f,\"minMs\":%.3f,\"p50Ms\":%.3f,\"p90Ms\":%.3f,\"p99Ms\":%.3f,\"maxMs\":%.3f}",
+					( i == 0 ) ? "" : ",", r.stepUm, r.samples, r.failures, r.meanMs, r.minMs, r.p50Ms, r.p90Ms, r.p99Ms, r.maxMs );
+	}
+
+	fprintf( file, "\n]}\n" );
+
+	int ret = ( ferror( file ) != 0 ) ? 1 : 0;
+	fclose( file );
+	return ret;
+}
+
+//One Line Per Step Size For the Log
+std::string MoveLatencyBenchmark::Summary( void ) const
+{
+	std::string summary;
+	char line[200];
+
+	for( size_t i = 0; i < results_.size(); i++ )
+	{
+		const MoveLatencyStats& r = results_[i];
+		sprintf( line, "%g um: p50 %.1f ms p90 %.1f ms p99 %.1f ms max %.1f ms (%lu settled, %lu failed)\n",
+					r.stepUm, r.p50Ms, r.p90Ms, r.p99Ms, r.maxMs, r.samples, r.failures );
+		summary += line;
+	}
+
+	return summary;
+}
@@ -0,0 +1,108 @@
+#ifndef _MOVE_LATENCY_BENCHMARK_
+#define _MOVE_LATENCY_BENCHMARK_
+
+#include <string>
+#include <vector>
+
+//Forward Declarations
+class AbstractControllerInterface;
+
+/*  Stage the Benchmark Moves (OrientalMotorFocus, or a Bare Controller in Tools/MoveLatencyBenchmarkTool.cpp)
+*/
+class BenchmarkedStage
+{
+	public:
+		virtual ~BenchmarkedStage() {}
+
+		virtual int GetPositionUm( double& posUm ) = 0;
+		virtual int GetLimits( double& lowerUm, double& upperUm ) = 0;
+		/* Start a Move to posUm
+		*   Returns - 0, or errCode otherwise
+		*/
+		virtual int SetPositionUm( double posUm ) = 0;
+};
+
+/*  Bus the Results Were Measured On, For the Report
+*/
+struct MoveLatencyBusInfo
+{
+	MoveLatencyBusInfo() : simulated(false), baudRate(0), usbLatencyMs(0), motorSpeedStepsPerSec(0) {}
+
+	bool simulated;					//Simulated Slaves; the Rest is Only Reported When Set
+	unsigned long baudRate;
+	double usbLatencyMs;
+	double motorSpeedStepsPerSec;
+};
+
+/*  Latency Distribution For One Step Size
+*     Latency is From SetPositionUm() Being Called to the Controller Reporting the Move Finished (MOVE Output Clear)
+*/
+struct MoveLatencyStats
+{
+	double stepUm;
+	unsigned long samples;		//Moves That Settled
+	unsigned long failures;		//Moves Rejected, Failed on the Bus or Not Settled Within settleTimeoutMS_
+	double meanMs;
+	double minMs;
+	double p50Ms;
+	double p90Ms;
+	double p99Ms;
+	double maxMs;
+};
+
+/*
+*  End-to-End Move Latency Through the Whole Stack (Stage API, Controller, Hub, Transport)
+*     Meant For the Hub's Simulated Bus, but Runs Against Live Hardware Too (the Stage Really Moves)
+*     Needs No Micro-Manager Core, so Tools/MoveLatencyBenchmarkTool.cpp Runs it Headless Over SimulatedCRKTransport
+*     Every Step Size is Moved Back and Forth From the Starting Position, Which is Restored at the End
+*     Note:  Busy() of the Stage Does Not Track Motion, so Settling is Confirmed by Polling IsMotorBusy() on the Controller
+*/
+class MoveLatencyBenchmark
+{
+	public:
+		static const unsigned int defaultRepeats_ = 20;
+		static const long settleTimeoutMS_ = 10000;
+
+		MoveLatencyBenchmark( BenchmarkedStage& stage, AbstractControllerInterface* controller );
+
+		//Step Sizes Measured by Run() (Default: Z-Stack Steps 0.1 - 1 um, Autofocus Search Steps 2 - 25 um)
+		void SetStepSizes( const std::vector< double >& stepSizesUm ) { stepSizesUm_ = stepSizesUm; }
+
+		/* Measure repeats Moves of Every Step Size
+		*   Returns - 0 if every move settled, otherwise the first error (results are still kept)
+		*/
+		int Run( unsigned int repeats = defaultRepeats_ );
+
+		const std::vector< MoveLatencyStats >& GetResults( void ) const { return results_; }
+
+		/* Write the Results as JSON, With the Simulated Bus Parameters When the Bus Was Simulated
+		*   @param path - file to create (overwritten if present)
+		*   @param bus - bus the results were measured on (OrientalFTDIHub::GetBusSimulation() in the adapter)
+		*   Returns - 0 if written, otherwise non-zero
+		*/
+		int WriteJson( const std::string& path, const MoveLatencyBusInfo& bus ) const;
+
+		//One Line Per Step Size For the Log
+		std::string Summary( void ) const;
+
+	private:
+
+		/* Move to targetUm and Wait For the Controller to Report the Move Finished
+		*   @param latencyMs - set to the time from the move request to the finished report
+		*   Returns - 0 if settled, otherwise the failing error code
+		*/
+		int MeasureMove( double targetUm, double& latencyMs );
+
+		//Fill a Result From the Settled Latencies (Sorted in Place)
+		static void Summarize( std::vector< double >& latenciesMs, MoveLatencyStats& stats );
+
+		BenchmarkedStage& stage_;
+		AbstractControllerInterface* controller_;
+		std::vector< double > stepSizesUm_;
+		std::vector< MoveLatencyStats > results_;
+		unsigned int repeats_;
+
+		MoveLatencyBenchmark& operator=( const MoveLatencyBenchmark& );
+};
+
+#endif
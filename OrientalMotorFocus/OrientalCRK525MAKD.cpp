@@ -1,9 +1,15 @@
 #include "OrientalCRK525PMAKD.h"
-#include "ftd2xx.h"
 #include <type_traits>
 #include <cstdint>
+#include <cmath>
 #include "ControllerStatusMonitorThread.h"
 #include "OrientalMotorExceptions.h"
+#include "AlternativeUtils.h"
+#include "TelemetryRecorder.h"
+#include "ControllerBus.h"
+#include "MotionTelemetrySample.h"
+#include "ControllerTrace.h"
+#include <algorithm>
 
 typedef enum exceptionData{
 
@@ -30,7 +36,7 @@ int OrientalCRK525MAKD::SetBaseAnglePartitionImpl( double baseAnglePartition )
 
 	if( reg == nullptr )
 	{
-		AbstractControllerInterfaceFactory::LogMessage(  "Register is Nullptr" );
+		ORIENTAL_LOG_WARN( "Base Angle Register is Nullptr" );
 	}
 
 
@@ -51,7 +57,7 @@ int OrientalCRK525MAKD::SetBaseAnglePartitionImpl( double baseAnglePartition )
 		{
 			numSerialBytes = ReadWrite< decltype( _36DegBaseStepAnglesTypeMap_[ baseAnglePartition ] ), false >::read( serialVal, sizeof(serialVal), _36DegBaseStepAnglesTypeMap_[ baseAnglePartition ] );
 		}*/
-		AbstractControllerInterfaceFactory::LogMessage(  "Going to Serial Write Single Register " );
+		ORIENTAL_LOG_DEBUG( "Writing Base Angle Partition {}", baseAnglePartition );
 
 		if( ( ret = serialWriteSingleRegister( (*reg), _36DegBaseStepAnglesTypeMap_[ baseAnglePartition ] ) ) != 0 )
 		{ 
@@ -156,157 +162,833 @@ double OrientalCRK525MAKD::ReadCurrentBaseAnglePartition( void )
 *   Note: This will be hard-coded for every new controller
 *   Note:  Used to display all available step Increments for a selected Base Angle
 *   @param baseAngleOption - the current BaseAngle Being Queried
-*   Returns - vector of doubles or an empty vector if there is a problem
+*   Returns - vector of doubles or an empty vector if there is a problem (Owned by the Controller, so Nothing is Copied)
 */
-std::vector<double> OrientalCRK525MAKD::GetBaseAnglePartitionOptions( double baseAngleOption )
+const std::vector<double>& OrientalCRK525MAKD::GetBaseAnglePartitionOptions( double baseAngleOption )
 {
-	vector< double > options;
+	if( baseAngleOption == .36 )
+	{
+		return degOptions_36_;
+	}
+	else if ( baseAngleOption == .72 )
+	{
+		return degOptions_72_;
+	}
+
+	//Invalid Base Angle Passed! noDegOptions_.empty() == true
+	return noDegOptions_;
+
+}
+
+
+/*Virtual Implementation - Initialize Physical Controller Via Serial Commands
+*    Note:  NO Serial Communication should be done inside of controller constructor, due to user ability to correct errors later
+*    Note:  The configuration is read first and only differences are written, so a controller that kept it costs two reads
+*    Returns - 0 or errCode otherwise
+*/
+int OrientalCRK525MAKD::InitializePhysicalController() 
+{
+
+	int errCode;
+	uint32_t fingerprint;
+	bool applied;
+
+	//Verify Controller is connected (The Configuration Read Answers in Place of testConnection())
+	if( ( errCode = ReadConfiguration( fingerprint, applied ) ) != 0 )
+	{
+		return errCode;
+	}
+
+	if( applied )
+	{
+		ORIENTAL_LOG_DEBUG( "Configuration Already Applied, Fingerprint {x}", fingerprint );
+		return 0;
+	}
+
+	if( (errCode = WriteConfigurationDifferences() ) != 0 )
+	{
+		return errCode;
+	}
+	
+
+	//AbstractControllerInterfaceFactory::LogMessage( "Checking Is Busy" );
+	//IsMotorBusy();
+
+
+
+
+	return 0;
+}
+
+/* Virtual Implementation - Reads the Configuration Registers (Parameter Block in One Read, Rotation Direction in a Second)
+*    Note:  motorRotationDirReg is a system parameter, 0x100 registers past the block, so it cannot share the read
+*   @param fingerprint - set to the FNV-1a fingerprint of the values read
+*   @param applied - set to true if every value already matches
+*    Returns - 0 or errCode otherwise
+*/
+int OrientalCRK525MAKD::ReadConfiguration( uint32_t& fingerprint, bool& applied )
+{
+
+	int errCode;
+
+	configurationRead_ = false;
+
+	//Members Keep Their Value When a Read Returns One Outside Their Enum, so Start Each From its Factory Value (Never the Desired One)
+	for( int i = 0; i < NumConfigurationEntries; i++ )
+	{
+		SetRegisterValue16( *configuration_[i].reg, configuration_[i].factoryValue );
+	}
+
+	if( ( errCode = ReadRegisters( &startInputModeReg, configurationBlockNumRegs_ ) ) != 0 || ( errCode = ReadRegisters( &motorRotationDirReg, 1 ) ) != 0 )
+	{
+		ORIENTAL_LOG_WARN( "Configuration Read Failed With {}", errCode );
+		return errCode;
+	}
+
+	configurationRead_ = true;
+	fingerprint = FingerprintConfiguration( false );
+
+	applied = true;
+	for( int i = 0; i < NumConfigurationEntries; i++ )
+	{
+		if( ConfigurationEntryDiffers( i ) )
+		{
+			ORIENTAL_LOG_DEBUG( "Configuration Register {x} Holds {x}, Wanted {x}", (unsigned int) configuration_[i].reg->getAddress(), (unsigned int) GetRegisterValue16( *configuration_[i].reg ), (unsigned int) configuration_[i].value );
+			applied = false;
+		}
+	}
+
+	return 0;
+}
+
+/* Virtual Implementation - Writes the Configuration Values That Differed in the Last ReadConfiguration()
+*    Note:  Without a successful read every value is written, as InitializePhysicalController() always did
+*    Returns - 0 or errCode otherwise
+*/
+int OrientalCRK525MAKD::WriteConfigurationDifferences()
+{
+
+	int errCode;
+
+	//Switch over Command Control to RS-485 Communication
+	ORIENTAL_LOG_DEBUG( "Switching Controller Inputs to RS-485" );
+	//Start Input Mode
+	if( ConfigurationEntryDiffers( ConfigStartInputMode ) && (errCode = serialWriteSingleRegister( startInputModeReg, inputTypeEnum16Bit::RS485 ) ) != 0 )
+	{
+		return errCode;
+	}
+
+	if( ConfigurationEntryDiffers( ConfigIOStopInput ) && (errCode = serialWriteSingleRegister( IOStopInputReg, genericEnableEnum16Bit::Disable) )  != 0 )
+	{
+		return errCode;
+	}
+
+	//Ensure ClockWise is + Direction First
+	if( ConfigurationEntryDiffers( ConfigRotationDirection ) && (errCode = serialWriteSingleRegister( motorRotationDirReg, spinDirectionsEnum16Bit::CounterClockWise, nullptr, true ) ) != 0 )
+	{
+		return errCode;
+	}
+
+	//One Multi-Write Costs the Same Round Trip Whether One or All Three Input Modes Differ
+	if( ( ConfigurationEntryDiffers( ConfigMotorExciteInputMode ) || ConfigurationEntryDiffers( ConfigHomeFwdRvsInputMode ) || ConfigurationEntryDiffers( ConfigDataNumInputMode ) )
+		&& (errCode = WriteRS485InputModes( false ) ) != 0 )
+	{
+		return errCode;
+	}
+
+	return 0;
+}
+
+/* Virtual Implementation - Resolves Every Setting to a Parameter Area Register and Checks its Value
+*   Returns - 0 if the profile can be applied, otherwise non-zero
+*/
+int OrientalCRK525MAKD::ValidateProfile( const ControllerProfile& profile, std::string& error )
+{
+	std::vector< ProfileWrite > writes;
+	return BuildProfileWrites( profile, writes, error );
+}
+
+/* Virtual Implementation - Writes a Profile With One Multi-Write Per Run of Consecutive Registers
+*   Note:  A profile of every named register (16 settings) goes out in 7 writes instead of 16
+*    Returns - 0 or errCode otherwise (-2 if the profile does not validate)
+*/
+int OrientalCRK525MAKD::ApplyProfile( const ControllerProfile& profile )
+{
+
+	std::vector< ProfileWrite > writes;
+	std::string error;
+	int errCode;
+
+	if( BuildProfileWrites( profile, writes, error ) != 0 )
+	{
+		ORIENTAL_LOG_WARN( "Profile {} Not Applied: {}", profile.name, error );
+		return -2;
+	}
+
+	for( size_t i = 0; i < writes.size(); i++ )
+	{
+		if( ( errCode = serialWriteMultiRegister( *writes[i].startReg, writes[i].numRegs, writes[i].values, writes[i].numBytes ) ) != 0 )
+		{
+			ORIENTAL_LOG_WARN( "Profile {} Write {} of {} Failed With {}", profile.name, (unsigned int) ( i + 1 ), (unsigned int) writes.size(), errCode );
+			return errCode;
+		}
+	}
+
+	ORIENTAL_LOG_DEBUG( "Profile {} Applied: {} Settings in {} Writes", profile.name, (unsigned int) profile.settings.size(), (unsigned int) writes.size() );
+	return 0;
+}
+
+/* Virtual Implementation - Reads Each Setting's Register (Unsigned Raw Value, so it Can be Applied Back)
+*   Note:  One read per setting, this is for snapshots rather than the move path
+*    Returns - 0 or errCode otherwise
+*/
+int OrientalCRK525MAKD::ReadProfile( ControllerProfile& profile )
+{
+
+	int errCode;
+
+	for( size_t i = 0; i < profile.settings.size(); i++ )
+	{
+		ControllerProfileSetting& setting = profile.settings[i];
+		AbstractRegisterBase* reg = GetProfileRegister( setting.registerName );
+		if( reg == nullptr )
+		{
+			ORIENTAL_LOG_WARN( "Profile {} Has No Register {}", profile.name, setting.registerName );
+			return 1;
+		}
+
+		int numBytes = reg->getRegisterByteSize();
+		if( ( errCode = ReadRegisters( reg, numBytes / baseRegisterByteSize_ ) ) != 0 )
+		{
+			return errCode;
+		}
+
+		if( numBytes == sizeof( uint16_t ) )
+		{
+			setting.value = GetRegisterValue16( *reg );
+		}
+		else
+		{
+			unsigned char bytes[ sizeof( uint32_t ) ];
+			uint32_t raw = 0;
+			reg->read( bytes, numBytes );
+			//Incomplete Type Workaround
+			if( reg->isBigEndianCheck() )
+			{
+				ReadWrite< uint32_t, true >::write( bytes, numBytes, raw );
+			}
+			else
+			{
+				ReadWrite< uint32_t, false >::write( bytes, numBytes, raw );
+			}
+			setting.value = raw;
+		}
+	}
+
+	return 0;
+}
+
+/* Virtual Implementation - Reads presentAlarmReg Through presentWarningReg in One Read, Then stepOutDetectionReg
+*   Note:  The alarm records between them come along in the read (0x0100 - 0x010B)
+*    Returns - 0 or errCode otherwise
+*/
+int OrientalCRK525MAKD::ReadFaultState( ControllerFaultState& state )
+{
+
+	int errCode;
+	unsigned int numRegs = presentWarningReg.getAddress() - presentAlarmReg.getAddress() + 1;
+
+	if( ( errCode = ReadRegisters( &presentAlarmReg, numRegs ) ) != 0 || ( errCode = ReadRegisters( &stepOutDetectionReg, 1 ) ) != 0 )
+	{
+		return errCode;
+	}
+
+	state.alarmCode = GetRegisterValue16( presentAlarmReg );
+	state.warningCode = GetRegisterValue16( presentWarningReg );
+	state.stepOutDetection = ( GetRegisterValue16( stepOutDetectionReg ) == genericEnableEnum16Bit::Enable );
+
+	return 0;
+}
+
+/* Virtual Implementation - Pulses resetAlarmReg and clearWarningRecReg Together (Two Multi-Writes)
+*   Note:  Both act on the 0 to 1 edge; clearAlarmRecReg between them is held at 0, so the alarm records are kept
+*    Returns - 0 or errCode otherwise
+*/
+int OrientalCRK525MAKD::ClearFaults( void )
+{
+
+	static const unsigned int numRegs = 3;
+	unsigned char values[ numRegs * baseRegisterByteSize_ ];
+	int errCode;
+
+	for( int pulse = executeEnum16Bit::Execute; pulse >= executeEnum16Bit::DoNotExecute; pulse-- )
+	{
+		ReadWrite< uint16_t, true >::read( &values[0], baseRegisterByteSize_, static_cast< uint16_t >( pulse ) );
+		ReadWrite< uint16_t, true >::read( &values[2], baseRegisterByteSize_, static_cast< uint16_t >( executeEnum16Bit::DoNotExecute ) );
+		ReadWrite< uint16_t, true >::read( &values[4], baseRegisterByteSize_, static_cast< uint16_t >( pulse ) );
+		if( ( errCode = serialWriteMultiRegister( resetAlarmReg, numRegs, values, sizeof( values ) ) ) != 0 )
+		{
+			return errCode;
+		}
+	}
+
+	return 0;
+}
+
+/* Resolve, Check and Merge the Settings of a Profile Into Multi-Writes
+*   Note:  Values are checked by the register itself (testSerialDataConformance()), as serialWriteMultiRegister() checks them again
+*   Note:  A run of consecutive registers ends at a gap (an unregistered address cannot be written) or at maxProfileWriteRegs_
+*   Returns - 0, or non-zero if a setting is bad
+*/
+int OrientalCRK525MAKD::BuildProfileWrites( const ControllerProfile& profile, std::vector< ProfileWrite >& writes, std::string& error )
+{
+
+	std::vector< ProfileValue > values;
+	char lineText[ 32 ];
+
+	for( size_t i = 0; i < profile.settings.size(); i++ )
+	{
+		const ControllerProfileSetting& setting = profile.settings[i];
+		ProfileValue value;
+		sprintf( lineText, "Line %u: ", setting.line );
+
+		if( ( value.reg = GetProfileRegister( setting.registerName ) ) == nullptr )
+		{
+			error = std::string( lineText ) + "No Profile Register " + setting.registerName;
+			return 1;
+		}
+		value.address = value.reg->getAddress();
+		value.numBytes = value.reg->getRegisterByteSize();
+
+		//Signed and Unsigned Values Both Fit the Register's Width; the Register Decides Which it Accepts
+		long long minValue = -( 1LL << ( value.numBytes * 8 - 1 ) );
+		long long maxValue = ( 1LL << ( value.numBytes * 8 ) ) - 1;
+		if( setting.value < minValue || setting.value > maxValue )
+		{
+			error = std::string( lineText ) + setting.registerName + " Does Not Fit its Register";
+			return 1;
+		}
+
+		//Incomplete Type Workaround
+		bool bigEndian = value.reg->isBigEndianCheck();
+		if( value.numBytes == sizeof( uint16_t ) )
+		{
+			uint16_t raw = static_cast< uint16_t >( setting.value );
+			if( bigEndian )
+			{
+				ReadWrite< uint16_t, true >::read( value.bytes, value.numBytes, raw );
+			}
+			else
+			{
+				ReadWrite< uint16_t, false >::read( value.bytes, value.numBytes, raw );
+			}
+		}
+		else
+		{
+			uint32_t raw = static_cast< uint32_t >( setting.value );
+			if( bigEndian )
+			{
+				ReadWrite< uint32_t, true >::read( value.bytes, value.numBytes, raw );
+			}
+			else
+			{
+				ReadWrite< uint32_t, false >::read( value.bytes, value.numBytes, raw );
+			}
+		}
+
+		if( value.reg->testSerialDataConformance( value.bytes, value.numBytes ) != 1 )
+		{
+			error = std::string( lineText ) + setting.registerName + " Does Not Accept the Value";
+			return 1;
+		}
+
+		for( size_t v = 0; v < values.size(); v++ )
+		{
+			if( values[v].address == value.address )
+			{
+				error = std::string( lineText ) + setting.registerName + " is Already Set in Profile " + profile.name;
+				return 1;
+			}
+		}
+		values.push_back( value );
+	}
+
+	std::sort( values.begin(), values.end(), ProfileValueBefore );
+
+	writes.clear();
+	uint32_t nextAddress = 0;
+	for( size_t v = 0; v < values.size(); v++ )
+	{
+		unsigned int numRegs = values[v].numBytes / baseRegisterByteSize_;
+		if( writes.empty() || values[v].address != nextAddress || writes.back().numRegs + numRegs > maxProfileWriteRegs_ )
+		{
+			ProfileWrite write;
+			write.startReg = values[v].reg;
+			write.numRegs = 0;
+			write.numBytes = 0;
+			writes.push_back( write );
+		}
+
+		ProfileWrite& write = writes.back();
+		memcpy( &write.values[ write.numBytes ], values[v].bytes, values[v].numBytes );
+		write.numBytes += values[v].numBytes;
+		write.numRegs += numRegs;
+		nextAddress = values[v].address + numRegs;
+	}
+
+	return 0;
+}
+
+/* Register For a Profile Register Name, or a Parameter Area Address in Hex ("0x0228")
+*   Note:  Addresses are limited to the parameter area, commands and communication settings cannot be reached by a profile
+*   Returns - the register, or nullptr if there is none
+*/
+AbstractRegisterBase* OrientalCRK525MAKD::GetProfileRegister( const std::string& name )
+{
+
+	struct ProfileRegisterName
+	{
+		const char* name;
+		AbstractRegisterBase* reg;
+	};
+
+	ProfileRegisterName names[] =
+	{
+		{ "decelRate", &decelRateReg },
+		{ "accelRate", &accelRateReg },
+		{ "operatingSpeed", &operatingSpeedReg },
+		{ "operatingCurrent", &operatingCurrentReg },
+		{ "standstillCurrent", &standstillCurrentReg },
+		{ "commonAccelRate", &commonAccelRateReg },
+		{ "commonDecelRate", &commonDecelRateReg },
+		{ "startSpeed", &startSpeedReg },
+		{ "jogOperatingSpeed", &jogOperatingSpeedReg },
+		{ "jogAccelRate", &jogAccelRateReg },
+		{ "jogStartSpeed", &jogStartSpeedReg },
+		{ "accelRateType", &accelRateTypeReg },
+		{ "softwareOverTravel", &softwareOverTravelReg },
+		{ "positiveSoftwareLimit", &positiveSotwareLimitReg },
+		{ "negativeSoftwareLimit", &negativeSotwareLimitReg },
+		{ "stepOutDetectionAction", &stepOutDetectionActionReg }
+	};
+
+	for( size_t i = 0; i < sizeof( names ) / sizeof( names[0] ); i++ )
+	{
+		if( name == names[i].name )
+		{
+			return names[i].reg;
+		}
+	}
+
+	unsigned int address;
+	char trailing;
+	if( name.size() > 2 && name[0] == '0' && ( name[1] == 'x' || name[1] == 'X' )
+		&& sscanf( name.c_str() + 2, "%x%c", &address, &trailing ) == 1
+		&& address >= g_ParameterAreaByteBase && address < g_SystemParameterByteBase )
+	{
+		return GetRegisterByAddress( address );
+	}
+
+	return nullptr;
+}
+
+//Fill configuration_ (Constructor Only)
+void OrientalCRK525MAKD::BuildConfigurationTable( void )
+{
+
+	ConfigurationEntry entries[ NumConfigurationEntries ] =
+	{
+		{ &startInputModeReg, inputTypeEnum16Bit::RS485, inputTypeEnum16Bit::IO },
+		{ &IOStopInputReg, genericEnableEnum16Bit::Disable, genericEnableEnum16Bit::Enable },
+		{ &motorRotationDirReg, spinDirectionsEnum16Bit::CounterClockWise, spinDirectionsEnum16Bit::ClockWise },
+		{ &motorExciteInputModeReg, inputTypeEnum16Bit::RS485, inputTypeEnum16Bit::IO },
+		{ &homeFwdRvsInputModeReg, inputTypeEnum16Bit::RS485, inputTypeEnum16Bit::IO },
+		{ &dataNumInputModeReg, inputTypeEnum16Bit::RS485, inputTypeEnum16Bit::IO }
+	};
+
+	for( int i = 0; i < NumConfigurationEntries; i++ )
+	{
+		configuration_[i] = entries[i];
+	}
+	configurationRead_ = false;
+}
+
+//Entry Must be Written:  it Differed in the Last ReadConfiguration(), or There Was No Successful One
+bool OrientalCRK525MAKD::ConfigurationEntryDiffers( int id )
+{
+	return configurationRead_ == false || GetRegisterValue16( *configuration_[id].reg ) != configuration_[id].value;
+}
+
+/* FNV-1a Over the Address and Value of Every Entry (Big Endian, as on the Line)
+*   @param desired - hash the desired values, otherwise the register members (last read values)
+*/
+uint32_t OrientalCRK525MAKD::FingerprintConfiguration( bool desired )
+{
+
+	uint32_t hash = CAlternativeUtils::fnv1aOffsetBasis_;
+	unsigned char bytes[4];
+
+	for( int i = 0; i < NumConfigurationEntries; i++ )
+	{
+		uint16_t address = static_cast< uint16_t >( configuration_[i].reg->getAddress() );
+		uint16_t value = ( desired ) ? configuration_[i].value : GetRegisterValue16( *configuration_[i].reg );
+		ReadWrite< uint16_t, true >::read( &bytes[0], 2, address );
+		ReadWrite< uint16_t, true >::read( &bytes[2], 2, value );
+		hash = CAlternativeUtils::Fnv1aHash( bytes, sizeof( bytes ), hash );
+	}
+
+	return hash;
+}
+
+//Raw Value of a One-Register Member
+uint16_t OrientalCRK525MAKD::GetRegisterValue16( AbstractRegisterBase& reg )
+{
+
+	unsigned char bytes[ baseRegisterByteSize_ ];
+	uint16_t value = 0;
+
+	reg.read( bytes, sizeof( bytes ) );
+	//Incomplete Type Workaround
+	if( reg.isBigEndianCheck() )
+	{
+		ReadWrite< uint16_t, true >::write( bytes, sizeof( bytes ), value );
+	}
+	else
+	{
+		ReadWrite< uint16_t, false >::write( bytes, sizeof( bytes ), value );
+	}
+
+	return value;
+}
+
+//Set a One-Register Member From a Raw Value (Ignored if Outside its Accepted Values)
+void OrientalCRK525MAKD::SetRegisterValue16( AbstractRegisterBase& reg, uint16_t value )
+{
+
+	unsigned char bytes[ baseRegisterByteSize_ ];
+
+	if( reg.isBigEndianCheck() )
+	{
+		ReadWrite< uint16_t, true >::read( bytes, sizeof( bytes ), value );
+	}
+	else
+	{
+		ReadWrite< uint16_t, false >::read( bytes, sizeof( bytes ), value );
+	}
+	reg.write( bytes, sizeof( bytes ) );
+}
+
+/* Virtual Implementation - Broadcasts the Input Mode and Rotation Direction Writes of InitializePhysicalController()
+*    Note:  Same Values and Order as InitializePhysicalController(), Without its testConnection()
+*    Returns - 0 or errCode otherwise
+*/
+int OrientalCRK525MAKD::BroadcastCommonConfiguration()
+{
+
+	int errCode;
+
+	ORIENTAL_LOG_DEBUG( "Broadcasting RS-485 Inputs and Rotation Direction" );
+	if( ( errCode = SendFixedFrame( FrameBroadcastStartInputRS485 ) ) != 0 || ( errCode = SendFixedFrame( FrameBroadcastIOStopDisable ) ) != 0
+		|| ( errCode = SendFixedFrame( FrameBroadcastRotationCCW ) ) != 0 )
+	{
+		return errCode;
+	}
+
+	return WriteRS485InputModes( true );
+}
+
+/* Switch Motor Excitation, Home/Fwd/Rvs and Data No Inputs to RS-485 (One Multi-Write)
+*   @param broadcast - address the request to slave 0
+*   Returns - 0 on completion or errCode otherwise
+*/
+int OrientalCRK525MAKD::WriteRS485InputModes( bool broadcast )
+{
+
+	int errCode;
+	unsigned char multiRegValues[maxWritePacketbytes_];
+	int currentByte = 0;
+
+	//Motor Excitation Mode
+	currentByte += ReadWrite< decltype( motorExciteInputModeReg.getVal() ), motorExciteInputModeReg.isBigEndian_>::read( &multiRegValues[currentByte], sizeof(multiRegValues), inputTypeEnum16Bit::RS485 );
+	//Home/Fwd/Rvs
+	currentByte += ReadWrite< decltype( homeFwdRvsInputModeReg.getVal() ), homeFwdRvsInputModeReg.isBigEndian_>::read( &multiRegValues[currentByte], sizeof(multiRegValues), inputTypeEnum16Bit::RS485 );
+	//Data No Input Mode
+	currentByte += ReadWrite< decltype( dataNumInputModeReg.getVal() ), dataNumInputModeReg.isBigEndian_>::read( &multiRegValues[currentByte], sizeof(multiRegValues), inputTypeEnum16Bit::RS485 );
+
+	if( (errCode = serialWriteMultiRegister( motorExciteInputModeReg, 3, multiRegValues, currentByte, broadcast ) ) != 0 )
+	{
+		ORIENTAL_LOG_WARN( "Input Mode Multi-Write Failed With {}", errCode );
+		return errCode;
+	}
+
+	return 0;
+}
+
+/*  @Overload to virtual function testConnection
+*   Sends a testConnection Packet Request to the Controller to verify Working Order
+*		@param testValue - May be any 2 Byte number to test Byte integrity
+*		Returns - 0 if successful, or errCode if not 
+*/
+int OrientalCRK525MAKD::testConnection( uint16_t testValue ){
+
+	static const int packetByteSize = 8;
+	unsigned char packet[packetByteSize];
+	int currentByte = 0;
+	int valueIndex;
+	int numBytesWritten;
+	int errCode = 0;
+
+	//Controller Slave Address
+	numBytesWritten = getAddressBuffer( packet, 1 );
+	if( numBytesWritten == -1 )  
+	{
+		//The Buffer must have been too small
+		return -1;
+	}
+	currentByte +=numBytesWritten;
+
+	//Function Code
+	packet[currentByte] =  functionCodes::diagnose;
+	currentByte += sizeof( functionCodes::diagnose );
+
+	//SubFunction Code
+	packet[ currentByte ] = 0x00;
+	packet[currentByte + 1 ] = 0x00;
+	currentByte += 2;
+
+	//Add First Two Bytes of the passed value Big Endian Pass (Will not overflow)
+	currentByte += ReadWrite< uint16_t, true >::read( &packet[ currentByte ], packetByteSize - currentByte, testValue );
+
+	ORIENTAL_LOG_TRACE( "Test Connection Value {} Packet {}", (unsigned int) testValue, ORIENTAL_LOG_BYTES( packet, currentByte ) );
+
+	//Add CRCCheckValue
+	numBytesWritten = appendCRCCheckValue( packet, sizeof(packet), currentByte );
+	if( numBytesWritten == -1 )
+	{
+		//The Buffer Must have been too small
+		return -1;
+	}
+	currentByte += numBytesWritten;
+
+	//Communicate With Controller
+	if( ( errCode = ( retrieveSerialCommHubPtr()->*retrieveSerialCommFuncPtr() )( packet, currentByte, this, false ) ) != DEVICE_OK )
+	{
+		//Register Was not Written
+		return errCode;
+	}
+
+	return DEVICE_OK;
+
+}
+
+/* Set Address From a Big Endian Buffer Representation and Rebuild the Fixed Frames For it
+*   @param serializedAddrBuffer[] - Big Endian Buffer of the Address
+*   @param bufferSize - Size of the Buffer
+*   Returns - 0 if successful, or the ControllerInterface::setAddressBuffer() errCode
+*/
+int OrientalCRK525MAKD::setAddressBuffer( const unsigned char serializedAddrBuffer[], int bufferSize ) {
+
+	int errCode;
+
+	if( ( errCode = ControllerInterface::setAddressBuffer( serializedAddrBuffer, bufferSize ) ) != DEVICE_OK )
+	{
+		return errCode;
+	}
+
+	BuildFixedFrames();
+
+	return DEVICE_OK;
+}
+
+/* Build Every Fixed Frame For the Current Address
+*   Note:  Values Are Constants Every Register Accepts, so No Conformance Check is Repeated When Sending
+*   Returns - 0 if all frames were built, otherwise -1 (unbuilt frames fall back to the run-time builders)
+*/
+int OrientalCRK525MAKD::BuildFixedFrames( void ) {
+
+	MMThreadGuard guard( fixedFramesLock_ );
+
+	int errCode = 0;
 
-	if( baseAngleOption == .36 )
-	{
-		return degOptions_36_;
-	}
-	else if ( baseAngleOption == .72 )
-	{
-		return degOptions_72_;
-	}
-	else
+	errCode |= BuildReadFrame( CommandPosReg, monitorBlockNumRegs_, fixedFrames_[ FrameMonitorBlockRead ] );
+	errCode |= BuildReadFrame( DriverStatusReg, DriverStatusReg.getRegisterByteSize()/baseRegisterByteSize_, fixedFrames_[ FrameDriverStatusRead ] );
+	errCode |= BuildDiagnoseFrame( 0x1234, fixedFrames_[ FrameDiagnose ] );
+	errCode |= BuildSingleWriteFrame( cmd1Reg, 0, fixedFrames_[ FrameCmd1Off ] );
+	errCode |= BuildSingleWriteFrame( cmd1Reg, cmd1BitsEnum16Bit::COn, fixedFrames_[ FrameCmd1COn ] );
+	errCode |= BuildSingleWriteFrame( cmd1Reg, cmd1BitsEnum16Bit::M0, fixedFrames_[ FrameCmd1M0 ] );
+	errCode |= BuildSingleWriteFrame( cmd1Reg, cmd1BitsEnum16Bit::M0 | cmd1BitsEnum16Bit::COn, fixedFrames_[ FrameCmd1M0COn ] );
+	errCode |= BuildSingleWriteFrame( cmd1Reg, cmd1BitsEnum16Bit::Start | cmd1BitsEnum16Bit::M0 | cmd1BitsEnum16Bit::COn, fixedFrames_[ FrameCmd1StartM0COn ] );
+	errCode |= BuildSingleWriteFrame( cmd1Reg, cmd1BitsEnum16Bit::Fwd | cmd1BitsEnum16Bit::COn, fixedFrames_[ FrameCmd1FwdCOn ] );
+	errCode |= BuildSingleWriteFrame( cmd1Reg, cmd1BitsEnum16Bit::Rvs | cmd1BitsEnum16Bit::COn, fixedFrames_[ FrameCmd1RvsCOn ] );
+	errCode |= BuildSingleWriteFrame( cmd1Reg, cmd1BitsEnum16Bit::Stop | cmd1BitsEnum16Bit::COn, fixedFrames_[ FrameCmd1StopCOn ] );
+	errCode |= BuildSingleWriteFrame( cmd1Reg, cmd1BitsEnum16Bit::Start | cmd1BitsEnum16Bit::M0 | cmd1BitsEnum16Bit::COn, fixedFrames_[ FrameBroadcastStart ], true );
+	errCode |= BuildSingleWriteFrame( startInputModeReg, inputTypeEnum16Bit::RS485, fixedFrames_[ FrameBroadcastStartInputRS485 ], true );
+	errCode |= BuildSingleWriteFrame( IOStopInputReg, genericEnableEnum16Bit::Disable, fixedFrames_[ FrameBroadcastIOStopDisable ], true );
+	errCode |= BuildSingleWriteFrame( motorRotationDirReg, spinDirectionsEnum16Bit::CounterClockWise, fixedFrames_[ FrameBroadcastRotationCCW ], true );
+
+	if( errCode != 0 )
 	{
-		//Invalid Base Angle Passed! options.empty() == true
-		return options;
+		ORIENTAL_LOG_WARN( "Could Not Build Every Fixed Frame" );
+		return -1;
 	}
-	return options;
 
-}
+	ORIENTAL_LOG_DEBUG( "Fixed Frames Built, Status Poll {}", ORIENTAL_LOG_BYTES( fixedFrames_[ FrameMonitorBlockRead ].bytes, fixedFrames_[ FrameMonitorBlockRead ].len ) );
 
+	return 0;
+}
 
-/*Virtual Implementation - Initialize Physical Controller Via Serial Commands
-*    Note:  NO Serial Communication should be done inside of controller constructor, due to user ability to correct errors later
-*    Returns - 0 or errCode otherwise
+/* Build a Single Register Write Request Into frame (CRC Included)
+*   @param broadcast - address the frame to slave 0 (every slave acts on it, none answers)
+*   Returns - 0 if built, otherwise -1
 */
-int OrientalCRK525MAKD::InitializePhysicalController() 
-{
+int OrientalCRK525MAKD::BuildSingleWriteFrame( AbstractRegisterBase& reg, uint16_t value, FixedFrame& frame, bool broadcast ) {
 
-	int errCode;
-	unsigned char multiRegValues[maxWritePacketbytes_];
 	int currentByte = 0;
+	int numBytesWritten;
+
+	frame.len = 0;
 
-	//Verify Controller is connected or throw exception
-	if( ( errCode = testConnection() ) != 0 )
+	if( reg.getRegisterByteSize() != baseRegisterByteSize_ )
 	{
-		return errCode;
+		return -1;
 	}
-	//Switch over Command Control to RS-485 Communication
-	AbstractControllerInterfaceFactory::LogMessage(  "Single Write" );
-	//Start Input Mode
-	if( (errCode = serialWriteSingleRegister( startInputModeReg, inputTypeEnum16Bit::RS485 ) ) != 0 )
+
+	if( broadcast )
 	{
-		return errCode;
+		memset( frame.bytes, 0, sizeof( ControllerAddressType ) );
+		numBytesWritten = sizeof( ControllerAddressType );
 	}
+	else if( ( numBytesWritten = getAddressBuffer( frame.bytes, fixedFrameBytes_ ) ) == -1 )
+	{
+		return -1;
+	}
+	currentByte += numBytesWritten;
 
-	if( (errCode = serialWriteSingleRegister( IOStopInputReg, genericEnableEnum16Bit::Disable) )  != 0 )
+	frame.bytes[ currentByte++ ] = functionCodes::registerWrite;
+
+	if( ( numBytesWritten = reg.readAddress( &frame.bytes[ currentByte ], fixedFrameBytes_ - currentByte ) ) == -1 )
 	{
-		return errCode;
+		return -1;
 	}
+	currentByte += numBytesWritten;
 
-	//Ensure ClockWise is + Direction First
-	if( (errCode = serialWriteSingleRegister( motorRotationDirReg, spinDirectionsEnum16Bit::CounterClockWise, nullptr, true ) ) != 0 )
+	currentByte += ReadWrite< uint16_t, true >::read( &frame.bytes[ currentByte ], fixedFrameBytes_ - currentByte, value );
+
+	if( ( numBytesWritten = appendCRCCheckValue( frame.bytes, fixedFrameBytes_, currentByte ) ) == -1 )
 	{
-		return errCode;
+		return -1;
 	}
 
-	currentByte = 0;
-	//Motor Excitation Mode
-	currentByte += ReadWrite< decltype( motorExciteInputModeReg.getVal() ), motorExciteInputModeReg.isBigEndian_>::read( &multiRegValues[currentByte], sizeof(multiRegValues), inputTypeEnum16Bit::RS485 );
-	//Home/Fwd/Rvs
-	currentByte += ReadWrite< decltype( homeFwdRvsInputModeReg.getVal() ), homeFwdRvsInputModeReg.isBigEndian_>::read( &multiRegValues[currentByte], sizeof(multiRegValues), inputTypeEnum16Bit::RS485 );
-	//Data No Input Mode
-	currentByte += ReadWrite< decltype( dataNumInputModeReg.getVal() ), dataNumInputModeReg.isBigEndian_>::read( &multiRegValues[currentByte], sizeof(multiRegValues), inputTypeEnum16Bit::RS485 );
+	frame.len = currentByte + numBytesWritten;
+	return 0;
+}
 
-	std::ostringstream os;
-	
+/* Build a Register Read Request Into frame (CRC Included)
+*   Returns - 0 if built, otherwise -1
+*/
+int OrientalCRK525MAKD::BuildReadFrame( AbstractRegisterBase& reg, uint16_t numRegs, FixedFrame& frame ) {
+
+	int currentByte = 0;
+	int numBytesWritten;
+
+	frame.len = 0;
 
-	AbstractControllerInterfaceFactory::LogMessage(  "MultiWrite" );
-	if( (errCode = serialWriteMultiRegister( motorExciteInputModeReg, 3, multiRegValues, currentByte ) ) != 0 )
+	if( ( numBytesWritten = getAddressBuffer( frame.bytes, fixedFrameBytes_ ) ) == -1 )
 	{
-		os << "The errCode Was " << (int) errCode;
-		AbstractControllerInterfaceFactory::LogMessage( os.str() );
-		return errCode;
+		return -1;
 	}
-	
+	currentByte += numBytesWritten;
 
-	//AbstractControllerInterfaceFactory::LogMessage( "Checking Is Busy" );
-	//IsMotorBusy();
+	frame.bytes[ currentByte++ ] = functionCodes::registerRead;
 
+	if( ( numBytesWritten = reg.readAddress( &frame.bytes[ currentByte ], fixedFrameBytes_ - currentByte ) ) == -1 )
+	{
+		return -1;
+	}
+	currentByte += numBytesWritten;
 
+	currentByte += ReadWrite< uint16_t, true >::read( &frame.bytes[ currentByte ], fixedFrameBytes_ - currentByte, numRegs );
 
+	if( ( numBytesWritten = appendCRCCheckValue( frame.bytes, fixedFrameBytes_, currentByte ) ) == -1 )
+	{
+		return -1;
+	}
 
+	frame.len = currentByte + numBytesWritten;
 	return 0;
 }
 
-/*  @Overload to virtual function testConnection
-*   Sends a testConnection Packet Request to the Controller to verify Working Order
-*		@param testValue - May be any 2 Byte number to test Byte integrity
-*		Returns - 0 if successful, or errCode if not 
+/* Build a Diagnose (Echo) Request Into frame (CRC Included)
+*   Returns - 0 if built, otherwise -1
 */
-int OrientalCRK525MAKD::testConnection( uint16_t testValue ){
+int OrientalCRK525MAKD::BuildDiagnoseFrame( uint16_t testValue, FixedFrame& frame ) {
 
-	static const int packetByteSize = 8;
-	unsigned char packet[packetByteSize];
 	int currentByte = 0;
-	int valueIndex;
 	int numBytesWritten;
-	int errCode = 0;
 
-	//Controller Slave Address
-	numBytesWritten = getAddressBuffer( packet, 1 );
-	if( numBytesWritten == -1 )  
+	frame.len = 0;
+
+	if( ( numBytesWritten = getAddressBuffer( frame.bytes, fixedFrameBytes_ ) ) == -1 )
 	{
-		//The Buffer must have been too small
 		return -1;
 	}
-	currentByte +=numBytesWritten;
+	currentByte += numBytesWritten;
 
-	//Function Code
-	packet[currentByte] =  functionCodes::diagnose;
-	currentByte += sizeof( functionCodes::diagnose );
+	frame.bytes[ currentByte++ ] = functionCodes::diagnose;
 
 	//SubFunction Code
-	packet[ currentByte ] = 0x00;
-	packet[currentByte + 1 ] = 0x00;
-	currentByte += 2;
-
-	std::ostringstream os;
-	os << "Value To Send is " << (int) testValue << "\n" ;
+	frame.bytes[ currentByte++ ] = 0x00;
+	frame.bytes[ currentByte++ ] = 0x00;
 
-	//Add First Two Bytes of the passed value Big Endian Pass (Will not overflow)
-	currentByte += ReadWrite< uint16_t, true >::read( &packet[ currentByte ], packetByteSize - currentByte, testValue );
+	currentByte += ReadWrite< uint16_t, true >::read( &frame.bytes[ currentByte ], fixedFrameBytes_ - currentByte, testValue );
 
-	for( int i = 0; i < sizeof(testValue); i++ )
+	if( ( numBytesWritten = appendCRCCheckValue( frame.bytes, fixedFrameBytes_, currentByte ) ) == -1 )
 	{
-		os << "packet [" << i - sizeof(testValue) + currentByte << "] = " << (int) packet[ currentByte + i -(currentByte + 1) ] << "\n";
+		return -1;
 	}
 
-	AbstractControllerInterfaceFactory::LogMessage( os.str() );
+	frame.len = currentByte + numBytesWritten;
+	return 0;
+}
+
+/* Send a Fixed Frame, Its Response Parsed as Usual
+*   Note:  The frame is copied out first, the serial function may keep the buffer while parsing the response
+*   @param id - FixedFrameId
+*   @param serialCommFuncPtr - nullptr uses retrieveSerialCommFuncPtr()
+*   Returns - 0 on completion, -1 if the frame was never built, or errCode of the transaction
+*/
+int OrientalCRK525MAKD::SendFixedFrame( FixedFrameId id, AbstractControllerInterface::SerialCommFuncPtr serialCommFuncPtr ) {
+
+	unsigned char packet[ fixedFrameBytes_ ];
+	int packetLen;
+	int errCode;
 
-	//Add CRCCheckValue
-	numBytesWritten = appendCRCCheckValue( packet, sizeof(packet), currentByte );
-	if( numBytesWritten == -1 )
 	{
-		//The Buffer Must have been too small
+		MMThreadGuard guard( fixedFramesLock_ );
+		packetLen = fixedFrames_[ id ].len;
+		memcpy( packet, fixedFrames_[ id ].bytes, fixedFrameBytes_ );
+	}
+
+	if( packetLen == 0 )
+	{
+		ORIENTAL_LOG_WARN( "Fixed Frame {} Was Never Built", (int) id );
 		return -1;
 	}
-	currentByte += numBytesWritten;
 
-	//Communicate With Controller
-	if( ( errCode = ( retrieveSerialCommHubPtr()->*retrieveSerialCommFuncPtr() )( packet, currentByte, this, false ) ) != DEVICE_OK )
+	if( serialCommFuncPtr == nullptr )
 	{
-		//Register Was not Written
+		serialCommFuncPtr = retrieveSerialCommFuncPtr();
+	}
+
+	ORIENTAL_LOG_TRACE( "Fixed Frame {} {}", (int) id, ORIENTAL_LOG_BYTES( packet, packetLen ) );
+
+	if( ( errCode = ( retrieveSerialCommHubPtr()->*serialCommFuncPtr )( packet, packetLen, this, id >= FrameBroadcastStart ) ) != DEVICE_OK )
+	{
+		ORIENTAL_LOG_WARN( "Fixed Frame {} Failed With {}", (int) id, errCode );
 		return errCode;
 	}
 
 	return DEVICE_OK;
-
 }
 
 /*
@@ -319,9 +1001,7 @@ int OrientalCRK525MAKD::dataLengthLookup( const unsigned char rxHeader[], const
 {
 	int remainingBytes = -1;
 
-	std::ostringstream os;
-	os << "the function code is " << (int) rxHeader[1];
-	AbstractControllerInterfaceFactory::LogMessage( os.str() );
+	ORIENTAL_LOG_TRACE( "Data Length Lookup For Function Code {x}", (unsigned int) rxHeader[1] );
 
 	//Check to see if the response is an exception Code
 	//Choose Fixed Length
@@ -342,7 +1022,6 @@ int OrientalCRK525MAKD::dataLengthLookup( const unsigned char rxHeader[], const
 				//Either Read Next Value and pump it out
 				//Or Have the Read Command Stored and then evaluated
 				//Since Read remainingBytes = byte(num bytes) + 2xNum Regs + 2 byte error check
-				AbstractControllerInterfaceFactory::LogMessage( "In Register Read HeaderLength" );
 				if ( rxHeaderLen == 3 )
 				{
 					remainingBytes = rxHeader[2] + 2;
@@ -395,120 +1074,400 @@ int OrientalCRK525MAKD::headerLengthLookup( const unsigned char txMsgBuffer[], c
 *It is typically used after using a headerLengthLookup to sample the only the expected header
 *Other uses would require the user to pass only the determined header Length is the whole Msg was sent
 */
-bool OrientalCRK525MAKD::sameAddress( const unsigned char rxHeader[], const int rxHeaderLen )
+bool OrientalCRK525MAKD::sameAddress( const unsigned char rxHeader[], const int rxHeaderLen )
+{
+	//Only two finite header lengths so might as well check them
+	if( rxHeaderLen != 2 && rxHeaderLen != 3 )
+	{
+		return false;
+	}
+
+	OrientalCRK525MAKD::ControllerAddressType regAddress;
+	GetAddress( regAddress );
+
+	return ( rxHeader[0] == regAddress ) ? true : false;
+
+}
+
+/* Writes a Serialized Value Through the passed SerialCommFunction
+*   @param serializedValue[] = Byte Array Passed From MMDevice Object for desired value
+*   @param serializedValueLen =  Number of Defined Bytes in the array
+*   @param valueIsBigEndian = Identifies The Way the Value was packaged into Bytes before being passed
+*   @param *SerialCommFuncPtr = Pointer to the Desired Serial Communication Function Being Used
+*/
+int OrientalCRK525MAKD::WritePosBuffer( unsigned char serializedValue[], int serializedValueLen, bool valueIsBigEndian, AbstractControllerInterface::SerialCommFuncPtr serialCommFuncPtr )
+{ 
+	TraceSpan span( "WritePosBuffer", g_TraceCategoryMotion );
+	int errCode = 0;
+
+	if( ( errCode = LoadPosBuffer( serializedValue, serializedValueLen, valueIsBigEndian, serialCommFuncPtr ) ) != 0 )
+	{
+		return errCode;
+	}
+
+	/* 
+	*  Send Start Command 
+	*/
+
+	if( ( errCode = SendFixedFrame( FrameCmd1StartM0COn, serialCommFuncPtr ) ) != 0 )
+	{
+		return errCode;
+	}
+	MarkPosReadbackMoving();
+	
+	//Check Code Will Be implemented in WritePosBuffer()
+
+	return 0; 
+
+};
+
+/* Mode and Position Frames of a Move (WritePosBuffer() Without the Start Command)
+*   Note:  The move is counted (and recorded) here, the start command follows it directly or as a broadcast
+*   @param serialCommFuncPtr - nullptr uses retrieveSerialCommFuncPtr()
+*   Returns - 0 if the position was loaded, or errCode otherwise
+*/
+int OrientalCRK525MAKD::LoadPosBuffer( unsigned char serializedValue[], int serializedValueLen, bool valueIsBigEndian, AbstractControllerInterface::SerialCommFuncPtr serialCommFuncPtr )
+{
+	int errCode = 0;
+	int typedValueIdx = 0;
+
+	//Check to See if SerializedValueLen and Register Length Coincide
+	if( serializedValueLen != posReg.getRegisterByteSize() )
+	{
+		typedValueIdx = serializedValueLen - posReg.getRegisterByteSize();
+		if( typedValueIdx < 0 ) //Undersized Value Not Accepted
+		{
+			return -1;
+		}
+
+		//One Exception: if buffer is passed with padded 0's from something like a long
+		for( int i = 0; i < typedValueIdx; i++ )
+		{
+			if( serializedValue[i] != 0 )
+			{
+				ORIENTAL_LOG_WARN( "Position Value Type Mismatch, {} Bytes", serializedValueLen );
+				return -1;
+			}
+		}
+	}
+
+	if( ( errCode = SendFixedFrame( FrameCmd1M0COn, serialCommFuncPtr ) ) != 0 )
+	{
+		return errCode;
+	}
+	//Dropping Fwd and Rvs Ended Any Continuous Operation
+	continuousDir_ = 0;
+
+	MotionPlan plan;
+	bool planned;
+	{
+		MMThreadGuard guard( motionPlanLock_ );
+		planned = motionPlansEnabled_ && nextMovePlanSet_;
+		plan = nextMovePlan_;
+		nextMovePlanSet_ = false;
+	}
+
+	
+	//Swap Values if The Data was Transported Differently Than in the Register
+	//Little Endian -> Big Endian Or Big Endian -> Little Endian
+	if( valueIsBigEndian != posReg.isBigEndianCheck() )
+	{
+		//OverSized Buffer That guarantees large transfer
+		unsigned char tempArray[MM::MaxStrLength];
+		for( int i = 0; i < serializedValueLen; ++i )
+		{
+			tempArray[i] = serializedValue[ serializedValueLen - (i+1) ];
+		}
+
+		//Copy Over to serializedValue
+		for( int i = 0; i < serializedValueLen; ++i )
+		{
+			serializedValue[ i ] = tempArray[ i ];
+		}
+
+	}
+
+	/*
+	*   Send Position Packet
+	*/
+
+	//Create value of Register Basic Type
+	/*decltype( posReg.getVal() ) val = 0;
+	if( valueIsBigEndian )
+	{
+		ReadWrite< decltype( posReg.getVal() ), true>::write( &serializedValue[ typedValueIdx ], serializedValueLen, val );
+	}
+	else
+	{
+		ReadWrite< decltype( posReg.getVal() ), false>::write( &serializedValue[ typedValueIdx ], serializedValueLen, val );
+	}*/
+	ORIENTAL_LOG_DEBUG( "Writing Position {}", ORIENTAL_LOG_BYTES( serializedValue, serializedValueLen ) );
+
+	if( planned )
+	{
+		errCode = WritePlannedMove( plan, &serializedValue[ typedValueIdx ] );
+	}
+	else
+	{
+		errCode = serialWriteMultiRegister( posReg, posReg.getRegisterByteSize()/baseRegisterByteSize_, serializedValue, serializedValueLen );
+	}
+	if( errCode != 0 )
+	{
+		return errCode;
+	}
+
+	//Samples Recorded From Here On Belong to This Move
+	moveId_++;
+	RecordTelemetry( TelemetryMove, static_cast< uint16_t >( posReg.getAddress() ), &serializedValue[ typedValueIdx ], posReg.getRegisterByteSize() );
+
+	return 0;
+}
+
+/* Write a Planned Move:  decelRateReg Through posReg (0x16 - 0x1D) in One 8 Register Multi-Write
+*   Note:  Same round trip as the position alone (25 of maxWritePacketbytes_ bytes), the rates cost no extra request
+*   @param posValue[] - Big Endian position, posReg.getRegisterByteSize() bytes
+*   Returns - 0 on completion or errorCodes otherwise
+*/
+int OrientalCRK525MAKD::WritePlannedMove( const MotionPlan& plan, unsigned char posValue[] )
+{
+
+	static const int numValues = 4;
+	unsigned char values[ numValues * sizeof( uint32_t ) ];
+	double speedHz = ( plan.speedHz < 1 ) ? 1 : ( ( plan.speedHz > 500000 ) ? 500000 : plan.speedHz );
+	uint32_t speed = static_cast< uint32_t >( speedHz + 0.5 );
+
+	//Operation Data Registers Are Big Endian
+	ReadWrite< uint32_t, true >::read( &values[0], sizeof( uint32_t ), RateRegisterValue( plan.decelHzPerS ) );
+	ReadWrite< uint32_t, true >::read( &values[4], sizeof( uint32_t ), RateRegisterValue( plan.accelHzPerS ) );
+	ReadWrite< uint32_t, true >::read( &values[8], sizeof( uint32_t ), speed );
+	memcpy( &values[12], posValue, sizeof( uint32_t ) );
+
+	ORIENTAL_LOG_DEBUG( "Planned Move:  {} Hz, Accel {} Hz/s, Decel {} Hz/s", speed, plan.accelHzPerS, plan.decelHzPerS );
+	ORIENTAL_LOG_TRACE( "Planned Move Predicted {} ms + {} ms Settle", plan.moveMs, plan.settleMs );
+
+	return serialWriteMultiRegister( decelRateReg, sizeof( values ) / baseRegisterByteSize_, values, sizeof( values ) );
+}
+
+/* Acceleration and Deceleration Rate Register Value For a Rate in Steps/s^2
+*   Note:  The register holds the time to change speed by 1 kHz in 0.001 ms, clamped to its 1 - 1000000 range
+*/
+uint32_t OrientalCRK525MAKD::RateRegisterValue( double hzPerS )
+{
+
+	if( hzPerS <= 1000 )
+	{
+		return 1000000;
+	}
+
+	double value = 1e9 / hzPerS;
+	return ( value < 1 ) ? 1 : static_cast< uint32_t >( value + 0.5 );
+}
+
+/* Virtual Implementation - Switches accelRateTypeReg Between Separate (Operation Data Rates) and Common
+*   Note:  A staged plan is dropped either way
+*    Returns - 0 or errCode otherwise
+*/
+int OrientalCRK525MAKD::EnableMotionPlans( bool enable )
 {
-	//Only two finite header lengths so might as well check them
-	if( rxHeaderLen != 2 && rxHeaderLen != 3 )
+
+	int errCode = serialWriteSingleRegister( accelRateTypeReg, ( enable ) ? accelRateTypeEnum16Bit::Separate : accelRateTypeEnum16Bit::Common );
+
+	MMThreadGuard guard( motionPlanLock_ );
+	nextMovePlanSet_ = false;
+	if( errCode == 0 )
 	{
-		return false;
+		motionPlansEnabled_ = enable;
 	}
 
-	OrientalCRK525MAKD::ControllerAddressType regAddress;
-	GetAddress( regAddress );
+	return errCode;
+}
 
-	return ( rxHeader[0] == regAddress ) ? true : false;
+//Virtual Implementation - Stage the Speed and Rates LoadPosBuffer() Writes With the Next Position
+void OrientalCRK525MAKD::SetNextMovePlan( const MotionPlan* plan )
+{
 
+	MMThreadGuard guard( motionPlanLock_ );
+	nextMovePlanSet_ = ( plan != nullptr );
+	if( plan != nullptr )
+	{
+		nextMovePlan_ = *plan;
+	}
 }
 
-/* Writes a Serialized Value Through the passed SerialCommFunction
-*   @param serializedValue[] = Byte Array Passed From MMDevice Object for desired value
-*   @param serializedValueLen =  Number of Defined Bytes in the array
-*   @param valueIsBigEndian = Identifies The Way the Value was packaged into Bytes before being passed
-*   @param *SerialCommFuncPtr = Pointer to the Desired Serial Communication Function Being Used
+/* Virtual Implementation - Continuous Operation on the Fwd and Rvs Bits of Cmd1 at the Jog Speed and Rate
+*   Note:  Starting, or a rate change, writes jogOperatingSpeedReg Through jogStartSpeedReg (0x230 - 0x235) in One 6 Register Multi-Write;
+*          a speed change while running is one jogOperatingSpeedReg write, so the motor ramps to it without stopping
+*   Note:  Dropping the direction bit ramps down at the jog rate, a reversal ramps down and back up in the controller
+*   Note:  The motor stays energized afterwards (the next position write restores the resting state)
+*    Returns - 0 or errCode otherwise
 */
-int OrientalCRK525MAKD::WritePosBuffer( unsigned char serializedValue[], int serializedValueLen, bool valueIsBigEndian, AbstractControllerInterface::SerialCommFuncPtr serialCommFuncPtr )
-{ 
-	int errCode = 0;
-	int typedValueIdx = 0;
+int OrientalCRK525MAKD::SetContinuousVelocity( double stepsPerSec, double accelHzPerS )
+{
 
-	//Check to See if SerializedValueLen and Register Length Coincide
-	if( serializedValueLen != posReg.getRegisterByteSize() )
-	{
-		typedValueIdx = serializedValueLen - posReg.getRegisterByteSize();
-		if( typedValueIdx < 0 ) //Undersized Value Not Accepted
-		{
-			return -1;
-		}
+	int errCode;
+	int dir = ( stepsPerSec >= 0.5 ) ? 1 : ( ( stepsPerSec <= -0.5 ) ? -1 : 0 );
 
-		//One Exception: if buffer is passed with padded 0's from something like a long
-		for( int i = 0; i < typedValueIdx; i++ )
+	if( dir == 0 )
+	{
+		if( continuousDir_ != 0 )
 		{
-			if( serializedValue[i] != 0 )
+			if( ( errCode = SendFixedFrame( FrameCmd1COn ) ) != 0 )
 			{
-				AbstractControllerInterfaceFactory::LogMessage("There is a type mismatch!");
-				return -1;
+				return errCode;
 			}
+			//Still Moving Through the Ramp-Down
+			MarkPosReadbackMoving();
 		}
+		continuousDir_ = 0;
+		return 0;
 	}
 
-	if( ( errCode = serialWriteSingleRegister( cmd1Reg, cmd1BitsEnum16Bit::M0 | cmd1BitsEnum16Bit::COn, serialCommFuncPtr ) ) != 0 )
+	double speedHz = fabs( stepsPerSec );
+	uint32_t speed = ( speedHz > 500000 ) ? 500000 : static_cast< uint32_t >( speedHz + 0.5 );
+	uint32_t rate = RateRegisterValue( accelHzPerS );
+
+	if( continuousDir_ == 0 || rate != continuousRate_ )
 	{
-		return errCode;
+		static const int numValues = 3;
+		unsigned char values[ numValues * sizeof( uint32_t ) ];
+
+		//Parameter Registers Are Big Endian
+		ReadWrite< uint32_t, true >::read( &values[0], sizeof( uint32_t ), speed );
+		ReadWrite< uint32_t, true >::read( &values[4], sizeof( uint32_t ), rate );
+		ReadWrite< uint32_t, true >::read( &values[8], sizeof( uint32_t ), ( speed < continuousStartSpeedHz_ ) ? speed : continuousStartSpeedHz_ );
+		if( ( errCode = serialWriteMultiRegister( jogOperatingSpeedReg, sizeof( values ) / baseRegisterByteSize_, values, sizeof( values ) ) ) != 0 )
+		{
+			return errCode;
+		}
+	}
+	else if( speed != continuousSpeed_ )
+	{
+		unsigned char value[ sizeof( uint32_t ) ];
+		ReadWrite< uint32_t, true >::read( value, sizeof( value ), speed );
+		if( ( errCode = serialWriteMultiRegister( jogOperatingSpeedReg, sizeof( value ) / baseRegisterByteSize_, value, sizeof( value ) ) ) != 0 )
+		{
+			return errCode;
+		}
 	}
+	continuousSpeed_ = speed;
+	continuousRate_ = rate;
 
-	
-	//Swap Values if The Data was Transported Differently Than in the Register
-	//Little Endian -> Big Endian Or Big Endian -> Little Endian
-	if( valueIsBigEndian != posReg.isBigEndianCheck() )
+	if( dir != continuousDir_ )
 	{
-		//OverSized Buffer That guarantees large transfer
-		unsigned char tempArray[MM::MaxStrLength];
-		for( int i = 0; i < serializedValueLen; ++i )
+		if( ( errCode = SendFixedFrame( ( dir > 0 ) ? FrameCmd1FwdCOn : FrameCmd1RvsCOn ) ) != 0 )
 		{
-			tempArray[i] = serializedValue[ serializedValueLen - (i+1) ];
+			return errCode;
 		}
+		continuousDir_ = dir;
+	}
 
-		//Copy Over to serializedValue
-		for( int i = 0; i < serializedValueLen; ++i )
+	//Cached Readback From Before (or Early in) the Run Must Not Outlive it
+	MarkPosReadbackMoving();
+
+	ORIENTAL_LOG_DEBUG( "Continuous Operation {} Hz, Direction {}, Rate {}", speed, dir, rate );
+
+	return 0;
+}
+
+/* Virtual Implementation - Pulses the Stop Bit of Cmd1, stopActionReg Written First if it Holds the Other Action
+*   Note:  The motor stays energized afterwards, a decelerating stop is not cut short by de-energizing
+*    Returns - 0 or errCode otherwise
+*/
+int OrientalCRK525MAKD::StopMotion( bool immediate )
+{
+
+	int errCode;
+	int action = ( immediate ) ? stopActionExpandedTypesEnum16Bit::Immediate : stopActionExpandedTypesEnum16Bit::Decelerate;
+
+	if( action != stopActionWritten_ )
+	{
+		if( ( errCode = serialWriteSingleRegister( stopActionReg, static_cast< uint16_t >( action ) ) ) != 0 )
 		{
-			serializedValue[ i ] = tempArray[ i ];
+			return errCode;
 		}
+		stopActionWritten_ = action;
+	}
 
+	if( ( errCode = SendFixedFrame( FrameCmd1StopCOn ) ) != 0 || ( errCode = SendFixedFrame( FrameCmd1COn ) ) != 0 )
+	{
+		return errCode;
 	}
+	continuousDir_ = 0;
+	//A Decelerating Stop Still Moves, and the Cached Block is From Before the Stop Either Way
+	MarkPosReadbackMoving();
 
-	/*
-	*   Send Position Packet
-	*/
+	return 0;
+}
 
-	//Create value of Register Basic Type
-	/*decltype( posReg.getVal() ) val = 0;
-	if( valueIsBigEndian )
+/* Virtual Implementation - Writes the Output's Signal Mode Register (OUT1 - OUT4)
+*   Note:  READY comes on when a positioning operation finishes, so a camera triggered on its rising edge waits for no status poll
+*   Note:  TriggerOutputDefault writes the power-on signal of the output (OUT1 AREA, OUT2 READY, OUT3 WNG, OUT4 HOME-P)
+*    Returns - 0 or errCode otherwise (-1 for an output other than 1 - 4)
+*/
+int OrientalCRK525MAKD::SetTriggerOutput( unsigned int output, TriggerOutputSignal signal )
+{
+
+	static const unsigned int numOutputs = 4;
+	AbstractRegisterBase* outputRegs[ numOutputs ] = { &out1SignalModeReg, &out2SignalModeReg, &out3SignalModeReg, &out4SignalModeReg };
+	static const signalModesEnum16Bit::stdEnum powerOnSignals[ numOutputs ] = { signalModesEnum16Bit::Area, signalModesEnum16Bit::Ready,
+																				signalModesEnum16Bit::WNG, signalModesEnum16Bit::HomeP };
+
+	if( output < 1 || output > numOutputs )
 	{
-		ReadWrite< decltype( posReg.getVal() ), true>::write( &serializedValue[ typedValueIdx ], serializedValueLen, val );
+		ORIENTAL_LOG_WARN( "No Output {} to Trigger On", output );
+		return -1;
 	}
-	else
+
+	signalModesEnum16Bit::stdEnum mode = powerOnSignals[ output - 1 ];
+	if( signal == TriggerOutputInPosition )
 	{
-		ReadWrite< decltype( posReg.getVal() ), false>::write( &serializedValue[ typedValueIdx ], serializedValueLen, val );
-	}*/
-	/*
-	std::ostringstream os;
-	for( int i = 0; i < serializedValueLen; ++i )
+		mode = signalModesEnum16Bit::Ready;
+	}
+	else if( signal == TriggerOutputArea )
 	{
-		os << "value[" << i << "] = " << (int) serializedValue[i];
+		mode = signalModesEnum16Bit::Area;
 	}
 
-	AbstractControllerInterfaceFactory::LogMessage( os.str() );*/
+	ORIENTAL_LOG_DEBUG( "Output {} Signal Mode {}", output, static_cast< unsigned int >( mode ) );
+
+	return serialWriteSingleRegister( *outputRegs[ output - 1 ], mode );
+}
+
+/* Virtual Implementation - Writes posModeReg (Absolute or Incremental)
+*   Note:  LoadPosBuffer() writes whatever it is given to posReg, so callers switch what they pass along with the mode
+*    Returns - 0 or errCode otherwise
+*/
+int OrientalCRK525MAKD::SetAbsolutePositioning( bool absolute )
+{
 
-	if( ( errCode = serialWriteMultiRegister( posReg, posReg.getRegisterByteSize()/baseRegisterByteSize_, serializedValue, serializedValueLen ) ) != 0 )
+	int errCode = serialWriteSingleRegister( posModeReg, ( absolute ) ? positioningModeEnum16Bit::Absolute : positioningModeEnum16Bit::Incremental );
+	if( errCode == 0 )
 	{
-		return errCode;
+		absolutePositioning_ = absolute;
 	}
 
+	return errCode;
+}
 
-	/* 
-	*  Send Start Command 
-	*/
+/* Virtual Implementation - Writes area1Reg and area2Reg in One 4 Register Multi-Write
+*   Note:  AREA is on while the command position is from area1Reg to area2Reg, so the window is written in ascending order
+*    Returns - 0 or errCode otherwise (-2 for a position outside the registers' range)
+*/
+int OrientalCRK525MAKD::SetTriggerWindow( long fromSteps, long toSteps )
+{
 
-	if( ( errCode = serialWriteSingleRegister( cmd1Reg, cmd1BitsEnum16Bit::Start | cmd1BitsEnum16Bit::M0 | cmd1BitsEnum16Bit::COn, serialCommFuncPtr ) ) != 0 )
-	{
-		return errCode;
-	}
-	
-	//Check Code Will Be implemented in WritePosBuffer()
+	unsigned char values[ 2 * sizeof( int32_t ) ];
+	int32_t low = static_cast< int32_t >( ( fromSteps < toSteps ) ? fromSteps : toSteps );
+	int32_t high = static_cast< int32_t >( ( fromSteps < toSteps ) ? toSteps : fromSteps );
 
-	return 0; 
+	//Parameter Registers Are Big Endian
+	ReadWrite< int32_t, true >::read( &values[0], sizeof( int32_t ), low );
+	ReadWrite< int32_t, true >::read( &values[4], sizeof( int32_t ), high );
 
-};
+	ORIENTAL_LOG_TRACE( "Trigger Window {} to {} Steps", low, high );
+
+	return serialWriteMultiRegister( area1Reg, sizeof( values ) / baseRegisterByteSize_, values, sizeof( values ) );
+}
 
 /* Vitrual Implementation -Writes a Serialized Value For Step Speed to Motor Step Speed Register
 *   Note:  Assumes SerializedSpeedValue is BigEndian and expects WriteStepSpeed() to be public Implementation
@@ -535,7 +1494,7 @@ int OrientalCRK525MAKD::WriteStepSpeedBuffer( unsigned char serializedSpeedValue
 		{
 			if( serializedSpeedValue[i] != 0 )
 			{
-				AbstractControllerInterfaceFactory::LogMessage("There is a type mismatch!");
+				ORIENTAL_LOG_WARN( "Speed Value Type Mismatch, {} Bytes", speedValueLen );
 				return -1;
 			}
 		}
@@ -563,9 +1522,7 @@ void OrientalCRK525MAKD::SetRestingHardwareEnergizedImpl( bool energyOn ) {
 
 	int errCode = 0;
 
-	cmd1BitsEnum16Bit::EnumBaseType cOnBit = static_cast<cmd1BitsEnum16Bit::EnumBaseType>( ( energyOn ) ? cmd1BitsEnum16Bit::COn : 0 );
-
-	if( ( errCode = serialWriteSingleRegister( cmd1Reg, cOnBit ) ) != 0 ) {
+	if( ( errCode = SendFixedFrame( ( energyOn ) ? FrameCmd1COn : FrameCmd1Off ) ) != 0 ) {
 		throw MMErrorCodeException( errCode, "Failure in GetHardWareEnergizedImpl" );
 	}
 
@@ -580,7 +1537,7 @@ bool OrientalCRK525MAKD::GetRestingHardwareEnergizedImpl( ) {
 
 	int errCode; 
 
-	if( (errCode = ReadRegisters( &DriverStatusReg, DriverStatusReg.getRegisterByteSize() ) ) != 0 ) {
+	if( (errCode = SendFixedFrame( FrameDriverStatusRead ) ) != 0 ) {
 		throw MMErrorCodeException( errCode, "Failure in GetHardWareEnergizedImpl" );
 	}
 
@@ -600,27 +1557,20 @@ int OrientalCRK525MAKD::IsMotorBusy( void ) {
 
 	int errCode = 0;
 
-	std::ostringstream os;
-
-	if( (errCode = ReadRegisters( &status1Reg, 1 ) ) != 0 )
+	//Busy Must Be Live, but the Same Read Refreshes the Cached Position Readback
+	if( (errCode = ReadMonitorBlock( true ) ) != 0 )
 	{
-		os << "The errCode Was " << (int) errCode;
-		AbstractControllerInterfaceFactory::LogMessage( os.str() );
+		ORIENTAL_LOG_WARN( "Busy Check Failed With {}", errCode );
 		return errCode;
 	}
 
-	decltype( status1Reg.getVal() )	val = status1Reg.getVal();
+	decltype( IOStatusReg.getVal() ) val = IOStatusReg.getVal();
 
-	os << "The value is " << (int) val;
-	os << "\n the Boolean Move " << (int) (status1BitsEnum16Bit::Move & val);
-	os << "\n the Boolean Ready " << (int) (status1BitsEnum16Bit::Ready & val);
-	AbstractControllerInterfaceFactory::LogMessage( os.str() );
-
-	//Compare val to MOVE and READY 
-	//After Testing, The Ready Bit Does Not Seem To Indicate AnyThing (Is always 0)
-	if( (status1BitsEnum16Bit::Move & val) != 0 )
+	//Compare val to MOVE Output
+	//Note: status1Reg Ready Bit Does Not Seem To Indicate AnyThing (Is always 0), MOVE is Mirrored in IOStatusReg
+	if( (IOStatusBitsEnum32Bit::Move & val) != 0 )
 	{
-		AbstractControllerInterfaceFactory::LogMessage( "Something Was Busy" );
+		ORIENTAL_LOG_TRACE( "Motor Busy, IO Status {x}", (unsigned long) val );
 		return 1;
 	}
 	
@@ -645,9 +1595,7 @@ int OrientalCRK525MAKD::PermitPosWriteImpl( void ) {
 	int errCode;
 
 	//Determine Whether or Not To Keep Energized at the end
-	cmd1BitsEnum16Bit::EnumBaseType cOnBit = static_cast< cmd1BitsEnum16Bit::EnumBaseType >( ( GetRestingHardwareEnergized( false ) ) ? cmd1BitsEnum16Bit::COn : 0 );
-
-	if( ( errCode = serialWriteSingleRegister( cmd1Reg, cmd1BitsEnum16Bit::M0 | cOnBit ) ) != 0 )
+	if( ( errCode = SendFixedFrame( ( GetRestingHardwareEnergized( false ) ) ? FrameCmd1M0COn : FrameCmd1M0 ) ) != 0 )
 	{
 		return errCode;
 	}
@@ -688,11 +1636,9 @@ int OrientalCRK525MAKD::parseData( const unsigned char txMsgBuffer[], const int
 	unsigned int compCRC = crcCompute( rxBuffer, rxBufLen - 2 );
 	unsigned int msgCRC = (rxBuffer[ rxBufLen - 1 ] << 8) | rxBuffer[ rxBufLen - 2 ];
 	int errCode;
-	std::ostringstream os;
-	os << "Comp: " << compCRC << "\nMsg: " << msgCRC;
-	AbstractControllerInterfaceFactory::LogMessage(  os.str() );
 	if( msgCRC != compCRC )
 	{
+		ORIENTAL_LOG_WARN( "Response CRC Mismatch, Computed {x} Received {x}", compCRC, msgCRC );
 		//Return Error Code, Data Corruption
 		errCode = 1;
 		return errCode;
@@ -702,7 +1648,7 @@ int OrientalCRK525MAKD::parseData( const unsigned char txMsgBuffer[], const int
 	{
 		//Return the Error Code
 		//Need additional Logic to produce ERRs for MM
-		AbstractControllerInterfaceFactory::LogMessage(  "Actual Error" );
+		ORIENTAL_LOG_WARN( "Exception Response, Function {x} Code {x}", (unsigned int) rxBuffer[1], (unsigned int) rxBuffer[2] );
 		errCode = rxBuffer[2];
 		return errCode;
 	}
@@ -725,13 +1671,9 @@ int OrientalCRK525MAKD::parseData( const unsigned char txMsgBuffer[], const int
 				break;
 			case functionCodes::multipleRegisterWrite:
 				//For readabilty use other function
-				AbstractControllerInterfaceFactory::LogMessage(  "Multiple Write Response" );
 				errCode = onMultipleRegisterWriteResponse( txMsgBuffer, txMsgLen, rxBuffer, rxBufLen );
 				break;
 			case functionCodes::registerWrite:
-				AbstractControllerInterfaceFactory::LogMessage(  "Single Write Response" );
-					os << "The large byte is " << (int) rxBuffer[2] << " and small is " << (int) rxBuffer[3] << "\n";
-					AbstractControllerInterfaceFactory::LogMessage(  os.str() );
 				errCode = onSingleRegisterWriteResponse( txMsgBuffer, txMsgLen, rxBuffer, rxBufLen );				
 				break;
 			case functionCodes::registerRead:
@@ -746,6 +1688,50 @@ int OrientalCRK525MAKD::parseData( const unsigned char txMsgBuffer[], const int
 	return errCode;
 }
 
+bool OrientalCRK525MAKD::isCorruptResponse( const unsigned char rxBuffer[], const int rxBufLen )
+{
+	if( rxBufLen < 4 )
+	{
+		return true;
+	}
+
+	return crcCompute( rxBuffer, rxBufLen - 2 ) != static_cast< uint32_t >( ( rxBuffer[ rxBufLen - 1 ] << 8 ) | rxBuffer[ rxBufLen - 2 ] );
+}
+
+bool OrientalCRK525MAKD::isExceptionResponse( const unsigned char rxBuffer[], const int rxBufLen )
+{
+	return rxBufLen >= 2 && ( rxBuffer[1] & g_exceptionBase ) != 0;
+}
+
+/* Virtual Implementation - Reads, Diagnosis and Register Writes, Except Writes Reaching posReg or cmd1Reg in Incremental Mode
+*   Note:  A write sets register values, so repeating it changes nothing; Execute and Start bits act on edges, which a repeat does not make
+*   Note:  Writes of a relative move are still held back, as a move sent again in incremental mode could move twice;
+*          in absolute mode the same target is sent again
+*/
+bool OrientalCRK525MAKD::isIdempotentRequest( const unsigned char txMsgBuffer[], const int txMsgBufLen )
+{
+	if( txMsgBufLen < 6 )
+	{
+		return false;
+	}
+
+	unsigned char functionCode = txMsgBuffer[1];
+	if( functionCode == functionCodes::registerRead || functionCode == functionCodes::diagnose )
+	{
+		return true;
+	}
+	if( functionCode != functionCodes::registerWrite && functionCode != functionCodes::multipleRegisterWrite )
+	{
+		return false;
+	}
+
+	uint32_t startAddress = static_cast< uint32_t >( ( txMsgBuffer[2] << 8 ) | txMsgBuffer[3] );
+	uint32_t numRegs = ( functionCode == functionCodes::multipleRegisterWrite ) ? static_cast< uint32_t >( ( txMsgBuffer[4] << 8 ) | txMsgBuffer[5] ) : 1;
+	bool movesMotor = startAddress <= cmd1Reg.getAddress() && startAddress + numRegs > posReg.getAddress();
+
+	return movesMotor == false || absolutePositioning_;
+}
+
 /*
 *
 *  Private Controller Specific Data Parsing Functions
@@ -757,9 +1743,10 @@ int OrientalCRK525MAKD::parseData( const unsigned char txMsgBuffer[], const int
 *   @param numRegs - number of registers to write in total
 *   @param valueArray[] - Byte array of already parsed Values (most likely using ReadWrite< decltype( register), isBigEndian::read()
 *   @param valueArraySize - Size of the Defined Bytes in the Array to be passed along
+*   @param broadcast - address the request to slave 0 (every slave writes it, none answers)
 *   Returns - 0 on completion or errorCodes otherwise
 */
-int OrientalCRK525MAKD::serialWriteMultiRegister( AbstractRegisterBase &startReg, unsigned int numRegs, unsigned char valueArray[], int valueArraySize ) {
+int OrientalCRK525MAKD::serialWriteMultiRegister( AbstractRegisterBase &startReg, unsigned int numRegs, unsigned char valueArray[], int valueArraySize, bool broadcast ) {
 
 			unsigned char packet[maxWritePacketbytes_];
 			int currentByte = 0;
@@ -768,16 +1755,8 @@ int OrientalCRK525MAKD::serialWriteMultiRegister( AbstractRegisterBase &startReg
 			int errCode = 0;
 			baseAddressType addr;
 
-			std::ostringstream os2;
-			os2 << " The Value Packet is ";
-			for( int i = 0; i < valueArraySize; i++ )
-			{
-				os2 << (int) valueArray[i] << "\n";
-			}
-			AbstractControllerInterfaceFactory::LogMessage( os2.str() );
-
+			ORIENTAL_LOG_DEBUG( "Multi-Write {} Registers, Values {}", numRegs, ORIENTAL_LOG_BYTES( valueArray, valueArraySize ) );
 
-			AbstractControllerInterfaceFactory::LogMessage( "Value Size Check" );
 			//Verify valueArray Accounts for Number of Buffer Values
 			if( valueArraySize != numRegs*2 )
 			{
@@ -785,9 +1764,16 @@ int OrientalCRK525MAKD::serialWriteMultiRegister( AbstractRegisterBase &startReg
 				throw 1;
 			}
 
-			AbstractControllerInterfaceFactory::LogMessage( "Slave Address" );
-			//Controller Slave Address
-			numBytesWritten = getAddressBuffer( packet, 1 );
+			//Controller Slave Address (0 For a Broadcast)
+			if( broadcast )
+			{
+				memset( packet, 0, sizeof( ControllerAddressType ) );
+				numBytesWritten = sizeof( ControllerAddressType );
+			}
+			else
+			{
+				numBytesWritten = getAddressBuffer( packet, 1 );
+			}
 			if( numBytesWritten == -1 )  
 			{
 				//The Buffer must have been too small
@@ -799,7 +1785,6 @@ int OrientalCRK525MAKD::serialWriteMultiRegister( AbstractRegisterBase &startReg
 			packet[currentByte] =  functionCodes::multipleRegisterWrite;
 			currentByte += sizeof( functionCodes::multipleRegisterWrite );
 
-			AbstractControllerInterfaceFactory::LogMessage( "Register Address" );
 			//Register Address
 			numBytesWritten = startReg.readAddress( &packet[currentByte],  maxWritePacketbytes_ - currentByte );
 			if( numBytesWritten == -1 ) 
@@ -827,14 +1812,10 @@ int OrientalCRK525MAKD::serialWriteMultiRegister( AbstractRegisterBase &startReg
 
 			AbstractRegisterBase* reg = &startReg;
 			
-			AbstractControllerInterfaceFactory::LogMessage( "Value Array" );
 			//Check Value Array Against Corresponding Registers and place in packet
 			for( int i = 0, valueIdx = 0; i < numRegs; )
 			{
-				std::ostringstream os;
-				os << "Address: " << addr << "\n";
-				os << "This is the index " << i;
-				AbstractControllerInterfaceFactory::LogMessage( os.str() );
+				ORIENTAL_LOG_TRACE( "Multi-Write Register {x}", (unsigned int) ( addr + i ) );
 				//Select non-start Registers
 				if( i != 0 ) 
 				{
@@ -884,7 +1865,7 @@ int OrientalCRK525MAKD::serialWriteMultiRegister( AbstractRegisterBase &startReg
 			currentByte += numBytesWritten;
 
 			//Communicate With Controller
-			if( ( errCode = ( retrieveSerialCommHubPtr()->*retrieveSerialCommFuncPtr() )( packet, currentByte, this, false ) ) != DEVICE_OK )
+			if( ( errCode = ( retrieveSerialCommHubPtr()->*retrieveSerialCommFuncPtr() )( packet, currentByte, this, broadcast ) ) != DEVICE_OK )
 			{
 				//Register Was not Written
 				return errCode;
@@ -974,17 +1955,11 @@ int OrientalCRK525MAKD::onMultipleRegisterWriteResponse( const unsigned char txM
 
 	int errCode;
 
-	std::ostringstream os2;
-	os2 << "The RX Packet is: \n";
-	for( int i = 0; i < rxBufLen; i++)
-	{
-		os2 << (int) rxBuffer[i] << "\n";
-	}
-	AbstractControllerInterfaceFactory::LogMessage(  os2.str() );
+	ORIENTAL_LOG_DEBUG( "Multi-Write Response {}", ORIENTAL_LOG_BYTES( rxBuffer, rxBufLen ) );
 	//Verify Register Address Number Written is the same
 	if( txMsgBuffer[2] != rxBuffer[2] || txMsgBuffer[3] != rxBuffer[3] || txMsgBuffer[4] != rxBuffer[4] || txMsgBuffer[5] != rxBuffer[5] )
 	{
-		AbstractControllerInterfaceFactory::LogMessage(  "Bad Data Response" );
+		ORIENTAL_LOG_WARN( "Multi-Write Response Does Not Match Request" );
 		//error data corruption
 		return 1;
 	}
@@ -999,13 +1974,10 @@ int OrientalCRK525MAKD::onMultipleRegisterWriteResponse( const unsigned char txM
 
 	for( uint16_t i = 7; i < numRegsWritten + 7; )
 	{
-			std::ostringstream os;
-			os << "current Register is " << startRegAddress + i - 7;
-			AbstractControllerInterfaceFactory::LogMessage(  os.str() );
 		reg = GetRegisterByAddress( startRegAddress + i - 7 );
 		if( reg == nullptr )
 		{
-			AbstractControllerInterfaceFactory::LogMessage(  "Nullptr Returned" );
+			ORIENTAL_LOG_ERROR( "Multi-Write Response For Unregistered Register {x}", (unsigned int) ( startRegAddress + i - 7 ) );
 			//Log Fatal Error: Unregistered Register Written
 			return 1;
 		}
@@ -1036,10 +2008,7 @@ int OrientalCRK525MAKD::onSingleRegisterWriteResponse( const unsigned char txMsg
 
 	//Composite Address and number written
 	uint16_t startRegAddress = (rxBuffer[2] << 8) | rxBuffer[3];
-	std::ostringstream os;
-	os << "The large byte is " << (int) rxBuffer[2] << " and small is " << rxBuffer[3] << "\n";
-	os << " The Register Address is supposed to be " << startRegAddress << "\n";
-	AbstractControllerInterfaceFactory::LogMessage(  os.str() );
+	ORIENTAL_LOG_DEBUG( "Single Write Response For Register {x}", (unsigned int) startRegAddress );
 	AbstractRegisterBase* reg = GetRegisterByAddress( startRegAddress );
 	assert( reg != nullptr);
 
@@ -1069,44 +2038,196 @@ int OrientalCRK525MAKD::onRegisterRead( const unsigned char txMsgBuffer[], const
 		return 1;
 	}
 
-	std::ostringstream os;
-	os << "RXMessage is:\n ";
-	for( int i = 0; i< rxBufLen; i++)
-	{
-		os << "[" << i << "] = " << (unsigned int) rxBuffer[i] << "\n";
-	}
-	AbstractControllerInterfaceFactory::LogMessage( os.str() );
+	ORIENTAL_LOG_DEBUG( "Register Read Response {}", ORIENTAL_LOG_BYTES( rxBuffer, rxBufLen ) );
 
-	AbstractRegisterBase* reg = GetRegisterByAddress( startRegisterAddress );
+	AbstractRegisterBase* reg;
 	int registerSize;
 	
+	//i Counts Data Bytes, Register Addresses Advance Once Per baseRegisterByteSize_
 	for( int i = 0; i < numDataBytes; )
 	{
+		reg = GetRegisterByAddress( startRegisterAddress + i/baseRegisterByteSize_ );
+		//Unregistered Addresses Inside a Coalesced Read are Gaps and are Discarded
+		if( reg == nullptr )
+		{
+			i += baseRegisterByteSize_;
+			continue;
+		}
+
 		//Check to See if the Register Being Written is A combination
 		registerSize = reg->getRegisterByteSize();
-		int multiplier = registerSize / baseRegisterByteSize_;
-		if( registerSize > baseRegisterByteSize_)
+		if( (registerSize % baseRegisterByteSize_) != 0 )
 		{
-			if( (registerSize % baseRegisterByteSize_) != 0 )
-			{
-				//Error, Register Being Read To is nonMultiple of Controller Type;
-				return 2;
-			}
-			else if ( multiplier + i >= numDataBytes )  
-			{
-				//Error, Somehow we read half a RegisterCombination (Should be illegal)
-				return 3;
-			}
+			//Error, Register Being Read To is nonMultiple of Controller Type;
+			return 2;
+		}
+		else if ( i + registerSize > numDataBytes )  
+		{
+			//Error, Somehow we read half a RegisterCombination (Should be illegal)
+			return 3;
 		}
 
-		std::ostringstream os2;
-		os2 << " The value is projected to be " << (((unsigned int) rxBuffer[i+1]) | ( rxBuffer[i] << 8 ));
-		AbstractControllerInterfaceFactory::LogMessage( os2.str() );
-		reg->write(	&rxBuffer[dataStartByte + i], baseRegisterByteSize_ * multiplier );
-		i += baseRegisterByteSize_ * multiplier;
-		reg = GetRegisterByAddress( startRegisterAddress + i );
+		reg->write(	&rxBuffer[dataStartByte + i], registerSize );
+		i += registerSize;
 	}
 
+	RecordTelemetry( TelemetryRegisterBlock, static_cast< uint16_t >( startRegisterAddress ), &rxBuffer[dataStartByte], numDataBytes );
+
 	return 0;
 	
 }
+
+/* Append Register Bytes to the Hub's Telemetry Recording (No-op While the Hub is Not Recording)
+*   @param kind - TelemetryRecordKind
+*   @param startRegister - address of the first register in registerBytes
+*   @param registerBytes[] - register bytes as transferred on the line
+*   @param numBytes - number of bytes in registerBytes
+*/
+void OrientalCRK525MAKD::RecordTelemetry( uint8_t kind, uint16_t startRegister, const unsigned char registerBytes[], unsigned int numBytes ) {
+
+	TelemetryRecorder& recorder = retrieveSerialCommHubPtr()->GetTelemetryRecorder();
+
+	if( recorder.IsOpen() == false )
+	{
+		return;
+	}
+
+	OrientalCRK525MAKD::ControllerAddressType slaveAddress;
+	GetAddress( slaveAddress );
+
+	recorder.Record( kind, static_cast< uint8_t >( slaveAddress ), startRegister, registerBytes, numBytes, GetMoveId() );
+
+}
+
+/* Reads Position From the Cached Monitor Block, Refreshing it Through Serial Request if Stale
+*   Note:  Serializes EncodeCounterReg if GetEncoderReadback() is set, otherwise CommandPosReg
+*   @param readBuffer[] - Buffer to Return BigEndian Byte Ordered Position Value
+*   @param bufferSize - Size of the Buffer Passed
+*   Returns - Number of Bytes Defined in Buffer, -1 if buffer size if too small, or negated errCode of the read
+*/
+int OrientalCRK525MAKD::ReadPosBuffer( unsigned char readBuffer[], int bufferSize ) {
+
+	int errCode = 0;
+
+	if( bufferSize < CommandPosReg.getRegisterByteSize() )
+	{
+		return -1;
+	}
+
+	if( ( errCode = ReadMonitorBlock() ) != 0 )
+	{
+		return ( errCode > 0 ) ? -errCode : errCode;
+	}
+
+	MMThreadGuard guard( monitorBlockLock_ );
+
+	if( GetEncoderReadback() )
+	{
+		return EncodeCounterReg.read( readBuffer, bufferSize );
+	}
+
+	return CommandPosReg.read( readBuffer, bufferSize );
+
+}
+
+/* Discard the Cached Monitor Block So the Next ReadPosBuffer() Queries the Controller
+*/
+void OrientalCRK525MAKD::InvalidatePosReadback( void ) {
+
+	MMThreadGuard guard( monitorBlockLock_ );
+	monitorBlockValid_ = false;
+
+}
+
+/* Discard the Cached Monitor Block After a Start or Stop Command Was Accepted
+*   Note:  Takes monitorBlockLock_, so a block read in flight finishes first and is discarded with the rest
+*/
+void OrientalCRK525MAKD::MarkPosReadbackMoving( void ) {
+
+	MMThreadGuard guard( monitorBlockLock_ );
+	monitorBlockValid_ = false;
+	monitorBlockStartMs_ = CAlternativeUtils::GetMonotonicTimeMs();
+
+}
+
+/* Virtual Implementation - One cmd1 Start to Slave Address 0
+*   Note:  Only this axis' readback is marked moving, the caller marks the other axes the broadcast reached
+*/
+int OrientalCRK525MAKD::BroadcastStart( void ) {
+
+	int errCode;
+
+	if( ( errCode = SendFixedFrame( FrameBroadcastStart ) ) != 0 )
+	{
+		return errCode;
+	}
+	MarkPosReadbackMoving();
+
+	return 0;
+
+}
+
+/* Read the Monitor Block (CommandPosReg Through IOStatusReg) in One Serial Transaction
+*   Note:  Returns Without Serial Communication if the Cached Block is Fresh
+*          A Block Read While Resting Stays Fresh Until InvalidatePosReadback(),
+*          A Block Read During a Move (or Within moveOutputLagMS_ of MarkPosReadbackMoving()) Expires After GetReadbackMaxAgeMS()
+*   @param forceRead - Always Query the Controller
+*   Returns - 0 on completion or errorCodes otherwise
+*/
+int OrientalCRK525MAKD::ReadMonitorBlock( bool forceRead ) {
+
+	MMThreadGuard guard( monitorBlockLock_ );
+
+	int errCode = 0;
+	double now = CAlternativeUtils::GetMonotonicTimeMs();
+
+	if( forceRead == false && monitorBlockValid_ == true )
+	{
+		//Resting Values Only Change With a Write, Moving Values Age Out
+		if( monitorBlockMoving_ == false || ( now - monitorBlockReadTimeMs_ ) < GetReadbackMaxAgeMS() )
+		{
+			return 0;
+		}
+	}
+
+	monitorBlockValid_ = false;
+
+	if( ( errCode = SendFixedFrame( FrameMonitorBlockRead ) ) != 0 )
+	{
+		return errCode;
+	}
+
+	//MOVE May Still be Off Right After a Start, Such a Block Must Not Stay Fresh Like a Resting One
+	monitorBlockMoving_ = ( ( IOStatusBitsEnum32Bit::Move & IOStatusReg.getVal() ) != 0 ) || ( now - monitorBlockStartMs_ ) < moveOutputLagMS_;
+	monitorBlockReadTimeMs_ = now;
+	monitorBlockValid_ = true;
+
+	return 0;
+
+}
+
+/* Read the Monitor Block Into One Timestamped Telemetry Sample
+*   Note:  Forces a serial read, which also refreshes the cached position readback
+*   @param sample - Filled With the Values Read
+*   Returns - 0 on completion or errorCodes otherwise
+*/
+int OrientalCRK525MAKD::ReadMotionTelemetry( MotionTelemetrySample& sample ) {
+
+	int errCode = 0;
+
+	if( ( errCode = ReadMonitorBlock( true ) ) != 0 )
+	{
+		return errCode;
+	}
+
+	MMThreadGuard guard( monitorBlockLock_ );
+
+	sample.timeMs = monitorBlockReadTimeMs_;
+	sample.commandPos = CommandPosReg.getVal();
+	sample.commandSpeed = CommandSpeedReg.getVal();
+	sample.encoderCount = EncodeCounterReg.getVal();
+	sample.ioStatus = static_cast< uint32_t >( IOStatusReg.getVal() );
+
+	return 0;
+
+}
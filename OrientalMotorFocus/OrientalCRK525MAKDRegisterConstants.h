@@ -493,11 +493,12 @@ class cmd1BitsEnum : public BitMaskEnumWrapper< cmd1BitsEnum< EnumeratedBaseType
 
 };
 typedef cmd1BitsEnum< uint16_t > cmd1BitsEnum16Bit;
-const cmd1BitsEnum16Bit::stdEnum cmd1BitsEnum16Bit::bitSelectorArray_[] = { cmd1BitsEnum16Bit::M0,
-						cmd1BitsEnum16Bit::M1, cmd1BitsEnum16Bit::M2, cmd1BitsEnum16Bit::M3, cmd1BitsEnum16Bit:: M4, 
-						cmd1BitsEnum16Bit::M5, cmd1BitsEnum16Bit::OpDataNumberMask, cmd1BitsEnum16Bit::Start, 
-						cmd1BitsEnum16Bit::Fwd, cmd1BitsEnum16Bit::Rvs,	cmd1BitsEnum16Bit::Home, 
-						cmd1BitsEnum16Bit::Stop, cmd1BitsEnum16Bit::COn };
+template< typename EnumeratedBaseType >
+const typename cmd1BitsEnum< EnumeratedBaseType >::stdEnum cmd1BitsEnum< EnumeratedBaseType >::bitSelectorArray_[] = { cmd1BitsEnum< EnumeratedBaseType >::M0,
+						cmd1BitsEnum< EnumeratedBaseType >::M1, cmd1BitsEnum< EnumeratedBaseType >::M2, cmd1BitsEnum< EnumeratedBaseType >::M3, cmd1BitsEnum< EnumeratedBaseType >:: M4, 
+						cmd1BitsEnum< EnumeratedBaseType >::M5, cmd1BitsEnum< EnumeratedBaseType >::OpDataNumberMask, cmd1BitsEnum< EnumeratedBaseType >::Start, 
+						cmd1BitsEnum< EnumeratedBaseType >::Fwd, cmd1BitsEnum< EnumeratedBaseType >::Rvs,	cmd1BitsEnum< EnumeratedBaseType >::Home, 
+						cmd1BitsEnum< EnumeratedBaseType >::Stop, cmd1BitsEnum< EnumeratedBaseType >::COn };
 HEADER_DECLARE_ENUM_CLASS_BINARY_OPERATORS( cmd1BitsEnum16Bit );
 
 //Cmd2 Register Enumerated Bits
@@ -522,8 +523,9 @@ class cmd2BitsEnum : public BitMaskEnumWrapper< cmd2BitsEnum< EnumeratedBaseType
 
 };
 typedef cmd2BitsEnum< uint16_t > cmd2BitsEnum16Bit;
-const cmd2BitsEnum16Bit::stdEnum cmd2BitsEnum16Bit::bitSelectorArray_[] = { cmd2BitsEnum16Bit::ROut1,
-	cmd2BitsEnum16Bit::ROut2, cmd2BitsEnum16Bit::ROut3, cmd2BitsEnum16Bit::ROut4 };
+template< typename EnumeratedBaseType >
+const typename cmd2BitsEnum< EnumeratedBaseType >::stdEnum cmd2BitsEnum< EnumeratedBaseType >::bitSelectorArray_[] = { cmd2BitsEnum< EnumeratedBaseType >::ROut1,
+	cmd2BitsEnum< EnumeratedBaseType >::ROut2, cmd2BitsEnum< EnumeratedBaseType >::ROut3, cmd2BitsEnum< EnumeratedBaseType >::ROut4 };
 HEADER_DECLARE_ENUM_CLASS_BINARY_OPERATORS( cmd2BitsEnum16Bit );
 
 //Status 1 Register Enumerated Bits
@@ -559,11 +561,12 @@ class status1BitsEnum : public BitMaskEnumWrapper< status1BitsEnum< EnumeratedBa
 
 };
 typedef status1BitsEnum< uint16_t > status1BitsEnum16Bit;
-const status1BitsEnum16Bit::stdEnum status1BitsEnum16Bit::bitSelectorArray_[] = { status1BitsEnum16Bit::M0_R,
-	status1BitsEnum16Bit::M1_R, status1BitsEnum16Bit::M2_R, status1BitsEnum16Bit::M3_R, status1BitsEnum16Bit::M4_R,
-	status1BitsEnum16Bit::M5_R, status1BitsEnum16Bit::OpDataNumberMask_R, status1BitsEnum16Bit::Wng, status1BitsEnum16Bit::Alm, 
-	status1BitsEnum16Bit::Start_R, status1BitsEnum16Bit::StepOut, status1BitsEnum16Bit::Move, status1BitsEnum16Bit::HomeP,
-	status1BitsEnum16Bit::Ready, status1BitsEnum16Bit::Area };
+template< typename EnumeratedBaseType >
+const typename status1BitsEnum< EnumeratedBaseType >::stdEnum status1BitsEnum< EnumeratedBaseType >::bitSelectorArray_[] = { status1BitsEnum< EnumeratedBaseType >::M0_R,
+	status1BitsEnum< EnumeratedBaseType >::M1_R, status1BitsEnum< EnumeratedBaseType >::M2_R, status1BitsEnum< EnumeratedBaseType >::M3_R, status1BitsEnum< EnumeratedBaseType >::M4_R,
+	status1BitsEnum< EnumeratedBaseType >::M5_R, status1BitsEnum< EnumeratedBaseType >::OpDataNumberMask_R, status1BitsEnum< EnumeratedBaseType >::Wng, status1BitsEnum< EnumeratedBaseType >::Alm, 
+	status1BitsEnum< EnumeratedBaseType >::Start_R, status1BitsEnum< EnumeratedBaseType >::StepOut, status1BitsEnum< EnumeratedBaseType >::Move, status1BitsEnum< EnumeratedBaseType >::HomeP,
+	status1BitsEnum< EnumeratedBaseType >::Ready, status1BitsEnum< EnumeratedBaseType >::Area };
 HEADER_DECLARE_ENUM_CLASS_BINARY_OPERATORS( status1BitsEnum16Bit );
 
 //Status 2 Register Enumerated Bits
@@ -588,8 +591,9 @@ class status2BitsEnum : public BitMaskEnumWrapper< status2BitsEnum< EnumeratedBa
 
 };
 typedef status2BitsEnum< uint16_t > status2BitsEnum16Bit;
-const status2BitsEnum16Bit::stdEnum status2BitsEnum16Bit::bitSelectorArray_[] = { status2BitsEnum16Bit::SBsy,
-	status2BitsEnum16Bit::Enable, status2BitsEnum16Bit::OH, status2BitsEnum16Bit::Tim, status2BitsEnum16Bit::Zsg };
+template< typename EnumeratedBaseType >
+const typename status2BitsEnum< EnumeratedBaseType >::stdEnum status2BitsEnum< EnumeratedBaseType >::bitSelectorArray_[] = { status2BitsEnum< EnumeratedBaseType >::SBsy,
+	status2BitsEnum< EnumeratedBaseType >::Enable, status2BitsEnum< EnumeratedBaseType >::OH, status2BitsEnum< EnumeratedBaseType >::Tim, status2BitsEnum< EnumeratedBaseType >::Zsg };
 HEADER_DECLARE_ENUM_CLASS_BINARY_OPERATORS( status2BitsEnum16Bit );
 
 
@@ -644,13 +648,14 @@ class driverStatusBitsEnum : public BitMaskEnumWrapper< driverStatusBitsEnum< En
 
 };
 typedef driverStatusBitsEnum< uint32_t > driverStatusBitsEnum32Bit;
-const driverStatusBitsEnum32Bit::stdEnum driverStatusBitsEnum32Bit::bitSelectorArray_[] = { driverStatusBitsEnum32Bit::Move,
-	driverStatusBitsEnum32Bit::HomeP, driverStatusBitsEnum32Bit::Ready, driverStatusBitsEnum32Bit::SBusy, driverStatusBitsEnum32Bit::Area, 
-	driverStatusBitsEnum32Bit::Alm, driverStatusBitsEnum32Bit::Enable, driverStatusBitsEnum32Bit::Wng, driverStatusBitsEnum32Bit::StepOut,
-	driverStatusBitsEnum32Bit::LsPos, driverStatusBitsEnum32Bit::LsNeg, driverStatusBitsEnum32Bit::Slit, driverStatusBitsEnum32Bit::Homes,
-	driverStatusBitsEnum32Bit::OH, driverStatusBitsEnum32Bit::Start_R, 	driverStatusBitsEnum32Bit::M0_R, driverStatusBitsEnum32Bit::M1_R,
-	driverStatusBitsEnum32Bit::M2_R, driverStatusBitsEnum32Bit::M3_R, driverStatusBitsEnum32Bit::M4_R, driverStatusBitsEnum32Bit::M5_R,
-	driverStatusBitsEnum32Bit::OpDataNumberMask_R, driverStatusBitsEnum32Bit::Tim, driverStatusBitsEnum32Bit::ZSG, driverStatusBitsEnum32Bit::AlarmCode };
+template< typename EnumeratedBaseType >
+const typename driverStatusBitsEnum< EnumeratedBaseType >::stdEnum driverStatusBitsEnum< EnumeratedBaseType >::bitSelectorArray_[] = { driverStatusBitsEnum< EnumeratedBaseType >::Move,
+	driverStatusBitsEnum< EnumeratedBaseType >::HomeP, driverStatusBitsEnum< EnumeratedBaseType >::Ready, driverStatusBitsEnum< EnumeratedBaseType >::SBusy, driverStatusBitsEnum< EnumeratedBaseType >::Area, 
+	driverStatusBitsEnum< EnumeratedBaseType >::Alm, driverStatusBitsEnum< EnumeratedBaseType >::Enable, driverStatusBitsEnum< EnumeratedBaseType >::Wng, driverStatusBitsEnum< EnumeratedBaseType >::StepOut,
+	driverStatusBitsEnum< EnumeratedBaseType >::LsPos, driverStatusBitsEnum< EnumeratedBaseType >::LsNeg, driverStatusBitsEnum< EnumeratedBaseType >::Slit, driverStatusBitsEnum< EnumeratedBaseType >::Homes,
+	driverStatusBitsEnum< EnumeratedBaseType >::OH, driverStatusBitsEnum< EnumeratedBaseType >::Start_R, 	driverStatusBitsEnum< EnumeratedBaseType >::M0_R, driverStatusBitsEnum< EnumeratedBaseType >::M1_R,
+	driverStatusBitsEnum< EnumeratedBaseType >::M2_R, driverStatusBitsEnum< EnumeratedBaseType >::M3_R, driverStatusBitsEnum< EnumeratedBaseType >::M4_R, driverStatusBitsEnum< EnumeratedBaseType >::M5_R,
+	driverStatusBitsEnum< EnumeratedBaseType >::OpDataNumberMask_R, driverStatusBitsEnum< EnumeratedBaseType >::Tim, driverStatusBitsEnum< EnumeratedBaseType >::ZSG, driverStatusBitsEnum< EnumeratedBaseType >::AlarmCode };
 HEADER_DECLARE_ENUM_CLASS_BINARY_OPERATORS( driverStatusBitsEnum32Bit );
 
 //IO Status Register Enumerated Bits
@@ -700,14 +705,15 @@ class IOStatusBitsEnum : public BitMaskEnumWrapper< IOStatusBitsEnum< Enumerated
 
 };
 typedef IOStatusBitsEnum< uint32_t > IOStatusBitsEnum32Bit;
-const IOStatusBitsEnum32Bit::stdEnum IOStatusBitsEnum32Bit::bitSelectorArray_[] = { IOStatusBitsEnum32Bit::M0,
-	IOStatusBitsEnum32Bit::M1, IOStatusBitsEnum32Bit::M2, IOStatusBitsEnum32Bit::M3, IOStatusBitsEnum32Bit::M4, 
-	IOStatusBitsEnum32Bit::M5, IOStatusBitsEnum32Bit::OpDataNumberMask, IOStatusBitsEnum32Bit::Start, 
-	IOStatusBitsEnum32Bit::AlmRst, IOStatusBitsEnum32Bit::AWO, IOStatusBitsEnum32Bit::Stop, 
-	IOStatusBitsEnum32Bit::HomePPreset, IOStatusBitsEnum32Bit::FWD, IOStatusBitsEnum32Bit::RVS,	IOStatusBitsEnum32Bit::LSPos,
-	IOStatusBitsEnum32Bit::LSNeg, IOStatusBitsEnum32Bit::Homes, IOStatusBitsEnum32Bit::Slit, IOStatusBitsEnum32Bit::Move, 
-	IOStatusBitsEnum32Bit::Alm, IOStatusBitsEnum32Bit::Out1, IOStatusBitsEnum32Bit::Out2, IOStatusBitsEnum32Bit::Out3, 
-	IOStatusBitsEnum32Bit::Out4 };
+template< typename EnumeratedBaseType >
+const typename IOStatusBitsEnum< EnumeratedBaseType >::stdEnum IOStatusBitsEnum< EnumeratedBaseType >::bitSelectorArray_[] = { IOStatusBitsEnum< EnumeratedBaseType >::M0,
+	IOStatusBitsEnum< EnumeratedBaseType >::M1, IOStatusBitsEnum< EnumeratedBaseType >::M2, IOStatusBitsEnum< EnumeratedBaseType >::M3, IOStatusBitsEnum< EnumeratedBaseType >::M4, 
+	IOStatusBitsEnum< EnumeratedBaseType >::M5, IOStatusBitsEnum< EnumeratedBaseType >::OpDataNumberMask, IOStatusBitsEnum< EnumeratedBaseType >::Start, 
+	IOStatusBitsEnum< EnumeratedBaseType >::AlmRst, IOStatusBitsEnum< EnumeratedBaseType >::AWO, IOStatusBitsEnum< EnumeratedBaseType >::Stop, 
+	IOStatusBitsEnum< EnumeratedBaseType >::HomePPreset, IOStatusBitsEnum< EnumeratedBaseType >::FWD, IOStatusBitsEnum< EnumeratedBaseType >::RVS,	IOStatusBitsEnum< EnumeratedBaseType >::LSPos,
+	IOStatusBitsEnum< EnumeratedBaseType >::LSNeg, IOStatusBitsEnum< EnumeratedBaseType >::Homes, IOStatusBitsEnum< EnumeratedBaseType >::Slit, IOStatusBitsEnum< EnumeratedBaseType >::Move, 
+	IOStatusBitsEnum< EnumeratedBaseType >::Alm, IOStatusBitsEnum< EnumeratedBaseType >::Out1, IOStatusBitsEnum< EnumeratedBaseType >::Out2, IOStatusBitsEnum< EnumeratedBaseType >::Out3, 
+	IOStatusBitsEnum< EnumeratedBaseType >::Out4 };
 HEADER_DECLARE_ENUM_CLASS_BINARY_OPERATORS( IOStatusBitsEnum32Bit );
 
 
@@ -2,7 +2,7 @@
 #define _ORIENTALCRK525MAKD_
 
 #include "OrientalControllerTemplate.h"
-#include "../../MMDevice/MMDeviceConstants.h"
+#include "OrientalCoreDefs.h"
 #include <string>
 #include "smartRegisters.h"
 #include "OrientalCRK525MAKDRegisterConstants.h"
@@ -10,6 +10,10 @@
 
 class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 {
+	//Times the Private Frame Builders and Parsers
+	friend class ProtocolBenchmark;
+	//Checks the Fixed Frames Against the Run-Time Builders (Tests/FixedFrameReplayTest.cpp)
+	friend class ControllerCoreTest;
 
 	//Private Register List For Controller
 	private:
@@ -25,6 +29,16 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 		//Maximum Packet Sizes For Write Communication
 		static const int maxWritePacketbytes_ = 29;
 
+		//Size of Every Fixed Frame (Address, Function, Two Words, CRC)
+		static const int fixedFrameBytes_ = 8;
+
+		//Coalesced Monitor Block Read For Position Readback and Status
+		//CommandPosReg (0x0118) through IOStatusReg (0x0126-0x0127), unregistered gaps are read and discarded
+		static const unsigned int monitorBlockNumRegs_ = 16;
+
+		//Start Speed of Continuous Operation Ramps (Lowered to the Operating Speed Below it)
+		static const uint32_t continuousStartSpeedHz_ = 100;
+
 		/***************************
 		  Operation Area Registers
 		***************************/
@@ -196,7 +210,7 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 	public:
 	
 		//Implementation function for Controllers In Use with Different Names
-		OrientalCRK525MAKD( OrientalFTDIHub* hub, AbstractControllerInterface::SerialCommFuncPtr serialCommPtr ) : ControllerInterface("OrientalCRK525MAKD", hub, serialCommPtr),
+		OrientalCRK525MAKD( ControllerBus* hub, AbstractControllerInterface::SerialCommFuncPtr serialCommPtr ) : ControllerInterface("OrientalCRK525MAKD", hub, serialCommPtr),
 			//Operations Area Registers
 			dwellTimeReg( 0x0012, 0x0000 ),
 			seqPosReg( 0x0013, genericEnableEnum16Bit::Disable ),
@@ -332,7 +346,18 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 			transmissionWaitTimeReg( g_SystemParameterByteBase | 0x1A, 10 ),
 			communicationTimeOutReg( g_SystemParameterByteBase | 0x1B, 0 ),
 			communicationErrorAlarmReg( g_SystemParameterByteBase | 0x1C, 3 ),
-			isInternalProc_(false)
+			isInternalProc_(false),
+			monitorBlockValid_(false),
+			monitorBlockMoving_(false),
+			monitorBlockReadTimeMs_(0),
+			monitorBlockStartMs_(0),
+			motionPlansEnabled_(false),
+			nextMovePlanSet_(false),
+			continuousDir_(0),
+			continuousSpeed_(0),
+			continuousRate_(0),
+			stopActionWritten_(-1),
+			absolutePositioning_(false)
 			{
 				/********************************************************
 				*	Register Base Angle Registers to Base Angle Register Map 
@@ -488,11 +513,23 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 				RegisterNewRegisterAddress( &transmissionWaitTimeReg );
 				RegisterNewRegisterAddress( &communicationTimeOutReg );
 				RegisterNewRegisterAddress( &communicationErrorAlarmReg );
+
+				BuildConfigurationTable();
+
+				//Frames For the Default Address, Rebuilt by setAddressBuffer()
+				BuildFixedFrames();
 		
 			};
 
 		~OrientalCRK525MAKD(){};
 
+		/* Set Address From a Big Endian Buffer Representation and Rebuild the Fixed Frames For it
+		*   @param serializedAddrBuffer[] - Big Endian Buffer of the Address
+		*   @param bufferSize - Size of the Buffer
+		*   Returns - 0 if successful, or the ControllerInterface::setAddressBuffer() errCode
+		*/
+		int setAddressBuffer( const unsigned char serializedAddrBuffer[], int bufferSize );
+
 		/* Virtual Implementation - Sets the current BaseAnglePartition from the one passed
 		*	Note:  This will be hard-coded for every new controller
 		*   @param baseAnglePartition - number that corresponds to an enumerated Value in the register
@@ -515,7 +552,7 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 		double matchBaseAnglePartitionRegisterValueToNumber( EnumBaseType registerValue, std::map< double, EnumBaseType >& partitionMap )
 		{
 
-			std::map< double, EnumBaseType >::iterator it;
+			typename std::map< double, EnumBaseType >::iterator it;
 			
 			for( it = partitionMap.begin(); it != partitionMap.end(); ++it )
 			{
@@ -533,9 +570,9 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 		*   Note: This will be hard-coded for every new controller
 		*   Note:  Used to display all available step Increments for a selected Base Angle
 		*   @param baseAngleOption - the current BaseAngle Being Queried
-		*   Returns - vector of doubles or an empty vector if there is a problem
+		*   Returns - vector of doubles or an empty vector if there is a problem (Owned by the Controller, Valid For its Lifetime)
 		*/
-		std::vector<double> GetBaseAnglePartitionOptions( double baseAngleOption ); 
+		const std::vector<double>& GetBaseAnglePartitionOptions( double baseAngleOption ); 
 
 		/* Virtual Implementation - Initialize Physical Controller Via Serial Commands
 		*    Note:  NO Serial Communication should be done inside of controller constructor, due to user ability to correct errors later
@@ -543,11 +580,94 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 		*/
 		int InitializePhysicalController();
 
+		/* Virtual Implementation - Broadcasts the Input Mode and Rotation Direction Writes of InitializePhysicalController()
+		*    Returns - 0 or errCode otherwise
+		*/
+		int BroadcastCommonConfiguration();
+
+		/* Virtual Implementation - Reads the Configuration Registers (Parameter Block in One Read, Rotation Direction in a Second)
+		*   @param fingerprint - set to the FNV-1a fingerprint of the values read
+		*   @param applied - set to true if every value already matches
+		*    Returns - 0 or errCode otherwise
+		*/
+		int ReadConfiguration( uint32_t& fingerprint, bool& applied );
+
+		//Virtual Implementation - Fingerprint of the Desired Configuration
+		uint32_t GetConfigurationFingerprint( void ) { return FingerprintConfiguration( true ); }
+
+		/* Virtual Implementation - Writes the Configuration Values That Differed in the Last ReadConfiguration()
+		*    Returns - 0 or errCode otherwise
+		*/
+		int WriteConfigurationDifferences( void );
+
+		/* Virtual Implementation - Resolves Every Setting to a Named or Parameter Area Register and Checks its Value
+		*   @param error - set to a description of the first bad setting
+		*    Returns - 0 if the profile can be applied, otherwise non-zero
+		*/
+		int ValidateProfile( const ControllerProfile& profile, std::string& error );
+
+		/* Virtual Implementation - Writes a Profile With One Multi-Write Per Run of Consecutive Registers
+		*    Returns - 0 or errCode otherwise (-2 if the profile does not validate)
+		*/
+		int ApplyProfile( const ControllerProfile& profile );
+
+		/* Virtual Implementation - Reads Each Setting's Register (Unsigned Raw Value, so it Can be Applied Back)
+		*    Returns - 0 or errCode otherwise
+		*/
+		int ReadProfile( ControllerProfile& profile );
+
+		/* Virtual Implementation - Reads presentAlarmReg Through presentWarningReg in One Read, Then stepOutDetectionReg
+		*    Returns - 0 or errCode otherwise
+		*/
+		int ReadFaultState( ControllerFaultState& state );
+
+		/* Virtual Implementation - Pulses resetAlarmReg and clearWarningRecReg Together (Two Multi-Writes)
+		*    Returns - 0 or errCode otherwise
+		*/
+		int ClearFaults( void );
+
+		/* Virtual Implementation - Switches accelRateTypeReg Between Separate (Operation Data Rates) and Common
+		*    Returns - 0 or errCode otherwise
+		*/
+		int EnableMotionPlans( bool enable );
+
+		//Virtual Implementation - Stage the Speed and Rates LoadPosBuffer() Writes With the Next Position
+		void SetNextMovePlan( const MotionPlan* plan );
+
+		/* Virtual Implementation - Continuous Operation on the Fwd and Rvs Bits of Cmd1 at the Jog Speed and Rate
+		*   Note:  A speed change while running is a single jogOperatingSpeedReg write, the direction bit stays set
+		*    Returns - 0 or errCode otherwise
+		*/
+		int SetContinuousVelocity( double stepsPerSec, double accelHzPerS );
+
+		/* Virtual Implementation - Pulses the Stop Bit of Cmd1, stopActionReg Written First if it Holds the Other Action
+		*    Returns - 0 or errCode otherwise
+		*/
+		int StopMotion( bool immediate );
+
+		/* Virtual Implementation - Writes the Output's Signal Mode Register (OUT1 - OUT4)
+		*   Note:  TriggerOutputInPosition is READY, TriggerOutputArea is AREA (area1Reg to area2Reg)
+		*    Returns - 0 or errCode otherwise (-1 for an output other than 1 - 4)
+		*/
+		int SetTriggerOutput( unsigned int output, TriggerOutputSignal signal );
+
+		/* Virtual Implementation - Writes area1Reg and area2Reg in One 4 Register Multi-Write
+		*    Returns - 0 or errCode otherwise (-2 for a position outside the registers' range)
+		*/
+		int SetTriggerWindow( long fromSteps, long toSteps );
+
+		/* Virtual Implementation - Writes posModeReg (Absolute or Incremental)
+		*    Returns - 0 or errCode otherwise
+		*/
+		int SetAbsolutePositioning( bool absolute );
+		bool IsAbsolutePositioning( void ) { return absolutePositioning_; }
+		bool IsPosInRange( double steps ) { return steps >= INT32_MIN && steps <= INT32_MAX && posReg.isAcceptedValue( static_cast< int32_t >( steps ) ); }
+
 		/* Virtual Function To Send a testConnection Packet Request to verify working Order
-		*	Implements Child-level overload of testConnection( uint16_t )
+		*	Sends the Prebuilt Diagnose Frame (Same Request as testConnection( 0x1234 ))
 		*   Returns - 0 if successful or errCode otherwise
 		*/
-		int testConnection( void ) { return testConnection( 0x1234 ); }
+		int testConnection( void ) { return SendFixedFrame( FrameDiagnose ); }
 
 		/*  @Overload to virtual function testConnection
 		*   Sends a testConnection Packet Request to the Controller to verify Working Order
@@ -563,13 +683,31 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 		*   @param *SerialCommFuncPtr = Pointer to the Desired Serial Communication Function Being Used
 		*/
 		int WritePosBuffer( unsigned char serializedValue[], int serializedValueLen, bool valueIsBigEndian, AbstractControllerInterface::SerialCommFuncPtr serialCommFuncPtr );
+
+		/* Virtual Implementation - Sends the Mode and Position Frames of WritePosBuffer() Without the Start Command
+		*   @param serializedValue[] = Byte Array Passed From MMDevice Object for desired value
+		*   @param serializedValueLen =  Number of Defined Bytes in the array
+		*   @param valueIsBigEndian = Identifies The Way the Value was packaged into Bytes before being passed
+		*/
+		int PreloadPosBuffer( unsigned char serializedValue[], int serializedValueLen, bool valueIsBigEndian ) { return LoadPosBuffer( serializedValue, serializedValueLen, valueIsBigEndian, nullptr ); }
+
+		/* Virtual Implementation - Broadcasts the cmd1 Start Frame (Slave Address 0)
+		*/
+		int BroadcastStart( void );
 		
-		/* Reads Position From Serial Request 
+		/* Reads Position From the Cached Monitor Block, Refreshing it Through Serial Request if Stale
+		*   Note:  Serializes EncodeCounterReg if GetEncoderReadback() is set, otherwise CommandPosReg
 		*   @param readBuffer[] - Buffer to Return BigEndian Byte Ordered Position Value
 		*   @param bufferSize - Size of the Buffer Passed
-		*   Returns - Number of Bytes Defined in Buffer or -1 if buffer size if too small
+		*   Returns - Number of Bytes Defined in Buffer, -1 if buffer size if too small, or negated errCode of the read
+		*/
+		int ReadPosBuffer( unsigned char readBuffer[], int bufferSize );
+
+		/* Discard the Cached Monitor Block So the Next ReadPosBuffer() Queries the Controller
 		*/
-		int ReadPosBuffer( unsigned char readBuffer[], int bufferSize ){ return 0; };
+		void InvalidatePosReadback( void );
+		void MarkPosReadbackMoving( void );
+		int ReadMotionTelemetry( MotionTelemetrySample& sample );
 
 		/*
 		* Logic To Determine the Expected Header Length of the Response Message
@@ -608,6 +746,15 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 		*/
 		int parseData( const unsigned char txMsgBuffer[], const int txMsgBufLen, const unsigned char rxBuffer[], const int rxBufLen );
 
+		//Virtual Implementation - CRC Mismatch (or Too Short to Hold One)
+		bool isCorruptResponse( const unsigned char rxBuffer[], const int rxBufLen );
+		//Virtual Implementation - Function Code Has the Exception Bit Set
+		bool isExceptionResponse( const unsigned char rxBuffer[], const int rxBufLen );
+		/* Virtual Implementation - Reads, Diagnosis and Register Writes, Except Writes Reaching posReg or cmd1Reg
+		*   in Incremental Mode (a Repeated Relative Move Could Move Twice)
+		*/
+		bool isIdempotentRequest( const unsigned char txMsgBuffer[], const int txMsgBufLen );
+
 		/*Virtual Implementation - Returns a code corresponding to Whether or not the Motor is Currently Running
 		*  Note:  Should Implement A ThreadGuard Due to the Accessing of Any Information In This Function
 		*         The protected member From AbstractControllerInterface busyLock_ may be used for this purpose
@@ -704,7 +851,6 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 					return 1;
 				}
 
-				AbstractControllerInterfaceFactory::LogMessage(  "Get Address" );
 				//Controller Slave Address
 				numBytesWritten = getAddressBuffer( packet, 1 );
 				if( numBytesWritten == -1 )  
@@ -718,7 +864,6 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 				packet[currentByte] =  functionCodes::registerWrite;
 				currentByte += sizeof( functionCodes::registerWrite );
 
-				AbstractControllerInterfaceFactory::LogMessage(  "Get Register Address" );
 				//Register Address
 				numBytesWritten = reg.readAddress( &packet[currentByte],  packetByteSize - currentByte );
 				if( numBytesWritten == -1 ) 
@@ -728,7 +873,6 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 				}
 				currentByte += numBytesWritten;
 
-				AbstractControllerInterfaceFactory::LogMessage(  "Serialize Value" );
 				//Serialize Value
 				//Complete Type Work Around For BigEndianness
 				if( reg.isBigEndianCheck() )
@@ -748,31 +892,27 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 				//Print the Value
 				if( debug )
 				{
-					ostringstream es;
-					es << "The Value Packet is " << (int) packet[ currentByte ] << ", " << (int) (packet[currentByte+ 1]);
-					AbstractControllerInterfaceFactory::LogMessage( es.str() );
+					ORIENTAL_LOG_DEBUG( "Single Write Value {}", ORIENTAL_LOG_BYTES( &packet[ currentByte ], numBytesWritten ) );
 				}
 
-				AbstractControllerInterfaceFactory::LogMessage(  "Acceptable Range Test" );
 				//Check to see if value is inside of Acceptable Range
 				if( ( errCode = reg.testSerialDataConformance( &packet[valueIndex], sizeof( regValType ) ) ) != 1 )
 				{
 					if( errCode == -1 )
 					{
 						//The buffer was too small
-						AbstractControllerInterfaceFactory::LogMessage(  "Small Buffer" );
+						ORIENTAL_LOG_WARN( "Single Write Value Buffer Too Small" );
 						return -1;
 					}
 					if( errCode == 0 )
 					{
 						//Value outside of acceptable Range
-						AbstractControllerInterfaceFactory::LogMessage(  "Outside Range:  " );
+						ORIENTAL_LOG_WARN( "Single Write Value Outside Register Range {}", ORIENTAL_LOG_BYTES( &packet[valueIndex], sizeof( regValType ) ) );
 						return -2;
 					}
 				}
 				currentByte += numBytesWritten;
 
-				AbstractControllerInterfaceFactory::LogMessage(  "Append CRC" );
 				//Add CRCCheckValue
 				numBytesWritten = appendCRCCheckValue( packet, sizeof(packet), currentByte );
 				if( numBytesWritten == -1 )
@@ -782,11 +922,13 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 				}
 				currentByte += numBytesWritten;
 
+				ORIENTAL_LOG_TRACE( "Single Write Frame {}", ORIENTAL_LOG_BYTES( packet, currentByte ) );
+
 				//Communicate With Controller
 				if( ( errCode = ( retrieveSerialCommHubPtr()->*serialCommFuncPtr )( packet, currentByte, this, false ) ) != DEVICE_OK )
 				{
 					//Register Was not Written
-					AbstractControllerInterfaceFactory::LogMessage(  CDeviceUtils::ConvertToString( errCode ) );
+					ORIENTAL_LOG_WARN( "Single Write Failed With {}", errCode );
 					return errCode;
 				}
 
@@ -800,9 +942,16 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 		*   @param valueArray[] - Byte array of already parsed Values (most likely using ReadWrite< decltype( register), isBigEndian::read()
 		*							Note:  Each Array Value is assumed to have been placed in the correct endian order
 		*   @param valueArraySize - Size of the Defined Bytes in the Array to be passed along
+		*   @param broadcast - address the request to slave 0 (every slave writes it, none answers)
 		*   Returns - 0 on completion or errorCodes otherwise
 		*/
-		int serialWriteMultiRegister( AbstractRegisterBase &startReg, unsigned int numRegs, unsigned char valueArray[], int valueArraySize );
+		int serialWriteMultiRegister( AbstractRegisterBase &startReg, unsigned int numRegs, unsigned char valueArray[], int valueArraySize, bool broadcast = false );
+
+		/* Switch Motor Excitation, Home/Fwd/Rvs and Data No Inputs to RS-485 (One Multi-Write)
+		*   @param broadcast - address the request to slave 0
+		*   Returns - 0 on completion or errCode otherwise
+		*/
+		int WriteRS485InputModes( bool broadcast );
 
 		/* Reads A Number of Consecutive Registers into the controller Register Members
 		*   @param startReg - Pointer to the register with the first address
@@ -827,7 +976,6 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 					serialCommFuncPtr = retrieveSerialCommFuncPtr();
 				}
 
-				AbstractControllerInterfaceFactory::LogMessage(  "Get Address" );
 				//Controller Slave Address
 				numBytesWritten = getAddressBuffer( packet, 1 );
 				if( numBytesWritten == -1 )  
@@ -841,7 +989,6 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 				packet[currentByte] =  functionCodes::registerRead;
 				currentByte += sizeof( functionCodes::registerRead );
 
-				AbstractControllerInterfaceFactory::LogMessage( "Get Register Address" );
 				//Register Address
 				numBytesWritten = startReg->readAddress( &packet[currentByte],  packetByteSize - currentByte );
 				if( numBytesWritten == -1 ) 
@@ -860,36 +1007,27 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 				}
 				currentByte += numBytesWritten;
 
-				AbstractControllerInterfaceFactory::LogMessage( "Counting Num Registers This is Changed" );
-
-				//Check to Make Sure We Are not writing a partial Register
+				//Check to Make Sure We Are not reading a partial Register
+				//Unregistered Addresses Inside the Span Are Gaps and Are Discarded by onRegisterRead()
 				AbstractRegisterBase * reg = startReg;
-				int i;
+				unsigned int i;
 				for( i = 0; i < numRegs; )
 				{
-					i += reg->getRegisterByteSize()/baseRegisterByteSize_;
-					reg = GetRegisterByAddress( addr + 1 );
-					AbstractControllerInterfaceFactory::LogMessage( "In for loop " );
+					reg = GetRegisterByAddress( addr + i );
 					if( reg == nullptr )
 					{
-						if( i != numRegs )
-						{
-							//We have Tried to Read From an Unavailable Register
-							AbstractControllerInterfaceFactory::LogMessage( "Unavailable Register To Read" );
-							return 1;
-						}
+						i += 1;
+					}
+					else
+					{
+						i += reg->getRegisterByteSize()/baseRegisterByteSize_;
 					}
-
 				}
 
-				std::ostringstream os;
-				os << "i is: " << i << "\nnumRegs is: " << numRegs;
-				AbstractControllerInterfaceFactory::LogMessage( os.str() );
-
 				if( i != numRegs )
 				{
 					//Error:  We Are Reading a Fraction of a Register
-					AbstractControllerInterfaceFactory::LogMessage( "Reading Portion of Register Only" );
+					ORIENTAL_LOG_WARN( "Read of {} Registers From {x} Splits a Register", numRegs, (unsigned int) addr );
 					return 1;
 				}
 
@@ -901,7 +1039,6 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 				}
 				currentByte += numBytesWritten;
 
-				AbstractControllerInterfaceFactory::LogMessage(  "Append CRC" );
 				//Add CRCCheckValue
 				numBytesWritten = appendCRCCheckValue( packet, sizeof(packet), currentByte );
 				if( numBytesWritten == -1 )
@@ -911,11 +1048,13 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 				}
 				currentByte += numBytesWritten;
 
+				ORIENTAL_LOG_TRACE( "Read Frame {}", ORIENTAL_LOG_BYTES( packet, currentByte ) );
+
 				//Communicate With Controller
 				if( ( errCode = ( retrieveSerialCommHubPtr()->*serialCommFuncPtr )( packet, currentByte, this, false ) ) != DEVICE_OK )
 				{
-					//Register Was not Written
-					AbstractControllerInterfaceFactory::LogMessage(  CDeviceUtils::ConvertToString( errCode ) );
+					//Register Was not Read
+					ORIENTAL_LOG_WARN( "Read of {} Registers From {x} Failed With {}", numRegs, (unsigned int) addr, errCode );
 					return errCode;
 				}
 
@@ -928,15 +1067,206 @@ class OrientalCRK525MAKD : public ControllerInterface< uint8_t >
 		int onSingleRegisterWriteResponse( const unsigned char txMsgBuffer[], const unsigned int txMsgBufLen, const unsigned char rxBuffer[], const unsigned int rxBufLen );
 		int onRegisterRead( const unsigned char txMsgBuffer[], const unsigned int txMsgBufLen, const unsigned char rxBuffer[], const unsigned int rxBufLen );
 
+		/* Append Register Bytes to the Hub's Telemetry Recording (No-op While the Hub is Not Recording)
+		*   @param kind - TelemetryRecordKind
+		*   @param startRegister - address of the first register in registerBytes
+		*   @param registerBytes[] - register bytes as transferred on the line
+		*   @param numBytes - number of bytes in registerBytes
+		*/
+		void RecordTelemetry( uint8_t kind, uint16_t startRegister, const unsigned char registerBytes[], unsigned int numBytes );
+
 		//Numerical Values For Different Base Angles
 		std::vector<double> degOptions_72_;
 		std::vector<double> degOptions_36_;
+		//Returned For Unknown Base Angles
+		std::vector<double> noDegOptions_;
 
 		std::map< double, base_36DegStepAnglesEnum16Bit::EnumBaseType > _36DegBaseStepAnglesTypeMap_;
 		std::map< double, base_72DegStepAnglesEnum16Bit::EnumBaseType > _72DegBaseStepAnglesTypeMap_;
 
 		//Boolean For Controller Processing State
 		bool isInternalProc_;
+
+		/* Read the Monitor Block (CommandPosReg Through IOStatusReg) in One Serial Transaction
+		*   Note:  Returns Without Serial Communication if the Cached Block is Fresh
+		*          A Block Read While Resting Stays Fresh Until InvalidatePosReadback(),
+		*          A Block Read During a Move (or Within moveOutputLagMS_ of MarkPosReadbackMoving()) Expires After GetReadbackMaxAgeMS()
+		*   @param forceRead - Always Query the Controller
+		*   Returns - 0 on completion or errorCodes otherwise
+		*/
+		int ReadMonitorBlock( bool forceRead = false );
+
+		//Time the MOVE Output May Take to Come On After a Start Command (Blocks Read Sooner Count as Moving)
+		static const long moveOutputLagMS_ = 50;
+
+		//Monitor Block Cache State
+		MMThreadLock monitorBlockLock_;
+		bool monitorBlockValid_;
+		bool monitorBlockMoving_;
+		double monitorBlockReadTimeMs_;
+		double monitorBlockStartMs_;
+
+		/*  Requests Whose Bytes Only Depend on the Slave Address
+		*     Built Complete (CRC Included) by BuildFixedFrames(), so Sending One is a Copy Plus the I/O
+		*/
+		enum FixedFrameId
+		{
+			FrameMonitorBlockRead = 0,		//CommandPosReg Through IOStatusReg (Status Poll)
+			FrameDriverStatusRead,
+			FrameDiagnose,					//testConnection() Default Value
+			FrameCmd1Off,
+			FrameCmd1COn,
+			FrameCmd1M0,
+			FrameCmd1M0COn,					//Position Mode, Energized
+			FrameCmd1StartM0COn,			//Start Position Move
+			FrameCmd1FwdCOn,				//Continuous Operation Forward
+			FrameCmd1RvsCOn,				//Continuous Operation Reverse
+			FrameCmd1StopCOn,				//Stop as stopActionReg Sets
+			FrameBroadcastStart,			//FrameCmd1StartM0COn to Slave Address 0, Not Answered (Broadcast Frames From Here on)
+			FrameBroadcastStartInputRS485,	//InitializePhysicalController() Writes Common to Every Slave
+			FrameBroadcastIOStopDisable,
+			FrameBroadcastRotationCCW,
+			NumFixedFrames
+		};
+
+		struct FixedFrame
+		{
+			unsigned char bytes[ fixedFrameBytes_ ];
+			int len;						//0 if the Frame Could Not be Built
+		};
+
+		/* Build Every Fixed Frame For the Current Address
+		*   Returns - 0 if all frames were built, otherwise -1 (unbuilt frames fall back to the run-time builders)
+		*/
+		int BuildFixedFrames( void );
+
+		/* Build a Single Register Write, Read or Diagnose Request Into frame (CRC Included)
+		*   Returns - 0 if built, otherwise -1
+		*/
+		int BuildSingleWriteFrame( AbstractRegisterBase& reg, uint16_t value, FixedFrame& frame, bool broadcast = false );
+		int BuildReadFrame( AbstractRegisterBase& reg, uint16_t numRegs, FixedFrame& frame );
+		int BuildDiagnoseFrame( uint16_t testValue, FixedFrame& frame );
+
+		/* Mode and Position Frames of a Move (WritePosBuffer() Without the Start Command)
+		*   @param serialCommFuncPtr - nullptr uses retrieveSerialCommFuncPtr()
+		*   Returns - 0 if the position was loaded, or errCode otherwise
+		*/
+		int LoadPosBuffer( unsigned char serializedValue[], int serializedValueLen, bool valueIsBigEndian, AbstractControllerInterface::SerialCommFuncPtr serialCommFuncPtr );
+
+		/* Send a Fixed Frame, Its Response Parsed as Usual (Frames From FrameBroadcastStart on Are Sent Without Waiting For One)
+		*   @param id - FixedFrameId
+		*   @param serialCommFuncPtr - nullptr uses retrieveSerialCommFuncPtr()
+		*   Returns - 0 on completion, -1 if the frame was never built, or errCode of the transaction
+		*/
+		int SendFixedFrame( FixedFrameId id, AbstractControllerInterface::SerialCommFuncPtr serialCommFuncPtr = nullptr );
+
+		//Guards fixedFrames_ Against a Rebuild During a Send
+		MMThreadLock fixedFramesLock_;
+		FixedFrame fixedFrames_[ NumFixedFrames ];
+
+		/*  Configuration InitializePhysicalController() Establishes, in the Order it is Written
+		*     Entries Are Compared Register by Register After ReadConfiguration(), Only Differences Are Written
+		*/
+		enum ConfigurationEntryId
+		{
+			ConfigStartInputMode = 0,
+			ConfigIOStopInput,
+			ConfigRotationDirection,
+			ConfigMotorExciteInputMode,		//Input Modes Are Written Together (WriteRS485InputModes())
+			ConfigHomeFwdRvsInputMode,
+			ConfigDataNumInputMode,
+			NumConfigurationEntries
+		};
+
+		struct ConfigurationEntry
+		{
+			AbstractRegisterBase* reg;
+			uint16_t value;					//Desired
+			uint16_t factoryValue;			//Power-On Default (the Register Member's Initial Value)
+		};
+
+		//startInputModeReg Through dataNumInputModeReg in One Read (Parameter 0x05 is a Gap)
+		static const unsigned int configurationBlockNumRegs_ = 14;
+
+		//Fill configuration_ (Constructor Only)
+		void BuildConfigurationTable( void );
+
+		//Entry Must be Written:  it Differed in the Last ReadConfiguration(), or There Was No Successful One
+		bool ConfigurationEntryDiffers( int id );
+
+		/* FNV-1a Over the Address and Value of Every Entry
+		*   @param desired - hash the desired values, otherwise the register members (last read values)
+		*/
+		uint32_t FingerprintConfiguration( bool desired );
+
+		//Raw Value of a One-Register Member, and its Inverse
+		static uint16_t GetRegisterValue16( AbstractRegisterBase& reg );
+		static void SetRegisterValue16( AbstractRegisterBase& reg, uint16_t value );
+
+		ConfigurationEntry configuration_[ NumConfigurationEntries ];
+		bool configurationRead_;
+
+		//Registers One Multi-Write Carries in maxWritePacketbytes_ (Address, Function, Start, Count, Byte Count and CRC Take 9 Bytes)
+		static const unsigned int maxProfileWriteRegs_ = ( maxWritePacketbytes_ - 9 ) / baseRegisterByteSize_;
+
+		//One Profile Setting Resolved to its Register and Serialized
+		struct ProfileValue
+		{
+			AbstractRegisterBase* reg;
+			uint32_t address;
+			unsigned char bytes[ sizeof( uint32_t ) ];
+			int numBytes;
+		};
+
+		//One Multi-Write of a Profile:  numRegs Consecutive Registers From startReg
+		struct ProfileWrite
+		{
+			AbstractRegisterBase* startReg;
+			unsigned int numRegs;
+			unsigned char values[ maxProfileWriteRegs_ * baseRegisterByteSize_ ];
+			int numBytes;
+		};
+
+		/* Resolve, Check and Merge the Settings of a Profile Into Multi-Writes
+		*   @param writes - filled with the writes in address order
+		*   @param error - set to a description of the first bad setting
+		*   Returns - 0, or non-zero if a setting is bad (writes is then incomplete)
+		*/
+		int BuildProfileWrites( const ControllerProfile& profile, std::vector< ProfileWrite >& writes, std::string& error );
+
+		/* Register For a Profile Register Name, or a Parameter Area Address in Hex ("0x0228")
+		*   Note:  Names also reach the operation data No. 0 speed and rates (operatingSpeed, accelRate, decelRate)
+		*   Returns - the register, or nullptr if there is none
+		*/
+		AbstractRegisterBase* GetProfileRegister( const std::string& name );
+
+		//Order of ProfileValues in a Profile's Writes
+		static bool ProfileValueBefore( const ProfileValue& a, const ProfileValue& b ) { return a.address < b.address; }
+
+		/* Write a Planned Move:  decelRateReg Through posReg (0x16 - 0x1D) in One 8 Register Multi-Write
+		*   @param posValue[] - Big Endian position, posReg.getRegisterByteSize() bytes
+		*   Returns - 0 on completion or errorCodes otherwise
+		*/
+		int WritePlannedMove( const MotionPlan& plan, unsigned char posValue[] );
+
+		//Acceleration and Deceleration Rate Register Value (0.001 ms/kHz) For a Rate in Steps/s^2
+		static uint32_t RateRegisterValue( double hzPerS );
+
+		//Staged by SetNextMovePlan(), Taken by the Next LoadPosBuffer()
+		MMThreadLock motionPlanLock_;
+		bool motionPlansEnabled_;
+		bool nextMovePlanSet_;
+		MotionPlan nextMovePlan_;
+
+		//Continuous Operation:  Running Direction (1 Fwd, -1 Rvs, 0 Stopped) and the Jog Speed and Rate Last Written
+		//stopActionWritten_ is the stopActionReg Value Last Written, -1 Before the First StopMotion()
+		int continuousDir_;
+		uint32_t continuousSpeed_;
+		uint32_t continuousRate_;
+		int stopActionWritten_;
+
+		//posModeReg Was Last Written Absolute (Position Writes Are Then Command Positions)
+		bool absolutePositioning_;
 };
 
 
@@ -1,13 +1,7 @@
 #include "OrientalControllerTemplate.h"
 #include "OrientalCRK525PMAKD.h"
-#include "OrientalMotorHub.h"
-
-bool AbstractControllerInterfaceFactory::initialized_ = false;
-std::map< std::string, ControllerMaker > AbstractControllerInterfaceFactory::controllerOptions_;
-std::map< std::string, ControllerMaker >::iterator AbstractControllerInterfaceFactory::iterator_;
-MM::Core* AbstractControllerInterfaceFactory::LogCore_ = nullptr;
-MM::Device * AbstractControllerInterfaceFactory::Caller_ = nullptr;
-bool AbstractControllerInterfaceFactory::loggerRegistered_ = false;
+#include "ControllerBus.h"
+#include "ControllerStatusMonitorThread.h"
 
 
 AbstractControllerInterface::~AbstractControllerInterface(){ 
@@ -22,7 +16,7 @@ AbstractControllerInterface::~AbstractControllerInterface(){
 *    @param serialCommPtr - Pointer from OrientalHub Function that is chosen to be used (May change based on hardward from USB)
 *    Return - 0 if ok.  -1 if ptr is somehow nullptr
 */
-int AbstractControllerInterface::setSerialCommHubPtr( OrientalFTDIHub* serialCommHubPtr ) {
+int AbstractControllerInterface::setSerialCommHubPtr( ControllerBus* serialCommHubPtr ) {
 
 	assert( serialCommHubPtr != nullptr );
 
@@ -51,64 +45,26 @@ ControllerStatusMonitorThread* AbstractControllerInterface::getStatusMonitorThre
 //  Note:  AbstractControllerInterface Implements nullptrs to simply produce a readable value from getName() for easier code injection later
 //  Use of nullptrs is the burden of the programmer to avoid
 template< class T >
-AbstractControllerInterface* make( OrientalFTDIHub* hub, AbstractControllerInterface::SerialCommFuncPtr serialCommPtr )
+AbstractControllerInterface* make( ControllerBus* hub, AbstractControllerInterface::SerialCommFuncPtr serialCommPtr )
 { 
 	return new T( hub, serialCommPtr );
 }
 
-ControllerMaker const AbstractControllerInterfaceFactory::availableControllers_[] = { make<OrientalCRK525MAKD> };
-
-//Take availableControllers_ and place in a name-correlated map
 //Assumes no name is the same in each class
-int AbstractControllerInterfaceFactory::Initialize( )
-	{
-
-		AbstractControllerInterface * cont;
-		int i = 0;
-		
-		LogMessage( "In the AbstractControllerInterface INitialize" );
-		for( ; i< sizeof(availableControllers_)/sizeof(availableControllers_[0]); i++ )
-		{
-			LogMessage( "This is an available Controller Creation" );
-			//Instantiate a controller to get it's name only for display purposes
-			cont = availableControllers_[i]( nullptr, nullptr );
-			controllerOptions_[ cont->getName() ] = availableControllers_[i];
-			delete cont;
-		}
-
-		initialized_ = true;
-
-		LogMessage("Leaving Initialize");
-
-		//return size
-		return i;
-
-	};
-
+const ControllerOption AbstractControllerInterfaceFactory::availableControllers_[] = { { "OrientalCRK525MAKD", make<OrientalCRK525MAKD> } };
+const size_t AbstractControllerInterfaceFactory::numAvailableControllers_ = sizeof( AbstractControllerInterfaceFactory::availableControllers_ )/sizeof( AbstractControllerInterfaceFactory::availableControllers_[0] );
 
 //read all keys
 std::vector<std::string> AbstractControllerInterfaceFactory::ReadAllOptionNames( void )
 	{
-		LogMessage( "In the AbstractControllerInterface ReadAllOptions");
-		//Initialize the AbstractControllerInterfaceFactory if there is no controllerOptions_
-		if( controllerOptions_.empty() && initialized_ == false )
-		{
-			Initialize();
-		}
-
 		std::vector< std::string > v;
 
-		for( iterator_ = controllerOptions_.begin(); iterator_ != controllerOptions_.end(); ++iterator_ )
+		for( size_t i = 0; i < numAvailableControllers_; i++ )
 		{
-			v.push_back( iterator_->first );
+			v.push_back( availableControllers_[i].name );
 		}
 
-		std::string testStr("Vector Length is ");
-		testStr += CDeviceUtils::ConvertToString( (int) v.size() );
-
-		LogMessage( testStr.c_str() );
-
-		LogMessage( v[0].c_str() );
+		ORIENTAL_LOG_DEBUG( "Read {} Controller Options", (int) v.size() );
 
 		return v;
 
@@ -118,39 +74,52 @@ std::vector<std::string> AbstractControllerInterfaceFactory::ReadAllOptionNames(
 //Soft Returns a null AbstractControllerInterface Object
 //This should be handled in calling class for Error handling
 //Throws Exception If There's a Problem in the 
-AbstractControllerInterface* AbstractControllerInterfaceFactory::GetNewControllerOption( std::string name, OrientalFTDIHub* hub,  AbstractControllerInterface::SerialCommFuncPtr serialCommPtr )
+AbstractControllerInterface* AbstractControllerInterfaceFactory::GetNewControllerOption( std::string name, ControllerBus* hub,  AbstractControllerInterface::SerialCommFuncPtr serialCommPtr )
 	{
-		LogMessage( "In the AbstractControllerInterface NewController" );
-		//Initialize the AbstractControllerInterfaceFactory if there is no controllerOptions_
-		if( controllerOptions_.empty() && initialized_ == false )
-		{
-			Initialize();
-		}
+		ORIENTAL_LOG_DEBUG( "Creating Controller {}", name );
 
-
-		iterator_ = controllerOptions_.find( name );
-		if( iterator_ == controllerOptions_.end() )
+		for( size_t i = 0; i < numAvailableControllers_; i++ )
 		{
-			//Log Error
-			return nullptr;
+			if( name == availableControllers_[i].name )
+			{
+				return availableControllers_[i].maker( hub, serialCommPtr );
+			}
 		}
 
-		return (iterator_->second)( hub, serialCommPtr );
+		ORIENTAL_LOG_WARN( "No Controller Named {}", name );
+		return nullptr;
 
 	};
 
-void AbstractControllerInterfaceFactory::LogMessage( std::string msg /*More Arguments */ )
+/* Add sink to the Destinations of Controller Logging (Starting the ControllerLog Thread With the First)
+*   Note:  Records reach sink from threads inside a ControllerLogScope of it, every hub registers its own
+*   @param sink - destination of the records (the hub's core callback adaptor in the adapter)
+*/
+void AbstractControllerInterfaceFactory::RegisterLogger( ControllerLogSink* sink )
 {
-	if( loggerRegistered_ )
+	if( ControllerLog::Attach( sink ) != 0 )
 	{
-		LogCore_->LogMessage( Caller_, msg.c_str(), true);
+		return;
 	}
+
+	ControllerLogScope scope( sink );
+	ORIENTAL_LOG_DEBUG( "Registered Controller Logger" );
+}
+
+/* Flush What sink Has Pending and Remove it (the ControllerLog Thread Stops With the Last)
+*/
+void AbstractControllerInterfaceFactory::UnregisterLogger( ControllerLogSink* sink )
+{
+	ControllerLog::Detach( sink );
+}
+
+//Preformatted Messages, Kept For Callers Outside the Controllers (Debug Level, Deferred Like Any ORIENTAL_LOG Statement)
+void AbstractControllerInterfaceFactory::LogMessage( std::string msg /*More Arguments */ )
+{
+	ORIENTAL_LOG_DEBUG( "{}", msg );
 };
 
 void AbstractControllerInterfaceFactory::LogMessage( char* msg /*More Arguments */ )
 {
-	if( loggerRegistered_ )
-	{
-		LogCore_->LogMessage( Caller_, msg, true);
-	}
+	ORIENTAL_LOG_DEBUG( "{}", msg );
 }
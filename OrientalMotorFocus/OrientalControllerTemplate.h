@@ -6,16 +6,18 @@
 #include <map>
 #include <vector>
 #include <stdint.h>
-#include "../../MMDevice/MMDeviceConstants.h"
-#include "../../MMDevice/DeviceBase.h"
-#include "../../MMDevice/DeviceThreads.h"
+#include "OrientalCoreDefs.h"
 #include "ReadWritePolicies.h"
 #include "smartRegisters.h"
 #include "ResetDependency.h"
+#include "ControllerLog.h"
+#include "ControllerProfile.h"
+#include "MotionPlanner.h"
 
-//forward Declaration of OrientalFTDIHub for Use in Member Function Pointers
-class OrientalFTDIHub;
+//forward Declaration of ControllerBus for Use in Member Function Pointers
+class ControllerBus;
 class ControllerStatusMonitorThread;
+struct MotionTelemetrySample;
 
 //forward Declaration of AbstractControllerInterface Classes
 //class OrientalCRK525MAKD;
@@ -25,19 +27,37 @@ class AbstractControllerInterfaceFactory;
 template<class T>
 AbstractControllerInterface* make( void );
 
+/*  Fault Indicators of a Controller (Codes Are the Controller's Own, 0 For None)
+*/
+struct ControllerFaultState
+{
+	unsigned int alarmCode;
+	unsigned int warningCode;
+	bool stepOutDetection;		//The Controller Checks For Step-Out Itself (Otherwise Only an Encoder Readback Shows One)
+};
+
+/*  Signal Routed to a Trigger Output (See SetTriggerOutput())
+*/
+enum TriggerOutputSignal
+{
+	TriggerOutputDefault = 0,	//The Output's Power-On Signal
+	TriggerOutputInPosition,	//On Once a Move Has Finished
+	TriggerOutputArea			//On While the Command Position is Within the Trigger Window
+};
+
 
 //Abstract Base With Methods to Be Accessed From Resolver
 class AbstractControllerInterface
 {
 
 	public:
-		typedef int (OrientalFTDIHub::*SerialCommFuncPtr)( unsigned char [], int ,  AbstractControllerInterface*, bool );
+		typedef int (ControllerBus::*SerialCommFuncPtr)( unsigned char [], int ,  AbstractControllerInterface*, bool );
 
 		/* Only Constructor
 		*   @param name - Controller Specific name used for user differentiation and selection of Controller Types
 		*   Throws an Exception if serialCommPtr Has not Been Set
 		*/
-		AbstractControllerInterface( std::string name, OrientalFTDIHub* hub, SerialCommFuncPtr serialCommPtr ) : 
+		AbstractControllerInterface( std::string name, ControllerBus* hub, SerialCommFuncPtr serialCommPtr ) : 
 			name_(name),
 			serialCommHub_(hub),
 			serialCommPtr_(serialCommPtr),
@@ -46,12 +66,16 @@ class AbstractControllerInterface
 			currentTimeInc_(0),
 			monitorTimeInc_(0),
 			currentBaseAnglePartition_(400),
-			currentBaseAngle_(400)
+			currentBaseAngle_(400),
+			useEncoderReadback_(false),
+			readbackMaxAgeMS_(20),
+			moveId_(0)
 			{ 
 				SetPosWritePermission( true );
 			};
 
-		~AbstractControllerInterface();
+		//Virtual, Owners Delete Controllers Through Base and Concrete Pointers Alike
+		virtual ~AbstractControllerInterface();
 
 		/* Controller Specific Initialization Function to initialize Physical Controller Via Serial Commands
 		*   Called By Serial Hub Before any other Serial Communications may be implemented
@@ -60,6 +84,102 @@ class AbstractControllerInterface
 		*/
 		virtual int InitializePhysicalController() = 0;
 
+		/* Broadcast the Part of InitializePhysicalController() That is the Same For Every Slave (Slave Address 0, Not Answered)
+		*   Note:  Lets a hub configure all of its axes with one set of frames, each axis then only needs ReadConfiguration()
+		*    Returns - 0 if every frame was sent, or errCode otherwise (nothing confirms the slaves applied them)
+		*/
+		virtual int BroadcastCommonConfiguration() = 0;
+
+		/* Read the Configuration InitializePhysicalController() Establishes (Also Verifies the Connection)
+		*   @param fingerprint - set to the fingerprint of the values read
+		*   @param applied - set to true if every value already matches, so nothing needs writing
+		*    Returns - 0 or errCode otherwise
+		*/
+		virtual int ReadConfiguration( uint32_t& fingerprint, bool& applied ) = 0;
+
+		//Fingerprint ReadConfiguration() Reports Once the Configuration is Applied
+		virtual uint32_t GetConfigurationFingerprint() = 0;
+
+		/* Write the Configuration Values That Differed in the Last ReadConfiguration() (All of Them Without One)
+		*    Returns - 0 or errCode otherwise
+		*/
+		virtual int WriteConfigurationDifferences() = 0;
+
+		/* Check Every Setting of a Profile Against This Controller's Registers (Names, Accepted Values, Repeats)
+		*   @param error - set to a description of the first bad setting
+		*    Returns - 0 if the profile can be applied, otherwise non-zero
+		*/
+		virtual int ValidateProfile( const ControllerProfile& profile, std::string& error ) = 0;
+
+		/* Write Every Setting of a Profile, Consecutive Registers Merged Into Multi-Register Writes
+		*    Returns - 0 or errCode otherwise (settings written before a failed write stay applied)
+		*/
+		virtual int ApplyProfile( const ControllerProfile& profile ) = 0;
+
+		/* Read the Present Value of Every Setting's Register Into a Profile (Register Names as For ApplyProfile())
+		*    Returns - 0 or errCode otherwise (non-zero too for a name with no register)
+		*/
+		virtual int ReadProfile( ControllerProfile& profile ) = 0;
+
+		/* Read the Present Alarm and Warning, and Whether Step-Out Detection is On
+		*    Returns - 0 or errCode otherwise
+		*/
+		virtual int ReadFaultState( ControllerFaultState& state ) = 0;
+
+		/* Reset the Present Alarm and Clear the Warning Records
+		*    Returns - 0 or errCode otherwise
+		*/
+		virtual int ClearFaults() = 0;
+
+		/* Move With the Speed and Rates Staged by SetNextMovePlan() Instead of the Common Rates
+		*   @param enable - false returns the controller to its common rates
+		*    Returns - 0 or errCode otherwise
+		*/
+		virtual int EnableMotionPlans( bool enable ) = 0;
+
+		/* Stage the Speed and Rates of the Next Position Write, Sent in the Same Request as the Position
+		*   @param plan - used by one position write only, nullptr drops a staged plan
+		*   Note:  Ignored unless EnableMotionPlans( true ) succeeded; writes without a plan keep the last speed and rates
+		*/
+		virtual void SetNextMovePlan( const MotionPlan* plan ) = 0;
+
+		/* Run Continuously at a Velocity, Ramping to it at accelHzPerS; a New Velocity Takes Effect Without Stopping
+		*   @param stepsPerSec - signed velocity (the sign of WritePos() steps), 0 ramps down to a stop
+		*   @param accelHzPerS - acceleration and deceleration rate in steps/s^2
+		*    Returns - 0 or errCode otherwise
+		*/
+		virtual int SetContinuousVelocity( double stepsPerSec, double accelHzPerS ) = 0;
+
+		/* Stop Any Motion Through the Stop Command
+		*   @param immediate - true stops without a ramp, otherwise the motor decelerates
+		*    Returns - 0 or errCode otherwise
+		*/
+		virtual int StopMotion( bool immediate ) = 0;
+
+		/* Route a Signal to One of the Controller's Outputs (Hardware Trigger For a Camera)
+		*   @param output - 1 based output number
+		*    Returns - 0 or errCode otherwise (non-zero too for an output the controller does not have)
+		*/
+		virtual int SetTriggerOutput( unsigned int output, TriggerOutputSignal signal ) = 0;
+
+		/* Program the Command Position Window TriggerOutputArea Signals (Inclusive, in Steps)
+		*    Returns - 0 or errCode otherwise
+		*/
+		virtual int SetTriggerWindow( long fromSteps, long toSteps ) = 0;
+
+		/* Switch Position Writes Between Relative Steps and Absolute Command Positions
+		*   Note:  Absolute writes are idempotent, so a move whose answer was lost can be sent again
+		*    Returns - 0 or errCode otherwise
+		*/
+		virtual int SetAbsolutePositioning( bool absolute ) = 0;
+		virtual bool IsAbsolutePositioning() = 0;
+
+		/* Check a Position Write (Relative Steps or an Absolute Command Position) Fits the Controller's Position Register
+		*   Note:  Takes a double so a target computed out of range is not wrapped by a cast first
+		*    Returns - true if WritePos() can carry steps
+		*/
+		virtual bool IsPosInRange( double steps ) = 0;
+
 		/* Virtual Function To Send a testConnection Packet Request to verify working Order
 		*	Returns - 0 if successful or errCode otherwise
 		*/
@@ -73,22 +193,17 @@ class AbstractControllerInterface
 		*  Returns - Error Codes Returned By WritePosBuffer()
 		*/
 		template< typename T >
-		int WritePos( T posValue, int (OrientalFTDIHub::*SerialCommFuncPtr)( unsigned char txMsgBuffer[], int txMsgLen,  AbstractControllerInterface* controller, bool broadcast ) )
+		int WritePos( T posValue, int (ControllerBus::*SerialCommFuncPtr)( unsigned char txMsgBuffer[], int txMsgLen,  AbstractControllerInterface* controller, bool broadcast ) )
 		{
 			unsigned char valueArray[ sizeof(T) ];
 			for( int i = 0; i< sizeof(T); ++i )
 			{
-				std::ostringstream os2;
-				os2 << "valueArray[ " << sizeof(T) - (i + 1) << "] = " << (int) ( (unsigned char) posValue >> (8*i) ) << "\n";
 				valueArray[ sizeof(T) - (i + 1) ] = ( posValue >> ( 8*i ) );
 			}
 
-			std::ostringstream os;
-			os << "The value from WritePos before is " << posValue << " and the size is " << (int) sizeof(T) << "\n";
-			os << "The Array is " << (int) valueArray[0] << ", " << (int) valueArray[1] << ", " << (int) valueArray[2] << ", " << (int) valueArray[3];
-			AbstractControllerInterfaceFactory::LogMessage( os.str() );
+			ORIENTAL_LOG_DEBUG( "WritePos Value {} Size {} Array {}", static_cast< long long >( posValue ), (int) sizeof(T), ORIENTAL_LOG_BYTES( valueArray, sizeof(T) ) );
 
-			return WritePosBuffer( valueArray, sizeof(T), true, (*SerialCommFuncPtr) );
+			return WritePosBuffer( valueArray, sizeof(T), true, SerialCommFuncPtr );
 		}
 
 		/*  @OVERLOAD Single Parameter - Passes Current serialCommPtr_ For Serial Communication
@@ -113,12 +228,10 @@ class AbstractControllerInterface
 						
 			for( int i = 0; i< sizeof(T); ++i )
 			{
-				AbstractControllerInterfaceFactory::LogMessage( "Repeating for I" );
 				valueArray[ sizeof(T) - (i + 1) ] = ( posValue >> ( 8*i ) );
 			}
 
-
-			AbstractControllerInterfaceFactory::LogMessage( "Here is the Outside" );
+			ORIENTAL_LOG_TRACE( "WritePos Value {}", static_cast< long long >( posValue ) );
 			//Implement Virtual Function From Child
 			errCode = WritePosBuffer( valueArray, sizeof(T), true );
 
@@ -141,6 +254,7 @@ class AbstractControllerInterface
 
 		/* Templated Function that takes a reference to Any-Type Position Value and fills it with the Position Read From Serial Communication
 		*   Note:  This Function Implements the virtual function ReadPosBuffer using the BigEndian Array
+		*   Note2: Signed Types Wider than the Returned Buffer are Sign Extended
 		*  @param posValue - Typed Value to be filled with Byte Response
 		*  Returns - Number of Bytes Returned or Error Codes ( < 0 )
 		*/
@@ -151,11 +265,20 @@ class AbstractControllerInterface
 			unsigned char posValueArray[ sizeof(T) ];
 			errCode = ReadPosBuffer( posValueArray, sizeof(T) );
 
-			//Since errCode is < 0, only numBytes returned will make this work
+			if( errCode <= 0 )
+			{
+				return errCode;
+			}
+
 			//Returned BigEndian From Virtual Function
+			posValue = 0;
+			if( static_cast<T>(-1) < static_cast<T>(0) && ( posValueArray[0] & 0x80 ) != 0 )
+			{
+				posValue = static_cast<T>(-1);
+			}
 			for( int i = 0; i < errCode; ++i )
 			{
-				posValue = posValueArray[ i ] << ( 8 * ( errCode - (i + 1) ) );
+				posValue = static_cast<T>( ( posValue << 8 ) | posValueArray[ i ] );
 			}
 
 			return errCode;
@@ -191,9 +314,10 @@ class AbstractControllerInterface
 
 			//Since errCode is < 0, only numBytes returned will make this work
 			//Returned BigEndian From Virtual Function
+			addrValue = 0;
 			for( int i = 0; i < errCode; ++i )
 			{
-				addrValue = addrValueArray[ i ] << ( 8 * ( errCode - (i + 1) ) );
+				addrValue = static_cast<T>( ( addrValue << 8 ) | addrValueArray[ i ] );
 			}
 
 			return errCode;
@@ -216,7 +340,7 @@ class AbstractControllerInterface
 
 			int errCode;
 			unsigned char speedValueArray[ sizeof(T) ];
-			ReadWrite< T, true >::read( speadValueArray, sizeof(T), speedValue );
+			ReadWrite< T, true >::read( speedValueArray, sizeof(T), speedValue );
 
 			errCode = WriteStepSpeedBuffer( speedValueArray, sizeof(T) );
 
@@ -263,6 +387,42 @@ class AbstractControllerInterface
 			return WritePosBuffer( serializedValue, serializedValueLen, isBigEndian, serialCommPtr_ );
 		};
 
+		/* Load a Position Into the Controller Without Starting the Move (the Part of WritePosBuffer() Before the Start Command)
+		*   Note:  The move is started by BroadcastStart() (or a later WritePosBuffer()), so several axes can start on one frame
+		*   @param serializedValue[] - buffer of unsigned characters representative of Pos Value
+		*   @param serializedValueLen - Length of the defined buffer Values
+		*   @param isBigEndian - Refers to Whether the Buffer is Big or Little Endian
+		*   Returns - Error Codes or 0 if the position was loaded
+		*/
+		virtual int PreloadPosBuffer( unsigned char serializedValue[], int serializedValueLen, bool isBigEndian ) = 0;
+
+		/* Start Every Controller on the Bus That Shares This Protocol With One Broadcast Frame (No Response Comes Back)
+		*   Note:  Controllers Not Preloaded Repeat Their Last Loaded Position, so Every Axis on the Bus Must be Preloaded
+		*   Returns - Error Codes or 0 if the frame was sent
+		*/
+		virtual int BroadcastStart( void ) = 0;
+
+		/* Templated Function that Loads Any-Type Position Value Without Starting the Move (See PreloadPosBuffer())
+		*  @param posValue - Typed Value to be parsed into BigEndian unsigned Array
+		*  Returns - 12 if not Able to write currently, other Error Codes Returned By PreloadPosBuffer()
+		*/
+		template< typename T >
+		int PreloadPos( T posValue )
+		{
+			if( GetPosWritePermission() == false )
+			{
+				return 12;
+			}
+
+			unsigned char valueArray[ sizeof(T) ];
+			for( int i = 0; i< sizeof(T); ++i )
+			{
+				valueArray[ sizeof(T) - (i + 1) ] = ( posValue >> ( 8*i ) );
+			}
+
+			return PreloadPosBuffer( valueArray, sizeof(T), true );
+		}
+
 		/* Process for Reading Position From Serial Request and returning it in a BigEndian Byte Array
 		*   @param readBuffer[] - Buffer to Return BigEndian Byte Ordered Position Value
 		*   @param bufferSize - Size of the Buffer passed
@@ -270,6 +430,40 @@ class AbstractControllerInterface
 		*/
 		virtual int ReadPosBuffer( unsigned char readBuffer[], int bufferSize ) = 0;
 
+		/* Discard Any Cached Position Readback So the Next ReadPosBuffer() Queries the Controller
+		*   Note:  Implementations that do not cache readback may leave this empty
+		*/
+		virtual void InvalidatePosReadback( void ) = 0;
+
+		/* Read the Controller's Motion Monitor Registers Into One Timestamped Sample
+		*   Note:  Always Queries the Controller (Used by MotionTelemetrySampler)
+		*   @param sample - Filled With the Values Read
+		*   Returns - 0 on completion or errorCodes otherwise
+		*/
+		virtual int ReadMotionTelemetry( MotionTelemetrySample& sample ) = 0;
+
+		/* Discard Cached Readback Once a Start (or Stop) Command Was Accepted, and Let Blocks Read Soon After Age Out as Moving Ones
+		*   Note:  Call after the command, not before:  a read between an earlier invalidation and the start would cache a resting block
+		*   Note:  Implementations that do not cache readback may leave this empty
+		*/
+		virtual void MarkPosReadbackMoving( void ) = 0;
+
+		/* Select the Source Serialized by ReadPosBuffer()
+		*   @param useEncoder - true to report the encoder counter (only meaningful with an encoder fitted), false for the command position
+		*/
+		void SetEncoderReadback( bool useEncoder ) { useEncoderReadback_ = useEncoder; }
+		bool GetEncoderReadback( void ) const { return useEncoderReadback_; }
+
+		/* Set How Long Readback Cached During a Move Stays Valid
+		*   Note:  Readback cached while the motor is resting stays valid until the next position write
+		*   @param maxAgeMS - maximum age in milliseconds (0 forces a serial read on every query during a move)
+		*/
+		void SetReadbackMaxAgeMS( double maxAgeMS ) { readbackMaxAgeMS_ = ( maxAgeMS < 0 ) ? 0 : maxAgeMS; }
+		double GetReadbackMaxAgeMS( void ) const { return readbackMaxAgeMS_; }
+
+		//ID of the Most Recent Move Started on the Controller (0 Before the First), Tags Recorded Telemetry
+		uint32_t GetMoveId( void ) const { return moveId_; }
+
 		/* Controller Specific Logic to take the transmit message last sent and look up anticipate header length in bytes
 		*	Used specifically by Hub Serial communications to Determine Recieved Data Header Length Read
 		*	@param txBuffer[] - Byte Message that was sent, used to be evaluated
@@ -304,6 +498,21 @@ class AbstractControllerInterface
 		*/
 		virtual int parseData( const unsigned char txMsgBuffer[], const int txMsgBufLen, const unsigned char rxBuffer[], const int rxBufLen ) = 0;
 
+		/* Classify a Response That parseData() Rejected, Used For Hub Bus Statistics
+		*   Note:  Defaults Report Neither, Controllers With a Frame Check or Exception Responses Should Override
+		*   @param rxBuffer[] - Full Response (Header and Data)
+		*   @param rxBufLen - length of rxBuffer
+		*/
+		virtual bool isCorruptResponse( const unsigned char rxBuffer[], const int rxBufLen ) { return false; }
+		virtual bool isExceptionResponse( const unsigned char rxBuffer[], const int rxBufLen ) { return false; }
+
+		/* Whether Sending a Request Again Leaves the Slave as Sending it Once Would (Hub Retries After a Timeout or Corrupt Response)
+		*   Note:  Defaults to Never, so a Controller is Only Retried Once it Says Which Requests Are Safe
+		*   @param txMsgBuffer[] - complete request frame
+		*   @param txMsgBufLen - length of txMsgBuffer
+		*/
+		virtual bool isIdempotentRequest( const unsigned char txMsgBuffer[], const int txMsgBufLen ) { return false; }
+
 		/* Get Controller Specific name used in user controller selection
 		*	Return - the controller specific string defined permanently in the Implementing Controller Constructor
 		*/
@@ -326,7 +535,7 @@ class AbstractControllerInterface
 		*    @param serialCommPtr - Pointer from OrientalHub Function that is chosen to be used (May change based on hardward from USB)
 		*    Return - 0 if ok.  -1 if ptr is somehow nullptr
 		*/
-		int setSerialCommHubPtr( OrientalFTDIHub* serialCommHubPtr );
+		int setSerialCommHubPtr( ControllerBus* serialCommHubPtr );
 
 		/* Gets ControllerStatusMonitorThread* to Object that was stored in focus initialization
 		*    Note:  Fails if setSerialCommHubPtr() has not been called
@@ -389,7 +598,7 @@ class AbstractControllerInterface
 				return nullptr;
 			}
 
-			return regAddressMap_[ addr ];
+			return it->second;
 
 		}
 
@@ -575,10 +784,10 @@ class AbstractControllerInterface
 		*   Note: This will be hard-coded for every new controller
 		*   Note:  Used to display all available step Increments for a selected Base Angle
 		*   @param baseAngleOption - the current BaseAngle Being Queried
-		*   Returns - vector of doubles or an empty vector if there is a problem
+		*   Returns - vector of doubles or an empty vector if there is a problem (Owned by the Controller, Valid For its Lifetime)
 		*/
 
-		virtual std::vector<double> GetBaseAnglePartitionOptions( double baseAngleOption ) = 0; 
+		virtual const std::vector<double>& GetBaseAnglePartitionOptions( double baseAngleOption ) = 0; 
 
 		/* get the currentBaseAnglePartition_ as set by SetBaseAnglePartition
 		*   LightWeight Function that assumes any implementations invoked the set command
@@ -824,7 +1033,7 @@ class AbstractControllerInterface
 		}
 
 		//Used to Pass Up the hub being referenced by the SerialCommFuncPtr to Child Classes Without allowing them to change
-		OrientalFTDIHub* retrieveSerialCommHubPtr( void )
+		ControllerBus* retrieveSerialCommHubPtr( void )
 		{
 			return serialCommHub_;
 		}
@@ -832,6 +1041,13 @@ class AbstractControllerInterface
 		//Thread Lock Available For IsMotorBusy() Implementations
 		MMThreadLock busyLock_;
 
+		//Position Readback Policy (See SetEncoderReadback() and SetReadbackMaxAgeMS())
+		bool useEncoderReadback_;
+		double readbackMaxAgeMS_;
+
+		//Incremented by Implementations Each Time a Move is Started
+		uint32_t moveId_;
+
 	private:
 
 		/* Set Address from a Big Endian Buffer Representation of an Address
@@ -845,7 +1061,7 @@ class AbstractControllerInterface
 		//Default Serial Communication Function Pointer (Passed From OrientalHub in Creation)
 		SerialCommFuncPtr serialCommPtr_;
 		//Hub Object Used for Calling serialCommPtr;		
-		OrientalFTDIHub* serialCommHub_; 
+		ControllerBus* serialCommHub_; 
 
 		std::string name_;
 
@@ -928,7 +1144,7 @@ class ControllerInterface : public AbstractControllerInterface {
 
 	public:
 
-		ControllerInterface( std::string name, OrientalFTDIHub* hub, AbstractControllerInterface::SerialCommFuncPtr serialCommPtr ) : AbstractControllerInterface( name, hub, serialCommPtr ), address_(0) {}
+		ControllerInterface( std::string name, ControllerBus* hub, AbstractControllerInterface::SerialCommFuncPtr serialCommPtr ) : AbstractControllerInterface( name, hub, serialCommPtr ), address_(0) {}
 		~ControllerInterface(){}
 
 		/* Set Address from a Big Endian Buffer Representation of an Address
@@ -954,7 +1170,7 @@ class ControllerInterface : public AbstractControllerInterface {
 				{
 					if( serializedAddrBuffer[i] != 0 )
 					{
-						AbstractControllerInterfaceFactory::LogMessage("There is a type mismatch!");
+						ORIENTAL_LOG_WARN( "SetAddress Type Mismatch, Buffer Size {}", bufferSize );
 						return -1;
 					}
 				}
@@ -963,19 +1179,11 @@ class ControllerInterface : public AbstractControllerInterface {
 			addressType tempVal;
 			if( ReadWrite< addressType, true >::write( &serializedAddrBuffer[addrTypeValueIndex], sizeof(addressType), tempVal ) != 0 )
 			{
-				AbstractControllerInterfaceFactory::LogMessage("ReadWriteProblem");
+				ORIENTAL_LOG_WARN( "SetAddress Could Not Deserialize Address" );
 				return -2;
 			}
 
-			std::ostringstream os;
-			os << "Buffer Size is " << bufferSize << "\n The Value to be stored is " << (int) tempVal << "\n" ;
-
-			for( int i = 0; i < bufferSize; i++ )
-			{
-				os << "Buffer [" << i << "] = " << (int) serializedAddrBuffer[i] << "\n";
-			}
-
-			AbstractControllerInterfaceFactory::LogMessage( os.str() );
+			ORIENTAL_LOG_DEBUG( "SetAddress Buffer Size {} Value {} Buffer {}", bufferSize, (int) tempVal, ORIENTAL_LOG_BYTES( serializedAddrBuffer, bufferSize ) );
 
 			address_ = tempVal;
 			return DEVICE_OK;
@@ -1011,41 +1219,42 @@ public:
 };
 
 
-typedef AbstractControllerInterface* (*ControllerMaker)( OrientalFTDIHub* hub, AbstractControllerInterface::SerialCommFuncPtr serialCommPtr );
+typedef AbstractControllerInterface* (*ControllerMaker)( ControllerBus* hub, AbstractControllerInterface::SerialCommFuncPtr serialCommPtr );
 
+//Selectable Controller:  name Must Match getName() of What maker Builds
+struct ControllerOption
+{
+	const char* name;
+	ControllerMaker maker;
+};
+
+/*  Stateless Controller Factory:  The Options Are a Constant Table, so Any Number of Hubs May Use it Concurrently
+*     Logging is Per Hub (Each Registers its Own Sink, See ControllerLog)
+*/
 class AbstractControllerInterfaceFactory
 {
 	private:
 		AbstractControllerInterfaceFactory(){};
 		~AbstractControllerInterfaceFactory(){};
 
-		static bool loggerRegistered_;
-
 	public:
 
 		//read all keys
 		static std::vector<std::string> ReadAllOptionNames( void );
 
 		//Return single ControllerOption
-		static AbstractControllerInterface* GetNewControllerOption( std::string name, OrientalFTDIHub* hub,  AbstractControllerInterface::SerialCommFuncPtr serialCommPtr );
+		static AbstractControllerInterface* GetNewControllerOption( std::string name, ControllerBus* hub,  AbstractControllerInterface::SerialCommFuncPtr serialCommPtr );
 
-		static void RegisterLogger( MM::Device* caller ,MM::Core * LogCore ) { loggerRegistered_ = true; Caller_ = caller; LogCore_ = LogCore; LogCore_->LogMessage( Caller_, "IN Registration of AbstractControllerInterface", true);  return;};
+		static void RegisterLogger( ControllerLogSink* sink );
+		static void UnregisterLogger( ControllerLogSink* sink );
 		static void LogMessage( std::string msg /*More Arguments */ );
 		static void LogMessage( char * msg);
 
 	private:
 
-		static int Initialize();
-		static bool initialized_;
-		//Change availableControllers if new Controller is coded
-		static ControllerMaker const availableControllers_[];
-
-		//Stores Name and corresponding index for availableControllers_
-		static std::map< std::string, ControllerMaker > controllerOptions_;
-		static std::map< std::string, ControllerMaker >::iterator iterator_;
-
-		static MM::Device * Caller_;
-		static MM::Core* LogCore_;
+		//Change availableControllers_ if new Controller is coded
+		static const ControllerOption availableControllers_[];
+		static const size_t numAvailableControllers_;
 
 
 };
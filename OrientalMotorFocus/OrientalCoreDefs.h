@@ -0,0 +1,117 @@
+#ifndef _ORIENTAL_CORE_DEFS_
+#define _ORIENTAL_CORE_DEFS_
+
+/*
+*  Everything the Controller Core Takes From MMDevice:  Error Codes, MM::MaxStrLength and the Thread Primitives
+*     The Device Adapter Includes MMDevice Itself; With ORIENTAL_HEADLESS_CORE Defined (the CMake Library, Tests and Tools)
+*     the Core Builds From the Definitions Below Instead
+*     Note:  Values Must Stay Equal to MMDeviceConstants.h, Core Error Codes Reach Micro-Manager Unchanged
+*/
+#ifndef ORIENTAL_HEADLESS_CORE
+
+#include "../../MMDevice/MMDeviceConstants.h"
+#include "../../MMDevice/DeviceThreads.h"
+
+#else
+
+#include <pthread.h>
+
+namespace MM {
+	const int MaxStrLength = 1024;
+}
+
+#define DEVICE_OK							0
+#define DEVICE_ERR							1
+#define DEVICE_INVALID_PROPERTY_VALUE		3
+#define DEVICE_NOT_SUPPORTED				9
+#define DEVICE_UNKNOWN_POSITION				12
+#define DEVICE_SERIAL_INVALID_RESPONSE		16
+#define DEVICE_SERIAL_TIMEOUT				17
+#define DEVICE_INVALID_INPUT_PARAM			21
+#define DEVICE_NOT_CONNECTED				35
+#define DEVICE_SEQUENCE_TOO_LARGE			39
+
+/*  Recursive Lock, Same Contract as MMDevice's MMThreadLock
+*/
+class MMThreadLock
+{
+	public:
+		MMThreadLock()
+		{
+			pthread_mutexattr_t attr;
+			pthread_mutexattr_init( &attr );
+			pthread_mutexattr_settype( &attr, PTHREAD_MUTEX_RECURSIVE );
+			pthread_mutex_init( &lock_, &attr );
+			pthread_mutexattr_destroy( &attr );
+		}
+		~MMThreadLock() { pthread_mutex_destroy( &lock_ ); }
+
+		void Lock( void ) { pthread_mutex_lock( &lock_ ); }
+		void Unlock( void ) { pthread_mutex_unlock( &lock_ ); }
+
+	private:
+		pthread_mutex_t lock_;
+
+		MMThreadLock( const MMThreadLock& );
+		MMThreadLock& operator=( const MMThreadLock& );
+};
+
+/*  Holds a Lock For its Scope (a nullptr Lock is Ignored)
+*/
+class MMThreadGuard
+{
+	public:
+		MMThreadGuard( MMThreadLock& lock ) : lock_(&lock) { lock_->Lock(); }
+		MMThreadGuard( MMThreadLock* lock ) : lock_(lock) { if( lock_ != nullptr ) lock_->Lock(); }
+		~MMThreadGuard() { if( lock_ != nullptr ) lock_->Unlock(); }
+
+	private:
+		MMThreadLock* lock_;
+
+		MMThreadGuard( const MMThreadGuard& );
+		MMThreadGuard& operator=( const MMThreadGuard& );
+};
+
+/*  Thread Running svc(), Started by activate() and Joined by wait()
+*/
+class MMDeviceThreadBase
+{
+	public:
+		MMDeviceThreadBase() : started_(false) {}
+		virtual ~MMDeviceThreadBase() {}
+
+		virtual int svc( void ) = 0;
+
+		virtual int activate( void )
+		{
+			if( pthread_create( &thread_, nullptr, ThreadProc, this ) != 0 )
+			{
+				return 1;
+			}
+			started_ = true;
+			return 0;
+		}
+
+		void wait( void )
+		{
+			if( started_ )
+			{
+				pthread_join( thread_, nullptr );
+				started_ = false;
+			}
+		}
+
+	private:
+		static void* ThreadProc( void* param )
+		{
+			static_cast< MMDeviceThreadBase* >( param )->svc();
+			return nullptr;
+		}
+
+		pthread_t thread_;
+		bool started_;
+};
+
+#endif
+
+#endif
@@ -5,6 +5,14 @@
 const char* const g_OrientalHubName = "OrientalStepperAdjuster";
 const char* const g_GenericUsbHubPropName = "Oriental Motor USB Controller Hub";
 const char* const g_GenericHubFoundPrefix = "COM ";  //Prefix for GenericUsbHubName
+
+//FTDI Enumeration (COM Ports Persisted by Serial Number in the Working Directory, Rescan Only Opens New Devices)
+const char* const g_OrientalFTDIPortCacheFile = "OrientalMotorFTDIPorts.txt";
+//Configuration Fingerprints Per Bus Serial Number and Slave Address (Working Directory)
+const char* const g_OrientalConfigFingerprintFile = "OrientalMotorConfigFingerprints.txt";
+const char* const g_OrientalFTDIRescanName = "Rescan FTDI Devices";
+const char* const g_OrientalFTDIRescanIdleOption = "Idle";
+const char* const g_OrientalFTDIRescanRunOption = "Rescan";
 const char* const g_ControllerDevicePrefix = "Controller #";
 const double g_maxPeripherals = 12;
 
@@ -25,4 +33,101 @@ const char* const g_OrientalBaseAnglePartitionOptionsName = "Partitions of Selec
 const char* const g_OrientalBaseAngleOptionsName = "Motor Base Step Angle";
 const char* const g_OrientalRestingEnergyStateName = "Resting Energized State";
 
+const char* const g_OrientalReadbackSourceName = "Position Readback Source";
+const char* const g_OrientalReadbackCommandOption = "Command Position";
+const char* const g_OrientalReadbackEncoderOption = "Encoder Counter";
+const char* const g_OrientalReadbackMaxAgeName = "Position Readback Max Age (ms)";
+const char* const g_OrientalEncoderCountsPerRevName = "Encoder Counts Per Rev";
+
+const char* const g_OrientalTelemetryStateName = "Motion Telemetry";
+const char* const g_OrientalTelemetryIntervalName = "Motion Telemetry Interval (ms)";
+const char* const g_OrientalTelemetryFileName = "Motion Telemetry File";
+const char* const g_OrientalTelemetrySampleCountName = "Motion Telemetry Samples";
+const char* const g_OrientalTelemetryDroppedCountName = "Motion Telemetry Samples Dropped";
+
+//End-to-End Move Latency Benchmark (Run Moves the Stage, Results Go to the Report File as JSON)
+const char* const g_OrientalMoveLatencyBenchmarkName = "Move Latency Benchmark";
+const char* const g_OrientalMoveLatencyIdleOption = "Idle";
+const char* const g_OrientalMoveLatencyRunOption = "Run";
+const char* const g_OrientalMoveLatencyReportFileName = "Move Latency Report File";
+
+const char* const g_OrientalTelemetryRecordingFileName = "Telemetry Recording File";
+
+const char* const g_OrientalBusCaptureFileName = "Bus Capture File";
+const char* const g_OrientalBusReplayFileName = "Bus Replay File";
+const char* const g_OrientalBusReplayTimingName = "Bus Replay Timing";
+const char* const g_OrientalBusReplayOriginalOption = "Original";
+const char* const g_OrientalBusReplayFastOption = "As Fast As Possible";
+const char* const g_OrientalBusReplayMismatchesName = "Bus Replay Mismatches";
+
+//Simulated CRK Slaves in Place of the Bus (Pre-Initialization, so Every Device Can Initialize Against it)
+const char* const g_OrientalBusSimulationName = "Bus Simulation";
+const char* const g_OrientalBusSimulationBaudName = "Bus Simulation Baud Rate";
+const char* const g_OrientalBusSimulationLatencyName = "Bus Simulation USB Latency (ms)";
+const char* const g_OrientalBusSimulationSpeedName = "Bus Simulation Motor Speed (steps/s)";
+
+const char* const g_OrientalBusStatsPrefix = "Bus Stats ";
+const char* const g_OrientalBusStatsTotalName = "Bus Stats Total";
+const char* const g_OrientalBusStatsSlaveName = "Bus Stats Slave Address";
+const char* const g_OrientalBusStatsSelectedSlaveName = "Bus Stats Selected Slave";
+const char* const g_OrientalBusStatsResetName = "Bus Stats Reset";
+const char* const g_OrientalBusStatsResetIdleOption = "Idle";
+const char* const g_OrientalBusStatsResetOption = "Reset";
+
+//Controller Logging (Values Are ControllerLog::LevelName())
+const char* const g_OrientalControllerLogLevelName = "Controller Log Level";
+const char* const g_OrientalControllerLogDroppedName = "Controller Log Dropped";
+
+//Span Tracing (Chrome Trace Event Export)
+const char* const g_OrientalTraceStateName = "Trace Recording";
+const char* const g_OrientalTraceExportFileName = "Trace Export File";
+const char* const g_OrientalTraceEventCountName = "Trace Events";
+const char* const g_OrientalTraceDroppedCountName = "Trace Events Dropped";
+
+//Protocol Layer Microbenchmark (Runs Against a Scratch Controller, the Line is Not Used)
+const char* const g_OrientalProtocolBenchmarkName = "Protocol Benchmark";
+const char* const g_OrientalProtocolBenchmarkIdleOption = "Idle";
+const char* const g_OrientalProtocolBenchmarkRunOption = "Run";
+const char* const g_OrientalProtocolBenchmarkReportName = "Protocol Benchmark Report";
+
+//Broadcast-Synchronized Group Move ("address:steps[,address:steps...]", Registered Axes Not Listed Hold With 0 Steps)
+const char* const g_OrientalSynchronizedMoveName = "Synchronized Move";
+const char* const g_OrientalSynchronizedMoveReportName = "Synchronized Move Report";
+
+//Per-Axis Results of the Hub's Batched Physical Initialization
+const char* const g_OrientalPeripheralInitReportName = "Peripheral Initialization Report";
+
+//Named Register Profiles (See ControllerProfileFile), Checked When the File is Set and Applied by Selecting One
+const char* const g_OrientalProfileFileName = "Controller Profile File";
+const char* const g_OrientalProfileName = "Controller Profile";
+const char* const g_OrientalProfileNoneOption = "None";
+
+//Per-Move Speed and Rates (See MotionPlanner), Limits in Knob Revolutions
+const char* const g_OrientalMotionPlannerName = "Motion Planner";
+const char* const g_OrientalMotionPlannerMaxSpeedName = "Motion Planner Max Speed (rev/s)";
+const char* const g_OrientalMotionPlannerMaxAccelName = "Motion Planner Max Acceleration (rev/s^2)";
+const char* const g_OrientalMotionPlannerSettleToleranceName = "Motion Planner Settle Tolerance (um)";
+const char* const g_OrientalMotionPlannerSettleTimeConstantName = "Motion Planner Settle Time Constant (ms)";
+
+//Motion Profile Tuning Sweep (See MotionProfileTuner), Moves the Stage Through Every Grid Point
+const char* const g_OrientalMotionTunerName = "Motion Profile Tuner";
+const char* const g_OrientalMotionTunerIdleOption = "Idle";
+const char* const g_OrientalMotionTunerRunOption = "Run";
+const char* const g_OrientalMotionTunerReportFileName = "Motion Profile Tuner Report File";
+const char* const g_OrientalMotionTunerProfileFileName = "Motion Profile Tuner Profile File";
+
+//Controller Output Fired For Camera Synchronization, and the Stage Sequences That Use it (See StageSequenceExecutor)
+const char* const g_OrientalTriggerOutputName = "Trigger Output";
+const char* const g_OrientalTriggerOutputNoneOption = "None";
+const char* const g_OrientalTriggerSignalName = "Trigger Signal";
+const char* const g_OrientalTriggerInPositionOption = "In Position";
+const char* const g_OrientalTriggerAreaOption = "Area";
+const char* const g_OrientalTriggerWindowName = "Trigger Window (um)";
+const char* const g_OrientalSequenceDwellName = "Sequence Dwell (ms)";
+
+//Whether OnPosition() Writes Relative Moves or Absolute Command Positions (Absolute Writes Can be Retried)
+const char* const g_OrientalPositioningModeName = "Positioning Mode";
+const char* const g_OrientalPositioningIncrementalOption = "Incremental";
+const char* const g_OrientalPositioningAbsoluteOption = "Absolute";
+
 #endif
\ No newline at end of file
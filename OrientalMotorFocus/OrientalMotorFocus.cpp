@@ -2,6 +2,10 @@
 #include "../../MMDevice/ModuleInterface.h"
 #include "OrientalDeviceConstants.h"
 #include "AlternativeUtils.h"
+#include "ControllerTrace.h"
+#include "MoveLatencyBenchmark.h"
+#include "MotionProfileTuner.h"
+#include "StageSequenceExecutor.h"
 #include <cmath>
 #include "OrientalMotorExceptions.h"
 
@@ -101,8 +105,25 @@ OrientalMotorFocus::OrientalMotorFocus(std::string name) :
    controller_(nullptr),
    adjuster_(nullptr),
    hub_(nullptr),
+   telemetry_(nullptr),
+   sequenceable_( false ),
    busy_( false ),
-   baseAngleChangeSignal_(false)
+   baseAngleChangeSignal_(false),
+   readbackAnchored_(false),
+   readbackOriginSteps_(0),
+   readbackOriginUm_(0.0),
+   encoderCountsPerRev_(500),
+   axisInitPending_(false),
+   motionPlannerEnabled_(false),
+   continuousDriven_(false),
+   triggerOutput_(0),
+   triggerSignal_(TriggerOutputInPosition),
+   triggerWindowUm_(0.5),
+   sequenceDwellMs_(0),
+   sequenceExecutor_(nullptr),
+   absoluteOriginSteps_(0),
+   absoluteOriginUm_(0.0),
+   absoluteTargetSteps_(0)
 {
 	AbstractControllerInterfaceFactory::LogMessage("Knob Value");
 	InitializeDefaultErrorMessages();
@@ -172,11 +193,15 @@ int OrientalMotorFocus::Initialize()
    char hubLabel[MM::MaxStrLength];
    hub_->GetLabel(hubLabel);
    assert( hub_ != nullptr);
+   //Controller Logging From This Device Goes to its Own Hub
+   ControllerLogScope logScope( hub_->GetLogSink() );
    SetParentID(hubLabel); 
    //set controller_ hub property to desired property
    //This Also updates The MonitorThread Pointer
    //(Sad Reality of non-uniform Constructor-to-Initialize Calls)
    controller_->setSerialCommHubPtr( hub_ );
+   //Axes Sharing the Bus Take Part in the Hub's Synchronized Moves
+   hub_->RegisterAxis( controller_, this );
 
    // set property list
    // -----------------
@@ -190,8 +215,7 @@ int OrientalMotorFocus::Initialize()
 
    // Sequenceability
    // --------
-   //pAct = new CPropertyAction (this, &OrientalMotorFocus::OnSequence);
-   pAct = nullptr;
+   pAct = new CPropertyAction (this, &OrientalMotorFocus::OnSequence);
    ret = CreateStringProperty("UseSequences", "No", false, pAct);
    AddAllowedValue("UseSequences", "No");
    AddAllowedValue("UseSequences", "Yes");
@@ -229,6 +253,170 @@ int OrientalMotorFocus::Initialize()
    stringOptions.push_back( std::string( "Disable" ) );
    SetAllowedValues( g_OrientalRestingEnergyStateName, stringOptions );
 
+   //Position Readback Source and Freshness
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnReadbackSourceSelect);
+   ret = CreateProperty(g_OrientalReadbackSourceName, g_OrientalReadbackCommandOption, MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   AddAllowedValue( g_OrientalReadbackSourceName, g_OrientalReadbackCommandOption );
+   AddAllowedValue( g_OrientalReadbackSourceName, g_OrientalReadbackEncoderOption );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnReadbackMaxAge);
+   ret = CreateProperty(g_OrientalReadbackMaxAgeName, CDeviceUtils::ConvertToString( controller_->GetReadbackMaxAgeMS() ), MM::Float, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   SetPropertyLimits( g_OrientalReadbackMaxAgeName, 0, 1000 );
+
+   //Motion Telemetry (Sampler is Idle Until Enabled)
+   telemetry_ = new MotionTelemetrySampler( controller_, hub_ );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnTelemetryState);
+   ret = CreateProperty(g_OrientalTelemetryStateName, "Disable", MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   AddAllowedValue( g_OrientalTelemetryStateName, "Enable" );
+   AddAllowedValue( g_OrientalTelemetryStateName, "Disable" );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnTelemetryInterval);
+   ret = CreateProperty(g_OrientalTelemetryIntervalName, CDeviceUtils::ConvertToString( telemetry_->GetIntervalMS() ), MM::Integer, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   SetPropertyLimits( g_OrientalTelemetryIntervalName, 1, 10000 );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnTelemetryFile);
+   ret = CreateProperty(g_OrientalTelemetryFileName, "", MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnTelemetrySampleCount);
+   ret = CreateProperty(g_OrientalTelemetrySampleCountName, "0", MM::Integer, true, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnTelemetryDroppedCount);
+   ret = CreateProperty(g_OrientalTelemetryDroppedCountName, "0", MM::Integer, true, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+
+   //Move Latency Benchmark (Idle Until Run)
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnMoveLatencyBenchmark);
+   ret = CreateProperty(g_OrientalMoveLatencyBenchmarkName, g_OrientalMoveLatencyIdleOption, MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   AddAllowedValue( g_OrientalMoveLatencyBenchmarkName, g_OrientalMoveLatencyIdleOption );
+   AddAllowedValue( g_OrientalMoveLatencyBenchmarkName, g_OrientalMoveLatencyRunOption );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnMoveLatencyReportFile);
+   ret = CreateProperty(g_OrientalMoveLatencyReportFileName, "", MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnEncoderCountsPerRev);
+   ret = CreateProperty(g_OrientalEncoderCountsPerRevName, CDeviceUtils::ConvertToString( encoderCountsPerRev_ ), MM::Float, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   SetPropertyLimits( g_OrientalEncoderCountsPerRevName, 1, 1000000 );
+
+   //Controller Profiles (Only "None" Until a Profile File is Set)
+   activeProfile_ = g_OrientalProfileNoneOption;
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnProfileFile);
+   ret = CreateProperty(g_OrientalProfileFileName, "", MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnProfileSelect);
+   ret = CreateProperty(g_OrientalProfileName, g_OrientalProfileNoneOption, MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   AddAllowedValue( g_OrientalProfileName, g_OrientalProfileNoneOption );
+
+   //Motion Planner (Disabled Keeps the Controller's Common Rates)
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnMotionPlannerState);
+   ret = CreateProperty(g_OrientalMotionPlannerName, "Disable", MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   AddAllowedValue( g_OrientalMotionPlannerName, "Enable" );
+   AddAllowedValue( g_OrientalMotionPlannerName, "Disable" );
+
+   const MotionPlannerConfig& plannerConfig = motionPlanner_.GetConfig();
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnMotionPlannerMaxSpeed);
+   ret = CreateProperty(g_OrientalMotionPlannerMaxSpeedName, CDeviceUtils::ConvertToString( plannerConfig.maxSpeedRevPerS ), MM::Float, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   SetPropertyLimits( g_OrientalMotionPlannerMaxSpeedName, 0.01, 100 );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnMotionPlannerMaxAccel);
+   ret = CreateProperty(g_OrientalMotionPlannerMaxAccelName, CDeviceUtils::ConvertToString( plannerConfig.maxAccelRevPerS2 ), MM::Float, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   SetPropertyLimits( g_OrientalMotionPlannerMaxAccelName, 0.1, 10000 );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnMotionPlannerSettleTolerance);
+   ret = CreateProperty(g_OrientalMotionPlannerSettleToleranceName, CDeviceUtils::ConvertToString( plannerConfig.settleToleranceUm ), MM::Float, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   SetPropertyLimits( g_OrientalMotionPlannerSettleToleranceName, 0, 100 );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnMotionPlannerSettleTimeConstant);
+   ret = CreateProperty(g_OrientalMotionPlannerSettleTimeConstantName, CDeviceUtils::ConvertToString( plannerConfig.settleTimeConstantMs ), MM::Float, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   SetPropertyLimits( g_OrientalMotionPlannerSettleTimeConstantName, 0, 1000 );
+
+   //Motion Profile Tuner (Idle Until Run)
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnMotionTuner);
+   ret = CreateProperty(g_OrientalMotionTunerName, g_OrientalMotionTunerIdleOption, MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   AddAllowedValue( g_OrientalMotionTunerName, g_OrientalMotionTunerIdleOption );
+   AddAllowedValue( g_OrientalMotionTunerName, g_OrientalMotionTunerRunOption );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnMotionTunerReportFile);
+   ret = CreateProperty(g_OrientalMotionTunerReportFileName, "", MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnMotionTunerProfileFile);
+   ret = CreateProperty(g_OrientalMotionTunerProfileFileName, "", MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+
+   //Trigger Output (None Leaves the Controller's Outputs as They Are)
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnTriggerOutput);
+   ret = CreateProperty(g_OrientalTriggerOutputName, g_OrientalTriggerOutputNoneOption, MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   AddAllowedValue( g_OrientalTriggerOutputName, g_OrientalTriggerOutputNoneOption );
+   AddAllowedValue( g_OrientalTriggerOutputName, "OUT1" );
+   AddAllowedValue( g_OrientalTriggerOutputName, "OUT2" );
+   AddAllowedValue( g_OrientalTriggerOutputName, "OUT3" );
+   AddAllowedValue( g_OrientalTriggerOutputName, "OUT4" );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnTriggerSignal);
+   ret = CreateProperty(g_OrientalTriggerSignalName, g_OrientalTriggerInPositionOption, MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   AddAllowedValue( g_OrientalTriggerSignalName, g_OrientalTriggerInPositionOption );
+   AddAllowedValue( g_OrientalTriggerSignalName, g_OrientalTriggerAreaOption );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnTriggerWindow);
+   ret = CreateProperty(g_OrientalTriggerWindowName, CDeviceUtils::ConvertToString( triggerWindowUm_ ), MM::Float, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   SetPropertyLimits( g_OrientalTriggerWindowName, 0, 1000 );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnSequenceDwell);
+   ret = CreateProperty(g_OrientalSequenceDwellName, CDeviceUtils::ConvertToString( sequenceDwellMs_ ), MM::Float, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   SetPropertyLimits( g_OrientalSequenceDwellName, 0, 60000 );
+
+   pAct = new CPropertyAction(this, &OrientalMotorFocus::OnPositioningMode);
+   ret = CreateProperty(g_OrientalPositioningModeName, g_OrientalPositioningIncrementalOption, MM::String, false, pAct);
+   if (ret != DEVICE_OK)
+      return ret;
+   AddAllowedValue( g_OrientalPositioningModeName, g_OrientalPositioningIncrementalOption );
+   AddAllowedValue( g_OrientalPositioningModeName, g_OrientalPositioningAbsoluteOption );
 
    ret = UpdateStatus();
    if (ret != DEVICE_OK)
@@ -237,10 +425,19 @@ int OrientalMotorFocus::Initialize()
    //Test To Make Sure Connection Is Established
    //If Not, Throw an Error
    LogMessage("This thing is starting");
-   if( controller_->InitializePhysicalController( ) != 0 )
+   //Batched With the Other Axes on the Hub's Bus, Waited For Before First Use
+   if( hub_->QueueAxisInitialization( controller_ ) == DEVICE_OK )
+   {
+	   axisInitPending_ = true;
+   }
+   else if( controller_->InitializePhysicalController( ) != 0 )
    {
 	   LogMessage( "Initialization Failed" );
    }
+   else if( AnchorPositionReadback( pos_um_ ) != DEVICE_OK )
+   {
+	   LogMessage( "Position Readback Unavailable, Reporting Commanded Position" );
+   }
 
    LogMessage( "After Initialize" );
    
@@ -256,10 +453,29 @@ int OrientalMotorFocus::Shutdown()
    {
       initialized_ = false;
    }
+   axisInitPending_ = false;
+
+   //Sequence Moves Use the Controller
+   DestroySequenceExecutor();
+
+   //Leave no Continuous Operation Running
+   if( continuousDriven_ && controller_ != nullptr )
+   {
+      ControllerLogScope logScope( ( hub_ != nullptr ) ? hub_->GetLogSink() : nullptr );
+      controller_->StopMotion( false );
+      continuousDriven_ = false;
+   }
+
+   //Sampler Holds the Controller, So it Goes First
+   DestroyTelemetrySampler();
 
    //Needed in Shutdown so that Pointers in Controller to Hub Are not available
    if( controller_ != nullptr )
    {
+		if( hub_ != nullptr )
+		{
+			hub_->UnregisterAxis( controller_ );
+		}
 		delete controller_;
 		controller_ = nullptr;
    }
@@ -267,13 +483,200 @@ int OrientalMotorFocus::Shutdown()
    return DEVICE_OK;
 }
 
+void OrientalMotorFocus::DestroyTelemetrySampler( void )
+{
+   if( telemetry_ != nullptr )
+   {
+      if( telemetry_->IsRunning() )
+      {
+         telemetry_->Stop();
+         telemetry_->wait();
+      }
+      delete telemetry_;
+      telemetry_ = nullptr;
+   }
+}
+
+/* Report the Stage Position From Controller Readback
+*   Note:  Readback is cached by the controller, so repeated calls at rest do not reach the serial line
+*   Falls back to the last commanded position if there is no readback origin or the read fails
+*/
+int OrientalMotorFocus::GetPositionUm(double& pos)
+{
+   int32_t steps;
+
+   MMThreadGuard guard( motionLock_ );
+   EnsureAxisInitialized();
+   if( readbackAnchored_ == false || controller_ == nullptr )
+   {
+      pos = pos_um_;
+      return DEVICE_OK;
+   }
+
+   ControllerLogScope logScope( hub_->GetLogSink() );
+   if( controller_->ReadPos( steps ) != sizeof( steps ) )
+   {
+      LogMessage( "Position Readback Failed, Reporting Commanded Position" );
+      pos = pos_um_;
+      return DEVICE_OK;
+   }
+
+   pos = readbackOriginUm_ + ReadbackStepsToUm( steps - readbackOriginSteps_ );
+
+   return DEVICE_OK;
+}
+
 int OrientalMotorFocus::SetPositionUm(double pos) 
 {
+   //Also Called by sequenceExecutor_
+   MMThreadGuard guard( motionLock_ );
    //Work Around For Higher Resolution floating Values
    int ret = SetProperty(MM::g_Keyword_Position, CAlternativeUtils::ConvertToString(pos) );
+   if( ret != DEVICE_OK )
+   {
+      return ret;
+   }
    return OnStagePositionChanged(pos_um_);
 }
 
+/* Run the Focus Continuously at a Velocity
+*   Note:  Ramps at the motion planner's maximum acceleration and is limited to its maximum speed,
+*          a new velocity while running takes effect without stopping
+*   @param velocity - um/s (the sign of OnPosition() moves), 0 ramps down to a stop and returns once stopped, pos_um_ synced
+*/
+int OrientalMotorFocus::Move( double velocity )
+{
+   MMThreadGuard guard( motionLock_ );
+   EnsureAxisInitialized();
+   ControllerLogScope logScope( ( hub_ != nullptr ) ? hub_->GetLogSink() : nullptr );
+
+   const MotionPlannerConfig& config = motionPlanner_.GetConfig();
+   double stepsPerRev = 360 / controller_->GetCurrentBaseAnglePartition();
+   double maxVelocity = config.maxSpeedRevPerS * adjuster_->single_rot_travel_um_;
+   if( fabs( velocity ) > maxVelocity )
+   {
+      LogMessage( "Continuous Velocity Limited to the Motion Planner Max Speed" );
+      velocity = ( velocity > 0 ) ? maxVelocity : -maxVelocity;
+   }
+
+   //Position Writes Are Negated Steps, so Velocities Are Too
+   double stepsPerSec = velocity * stepsPerRev / adjuster_->single_rot_travel_um_ * -1;
+   if( controller_->SetContinuousVelocity( stepsPerSec, config.maxAccelRevPerS2 * stepsPerRev ) != 0 )
+   {
+      return DEVICE_SERIAL_COMMAND_FAILED;
+   }
+
+   if( velocity != 0 )
+   {
+      continuousDriven_ = true;
+   }
+   else if( continuousDriven_ )
+   {
+      continuousDriven_ = false;
+      SyncPositionWhenStopped();
+   }
+
+   return DEVICE_OK;
+}
+
+/* Stop Any Motion Immediately (stopActionReg Set to Immediate)
+*/
+int OrientalMotorFocus::Stop()
+{
+   MMThreadGuard guard( motionLock_ );
+   EnsureAxisInitialized();
+   ControllerLogScope logScope( ( hub_ != nullptr ) ? hub_->GetLogSink() : nullptr );
+
+   if( controller_->StopMotion( true ) != 0 )
+   {
+      return DEVICE_SERIAL_COMMAND_FAILED;
+   }
+
+   if( continuousDriven_ )
+   {
+      continuousDriven_ = false;
+      SyncPositionWhenStopped();
+   }
+
+   return DEVICE_OK;
+}
+
+/* After a Stop or Ramp-Down Was Commanded:  Wait Until the Motor Stops, Then SyncPositionFromReadback()
+*   Note:  IsMotorBusy() is a live read each time, as StageSequenceExecutor polls it
+*/
+void OrientalMotorFocus::SyncPositionWhenStopped( void )
+{
+   int ret;
+   double startMs = CAlternativeUtils::GetMonotonicTimeMs();
+
+   //IsMotorBusy() is 1 While Moving, 0 Once Stopped, Any Other Value an Error
+   while( ( ret = controller_->IsMotorBusy() ) == 1 && CAlternativeUtils::GetMonotonicTimeMs() - startMs < motionStopTimeoutMS_ )
+   {
+      CAlternativeUtils::SleepMs( motionStopPollMS_ );
+   }
+   if( ret != 0 )
+   {
+      LogMessage( "Motor Not Confirmed Stopped, Syncing the Position Anyway" );
+   }
+
+   SyncPositionFromReadback();
+}
+
+/* Take pos_um_ From Readback After Motion That Did Not End at an OnPosition() Target (Continuous Operation, a Stopped Sequence)
+*   Note:  In absolute positioning the command position is converted through the absolute origin instead, no readback is needed
+*   Note:  Without either pos_um_ is left as it was, so the next OnPosition() move is relative to a stale position
+*/
+void OrientalMotorFocus::SyncPositionFromReadback( void )
+{
+   double pos;
+
+   if( controller_->IsAbsolutePositioning() )
+   {
+      MotionTelemetrySample sample;
+      if( controller_->ReadMotionTelemetry( sample ) == 0 )
+      {
+         absoluteTargetSteps_ = sample.commandPos;
+         pos_um_ = absoluteOriginUm_ + CommandStepsToUm( sample.commandPos - absoluteOriginSteps_ );
+         OnStagePositionChanged( pos_um_ );
+         return;
+      }
+      LogMessage( "Command Position Read Failed, Trying Position Readback" );
+   }
+
+   if( readbackAnchored_ == false )
+   {
+      LogMessage( "No Position Readback, Commanded Position Not Updated After Untracked Motion" );
+      return;
+   }
+
+   GetPositionUm( pos );
+   pos_um_ = pos;
+   OnStagePositionChanged( pos_um_ );
+}
+
+/* Bring pos_um_ Up to Date After a Hub Synchronized Move Included This Axis
+*   Note:  Readback (or the absolute origin) is used when there is one, otherwise the settled steps are applied to pos_um_
+*   Note:  A settled axis given 0 steps did not move
+*/
+void OrientalMotorFocus::OnSynchronizedMoveFinished( long steps, bool settled )
+{
+   MMThreadGuard guard( motionLock_ );
+   if( settled && steps == 0 )
+   {
+      return;
+   }
+
+   if( settled && readbackAnchored_ == false && controller_->IsAbsolutePositioning() == false )
+   {
+      pos_um_ += CommandStepsToUm( steps );
+      OnStagePositionChanged( pos_um_ );
+      return;
+   }
+
+   //A Failed Axis May Still be Moving
+   SyncPositionWhenStopped();
+}
+
 int OrientalMotorFocus::IsStageSequenceable(bool& isSequenceable) const
 {
    isSequenceable = sequenceable_;
@@ -286,26 +689,64 @@ int OrientalMotorFocus::GetStageSequenceMaxLength(long& nrEvents) const
       return DEVICE_UNSUPPORTED_COMMAND;
    }
 
-   nrEvents = 2000;
+   nrEvents = maxSequenceLength_;
    return DEVICE_OK;
 }
 
+/* Run the Sent Sequence on a StageSequenceExecutor (a Run Still Going is Stopped First)
+*   Note:  The stage leads, the trigger output fires the camera at each position
+*/
 int OrientalMotorFocus::StartStageSequence()
 {
    if (!sequenceable_) {
       return DEVICE_UNSUPPORTED_COMMAND;
    }
 
+   EnsureAxisInitialized();
+   DestroySequenceExecutor();
+
+   if( triggerOutput_ == 0 )
+   {
+      LogMessage( "Stage Sequence Started Without a Trigger Output" );
+   }
+
+   sequenceExecutor_ = new StageSequenceExecutor( *this, controller_, sequence_, sequenceDwellMs_, ( hub_ != nullptr ) ? hub_->GetLogSink() : nullptr );
+   sequenceExecutor_->Start();
+
    return DEVICE_OK;
 }
 
+/* Stop the Sequence Run, Stopping the Motor Immediately if it Was Still Going
+*   Returns - DEVICE_OK, or DEVICE_SERIAL_COMMAND_FAILED if a move of the run failed
+*/
 int OrientalMotorFocus::StopStageSequence()
 {
    if (!sequenceable_) {
       return DEVICE_UNSUPPORTED_COMMAND;
    }
 
-   return DEVICE_OK;
+   if( sequenceExecutor_ == nullptr )
+   {
+      return DEVICE_OK;
+   }
+
+   bool running = ( sequenceExecutor_->IsDone() == false );
+   int errCode = sequenceExecutor_->GetErrCode();
+   DestroySequenceExecutor();
+
+   if( running )
+   {
+      MMThreadGuard guard( motionLock_ );
+      ControllerLogScope logScope( ( hub_ != nullptr ) ? hub_->GetLogSink() : nullptr );
+      if( controller_->StopMotion( true ) != 0 )
+      {
+         return DEVICE_SERIAL_COMMAND_FAILED;
+      }
+      //The Move Under Way May Not Have Reached its Target
+      SyncPositionWhenStopped();
+   }
+
+   return ( errCode == 0 ) ? DEVICE_OK : DEVICE_SERIAL_COMMAND_FAILED;
 }
 
 int OrientalMotorFocus::ClearStageSequence()
@@ -314,88 +755,271 @@ int OrientalMotorFocus::ClearStageSequence()
       return DEVICE_UNSUPPORTED_COMMAND;
    }
 
+   sequence_.clear();
    return DEVICE_OK;
 }
 
-int OrientalMotorFocus::AddToStageSequence(double /* position */)
+int OrientalMotorFocus::AddToStageSequence(double position)
 {
    if (!sequenceable_) {
       return DEVICE_UNSUPPORTED_COMMAND;
    }
 
+   if( static_cast< long >( sequence_.size() ) >= maxSequenceLength_ )
+   {
+      return DEVICE_SEQUENCE_TOO_LARGE;
+   }
+
+   sequence_.push_back( position );
    return DEVICE_OK;
 }
 
+/* Check the Sequence Against the Limits (Positions Are Only Sent to the Controller as the Run Reaches Them)
+*/
 int OrientalMotorFocus::SendStageSequence()
 {
    if (!sequenceable_) {
       return DEVICE_UNSUPPORTED_COMMAND;
    }
 
+   for( size_t i = 0; i < sequence_.size(); i++ )
+   {
+      if( sequence_[i] > upperLimit_ || lowerLimit_ > sequence_[i] )
+      {
+         LogMessage( "Stage Sequence Position Out of Limit" );
+         return DEVICE_UNKNOWN_POSITION;
+      }
+   }
+
+   return DEVICE_OK;
+}
+
+/* Center the Trigger Window on the Target of a Move About to be Written
+*   Note:  The window is in command position steps, so the present command position is read first (one monitor block read)
+*   Note:  Failures are only logged, the move goes ahead without a window for it
+*/
+void OrientalMotorFocus::ArmTriggerWindow( long moveSteps )
+{
+   MotionTelemetrySample sample;
+   if( controller_->ReadMotionTelemetry( sample ) != 0 )
+   {
+      LogMessage( "Command Position Read Failed, Trigger Window Not Moved" );
+      return;
+   }
+
+   double halfWidthSteps = triggerWindowUm_ * 360 / adjuster_->single_rot_travel_um_ / controller_->GetCurrentBaseAnglePartition();
+   long halfWidth = static_cast< long >( halfWidthSteps + 0.5 );
+   long target = sample.commandPos + moveSteps;
+   if( controller_->SetTriggerWindow( target - halfWidth, target + halfWidth ) != 0 )
+   {
+      LogMessage( "Trigger Window Write Failed" );
+   }
+}
+
+/* Tie the Controller's Present Command Position to pos_um_ For Absolute Positioning
+*   Note:  Reads the command position once (one monitor block read), the same read ArmTriggerWindow() makes
+*   Returns - DEVICE_OK or DEVICE_SERIAL_COMMAND_FAILED if the command position could not be read
+*/
+int OrientalMotorFocus::AnchorAbsolutePositioning( void )
+{
+   MotionTelemetrySample sample;
+   if( controller_->ReadMotionTelemetry( sample ) != 0 )
+   {
+      return DEVICE_SERIAL_COMMAND_FAILED;
+   }
+
+   absoluteOriginSteps_ = sample.commandPos;
+   absoluteTargetSteps_ = sample.commandPos;
+   absoluteOriginUm_ = pos_um_;
    return DEVICE_OK;
 }
 
+int OrientalMotorFocus::AbsoluteTargetSteps( double posUm, long& target )
+{
+   //OnPosition() Writes Negated Steps For a Positive um Move
+   double steps = ( posUm - absoluteOriginUm_ ) * 360 / adjuster_->single_rot_travel_um_ / controller_->GetCurrentBaseAnglePartition();
+   double targetSteps = absoluteOriginSteps_ - floor( steps + 0.5 );
 
-//When This is Set, it assumes the Adjuster is at the pos_um that is currently there...
-int OrientalMotorFocus::SetAdjuster( std::string key )
+   if( controller_->IsPosInRange( targetSteps ) == false )
+   {
+      return DEVICE_UNKNOWN_POSITION;
+   }
+
+   target = static_cast< long >( targetSteps );
+   return DEVICE_OK;
+}
+
+void OrientalMotorFocus::DestroySequenceExecutor( void )
 {
-	const AdjusterKnob * adjuster;
+   if( sequenceExecutor_ != nullptr )
+   {
+      sequenceExecutor_->Stop();
+      sequenceExecutor_->wait();
+      delete sequenceExecutor_;
+      sequenceExecutor_ = nullptr;
+   }
+}
 
-	adjuster = KnobOptionsResolver::GetKnobOption( key );
 
-	LogMessage("Adjuster KNobSetting");
+int OrientalMotorFocus::AnchorPositionReadback( double posUm )
+{
+	int32_t steps;
 
-	if( adjuster == nullptr )
+	readbackAnchored_ = false;
+
+	//The Anchor Must Be the Controller's Current Count, Not a Cached One
+	controller_->InvalidatePosReadback();
+	if( controller_->ReadPos( steps ) != sizeof( steps ) )
 	{
-		return DEVICE_INVALID_PROPERTY_VALUE;
+		return DEVICE_SERIAL_COMMAND_FAILED;
 	}
 
-	adjuster_ = adjuster;
-	upperLimit_ = adjuster->abs_total_travel_um_ - adjuster->single_rot_travel_um_;
-	lowerLimit_ = 0;
+	readbackOriginSteps_ = steps;
+	readbackOriginUm_ = posUm;
+	readbackAnchored_ = true;
 
 	return DEVICE_OK;
 }
 
-int OrientalMotorFocus::SetController( std::string key )
+/* Wait Once For the Hub's Batched Physical Initialization of controller_ and Anchor the Readback After it
+*   Note:  Later calls return at once, whatever the result was
+*/
+void OrientalMotorFocus::EnsureAxisInitialized( void )
 {
+	MMThreadGuard guard( axisInitLock_ );
 
-	AbstractControllerInterface * controller;
-
-	//Set Hub for OrientalMotorFocus if it is not already set
-	//If this is called from the constructor, hub_ will remain a nullptr, otherwise it will be initialized
-	if( hub_ == nullptr )  
+	if( axisInitPending_ == false )
 	{
-		hub_ = static_cast<OrientalFTDIHub*>(GetParentHub());
+		return;
 	}
+	axisInitPending_ = false;
 
-	controller = AbstractControllerInterfaceFactory::GetNewControllerOption( key, hub_, &OrientalFTDIHub::FTDISerialCommunicate );
-
-	if( controller == nullptr )
+	ControllerLogScope logScope( hub_->GetLogSink() );
+	if( hub_->WaitForAxisInitialization( controller_, PeripheralInitializer::defaultWaitMS_ ) != 0 )
 	{
-		return DEVICE_INVALID_PROPERTY_VALUE;
+		LogMessage( "Initialization Failed" );
 	}
-	//delete previous controller_ instance
-	//if the instance is of a different type
-	if( controller_ != nullptr )
+	else if( AnchorPositionReadback( pos_um_ ) != DEVICE_OK )
 	{
-		if( controller_->getName() != key )
-		{
-			delete controller_;
-		}
-		else
-		{
-			//We just requeried for the same controller
-			//Delete heap object
-			delete controller;
-			return DEVICE_OK;
-		}
+		LogMessage( "Position Readback Unavailable, Reporting Commanded Position" );
 	}
-
-	//Conclude controller is a different contribution
-	controller_ = controller;
-
-	return DEVICE_OK;
+}
+
+/* Convert a Difference in Readback Counts to a Difference in um
+*   Note:  Encoder counts have their own resolution (encoderCountsPerRev_), the step partition only scales command steps
+*/
+double OrientalMotorFocus::ReadbackStepsToUm( long steps )
+{
+	if( controller_->GetEncoderReadback() )
+	{
+		//The Encoder Counts in the Direction of the Command Position
+		return -1 * steps * adjuster_->single_rot_travel_um_ / encoderCountsPerRev_;
+	}
+
+	return CommandStepsToUm( steps );
+}
+
+double OrientalMotorFocus::CommandStepsToUm( long steps )
+{
+	//OnPosition() Writes Negated Steps For a Positive um Move
+	return -1 * steps * controller_->GetCurrentBaseAnglePartition() * adjuster_->single_rot_travel_um_ / 360;
+}
+
+int OrientalMotorFocus::SetBaseAnglePartitionKeepOrigin( double baseAnglePartition )
+{
+	int ret;
+	MMThreadGuard guard( motionLock_ );
+	double pos = pos_um_;
+
+	if( readbackAnchored_ )
+	{
+		GetPositionUm( pos );
+	}
+
+	if( ( ret = controller_->SetBaseAnglePartition( baseAnglePartition ) ) != 0 )
+	{
+		return ret;
+	}
+
+	//Counts Before the Change Are in the Old Partition, So Start Counting From Here
+	if( readbackAnchored_ && AnchorPositionReadback( pos ) != DEVICE_OK )
+	{
+		LogMessage( "Position Readback Unavailable After Partition Change" );
+	}
+
+	//The Absolute Origin is in Steps of the Old Partition Too
+	if( controller_->IsAbsolutePositioning() && AnchorAbsolutePositioning() != DEVICE_OK )
+	{
+		LogMessage( "Command Position Read Failed, Absolute Origin Not Moved After Partition Change" );
+	}
+
+	return 0;
+}
+
+//When This is Set, it assumes the Adjuster is at the pos_um that is currently there...
+int OrientalMotorFocus::SetAdjuster( std::string key )
+{
+	const AdjusterKnob * adjuster;
+
+	adjuster = KnobOptionsResolver::GetKnobOption( key );
+
+	LogMessage("Adjuster KNobSetting");
+
+	if( adjuster == nullptr )
+	{
+		return DEVICE_INVALID_PROPERTY_VALUE;
+	}
+
+	adjuster_ = adjuster;
+	upperLimit_ = adjuster->abs_total_travel_um_ - adjuster->single_rot_travel_um_;
+	lowerLimit_ = 0;
+
+	return DEVICE_OK;
+}
+
+int OrientalMotorFocus::SetController( std::string key )
+{
+
+	AbstractControllerInterface * controller;
+
+	//Set Hub for OrientalMotorFocus if it is not already set
+	//If this is called from the constructor, hub_ will remain a nullptr, otherwise it will be initialized
+	if( hub_ == nullptr )  
+	{
+		hub_ = static_cast<OrientalFTDIHub*>(GetParentHub());
+	}
+
+	controller = AbstractControllerInterfaceFactory::GetNewControllerOption( key, hub_, &ControllerBus::SerialCommunicate );
+
+	if( controller == nullptr )
+	{
+		return DEVICE_INVALID_PROPERTY_VALUE;
+	}
+	//delete previous controller_ instance
+	//if the instance is of a different type
+	if( controller_ != nullptr )
+	{
+		if( controller_->getName() != key )
+		{
+			if( hub_ != nullptr )
+			{
+				hub_->UnregisterAxis( controller_ );
+			}
+			delete controller_;
+		}
+		else
+		{
+			//We just requeried for the same controller
+			//Delete heap object
+			delete controller;
+			return DEVICE_OK;
+		}
+	}
+
+	//Conclude controller is a different contribution
+	controller_ = controller;
+
+	return DEVICE_OK;
 }
 
 
@@ -406,7 +1030,6 @@ int OrientalMotorFocus::SetController( std::string key )
 
 int OrientalMotorFocus::OnBaseAnglePartitionSelect( MM::PropertyBase* pProp, MM::ActionType eAct )
 {
-	std::ostringstream os;
 	int ret;
 
 	LogMessage( "In Base Angle Partition Callback" );
@@ -444,7 +1067,7 @@ int OrientalMotorFocus::OnBaseAnglePartitionSelect( MM::PropertyBase* pProp, MM:
 			//Operate On Current Parition List
 			partitionOptions = controller_->GetBaseAnglePartitionOptions( controller_->GetCurrentBaseAngle() );
 			//Set Error Codes Here For a Serial Process
-			controller_->SetBaseAnglePartition( partitionOptions[0] );
+			SetBaseAnglePartitionKeepOrigin( partitionOptions[0] );
 			pProp->Set( partitionOptions[0] );
 			baseAngleChangeSignal_ = false;
 		}
@@ -465,7 +1088,7 @@ int OrientalMotorFocus::OnBaseAnglePartitionSelect( MM::PropertyBase* pProp, MM:
 		
 			//Workaround For Poor Config Update Callbacks, Make a Slider with Maximum anticipated Values
 			SetPropertyLimits( g_OrientalBaseAnglePartitionOptionsName, min, max );
-			controller_->SetBaseAnglePartition( partitionOptions[0] );
+			SetBaseAnglePartitionKeepOrigin( partitionOptions[0] );
 			pProp->Set( partitionOptions[0] );
 			baseAngleChangeSignal_ = false;
 		}
@@ -493,7 +1116,7 @@ int OrientalMotorFocus::OnBaseAnglePartitionSelect( MM::PropertyBase* pProp, MM:
 		double mindiff;
 		unsigned int minDiffIndex;
 		bool firstOption = true;
-		std::vector<double> options = controller_->GetBaseAnglePartitionOptions( controller_->GetCurrentBaseAngle() );
+		const std::vector<double>& options = controller_->GetBaseAnglePartitionOptions( controller_->GetCurrentBaseAngle() );
 
 		for( int i = 0; i < options.size(); i++ )
 		{
@@ -532,10 +1155,7 @@ int OrientalMotorFocus::OnBaseAnglePartitionSelect( MM::PropertyBase* pProp, MM:
 		//Effectively Makes a Plus Minus Increment
 		pProp->Set( answer );
 
-		/*os << "pulled the answer as " << answer << "\n";
-		LogMessage( os.str() );*/
-
-		if( ( ret = controller_->SetBaseAnglePartition( answer ) ) != 0 )
+		if( ( ret = SetBaseAnglePartitionKeepOrigin( answer ) ) != 0 )
 		{
 			LogMessage("Failed To Set Base Angle Partition" );
 			pProp->Set( controller_->GetCurrentBaseAnglePartition() );
@@ -686,17 +1306,30 @@ int OrientalMotorFocus::OnPosition(MM::PropertyBase* pProp, MM::ActionType eAct)
 {
    int errCode;
    LogMessage("In OnPosition");
+   MMThreadGuard guard( motionLock_ );
 
    if (eAct == MM::BeforeGet)
    {
-      std::stringstream s;
-      s << pos_um_;
-      pProp->Set(s.str().c_str());
+      pProp->Set(pos_um_);
    }
    else if (eAct == MM::AfterSet)
    {
+      TraceSpan span( "OnPosition", g_TraceCategoryMotion );
+      EnsureAxisInitialized();
+      ControllerLogScope logScope( hub_->GetLogSink() );
       double pos;
       pProp->Get(pos);
+      //Moves Are Relative to pos_um_, so Continuous Operation Ends Here First
+      if( continuousDriven_ )
+      {
+         if( controller_->StopMotion( true ) != 0 )
+         {
+            pProp->Set( pos_um_ );
+            return DEVICE_SERIAL_COMMAND_FAILED;
+         }
+         continuousDriven_ = false;
+         SyncPositionWhenStopped();
+      }
       if (pos > upperLimit_ || lowerLimit_ > pos)
       {
 		  LogMessage("Out of Limit");
@@ -705,16 +1338,48 @@ int OrientalMotorFocus::OnPosition(MM::PropertyBase* pProp, MM::ActionType eAct)
       }
 	  
 	  double degrees = (pos - pos_um_) * 360 / adjuster_->single_rot_travel_um_;
+	  //Absolute Targets Are Rounded From the Fixed Origin, steps is Then Only the Distance Planned and Windowed
+	  bool absolute = controller_->IsAbsolutePositioning();
+	  long target = 0;
+	  //The Written Value Must Fit the Position Register, Like pos Fits the um Limits
+	  if( ( absolute && AbsoluteTargetSteps( pos, target ) != DEVICE_OK ) ||
+		  ( absolute == false && controller_->IsPosInRange( degrees / controller_->GetCurrentBaseAnglePartition() ) == false ) )
+	  {
+		  LogMessage("Position Register Out of Range");
+		  pProp->Set(pos_um_); // revert
+		  return DEVICE_UNKNOWN_POSITION;
+	  }
 	  int steps = degrees / controller_->GetCurrentBaseAnglePartition();
-	  std::ostringstream os;
-	  //os << "Gonna Write: Degrees is " << degrees << "\nSteps is " << steps;
-	  errCode = controller_->WritePos( steps * -1 );
-	  //os << "\n The ErrCode is :" << errCode;
-	  //LogMessage(os.str());
+	  if( absolute )
+	  {
+		  steps = static_cast< int >( absoluteTargetSteps_ - target );
+	  }
+	  //Speed and Rates Go Out in the Same Request as the Position
+	  MotionPlan plan;
+	  bool planned = motionPlannerEnabled_ && motionPlanner_.Plan( steps, controller_->GetCurrentBaseAnglePartition(), adjuster_->single_rot_travel_um_, plan ) == 0;
+	  if( planned )
+	  {
+		  controller_->SetNextMovePlan( &plan );
+	  }
+	  //Area Triggers Fire on Entering the Window Around This Move's Target
+	  if( triggerOutput_ != 0 && triggerSignal_ == TriggerOutputArea )
+	  {
+		  ArmTriggerWindow( steps * -1 );
+	  }
+	  errCode = controller_->WritePos( ( absolute ) ? static_cast< int >( target ) : steps * -1 );
+	  if( planned )
+	  {
+		  //Not Left For a Later Write if This One Was Refused
+		  controller_->SetNextMovePlan( nullptr );
+	  }
 	  if( errCode == 0 )
 	  {
 		  //Match pos_um_ to SetPropertyValue With No Revert
 		 pos_um_ = pos;
+		 if( absolute )
+		 {
+			 absoluteTargetSteps_ = target;
+		 }
 	  }
 	  else
 	  {
@@ -723,6 +1388,11 @@ int OrientalMotorFocus::OnPosition(MM::PropertyBase* pProp, MM::ActionType eAct)
 		  {
 			  return DEVICE_SERIAL_COMMAND_FAILED;
 		  }
+
+		  //Position Writes Go Out as a Multi-Register Write (0x10)
+		  unsigned char address = 0;
+		  controller_->GetAddress( address );
+		  hub_->GetBusStatistics().RecordBusyReject( address, 0x10 );
 	  }
 
    }
@@ -770,8 +1440,10 @@ int OrientalMotorFocus::OnRestingEnergyStateSelect(MM::PropertyBase* pProp, MM::
 		else if( answer == "Disable" ) {
 			energyOn = false;
 		}
+		EnsureAxisInitialized();
 		//Catch And Propagate any Errors as MMErrCodes
 		try {
+			ControllerLogScope logScope( ( hub_ != nullptr ) ? hub_->GetLogSink() : nullptr );
 			controller_->SetRestingHardwareEnergized( energyOn, true );  //Use HardWare Processes
 		}  
 		catch ( MMErrorCodeException& ex ) {
@@ -783,4 +1455,671 @@ int OrientalMotorFocus::OnRestingEnergyStateSelect(MM::PropertyBase* pProp, MM::
 	return DEVICE_OK;
 
 
-}
\ No newline at end of file
+}
+
+int OrientalMotorFocus::OnReadbackSourceSelect(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( ( controller_->GetEncoderReadback() ) ? g_OrientalReadbackEncoderOption : g_OrientalReadbackCommandOption );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		std::string answer;
+		pProp->Get(answer);
+		bool useEncoder = ( answer == g_OrientalReadbackEncoderOption );
+
+		if( useEncoder == controller_->GetEncoderReadback() )
+		{
+			return DEVICE_OK;
+		}
+
+		//Encoder and Command Counts Have Independent Origins, Re-Anchor at the Current Position
+		double pos;
+		GetPositionUm( pos );
+		controller_->SetEncoderReadback( useEncoder );
+		if( readbackAnchored_ && AnchorPositionReadback( pos ) != DEVICE_OK )
+		{
+			return DEVICE_SERIAL_COMMAND_FAILED;
+		}
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnReadbackMaxAge(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( controller_->GetReadbackMaxAgeMS() );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		double answer;
+		pProp->Get(answer);
+		controller_->SetReadbackMaxAgeMS( answer );
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnTelemetryState(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( ( telemetry_->IsRunning() ) ? "Enable" : "Disable" );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		std::string answer;
+		pProp->Get(answer);
+
+		if( answer == "Enable" && telemetry_->IsRunning() == false )
+		{
+			telemetry_->Start();
+		}
+		else if( answer == "Disable" && telemetry_->IsRunning() )
+		{
+			telemetry_->Stop();
+			telemetry_->wait();
+		}
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnTelemetryInterval(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( telemetry_->GetIntervalMS() );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		long answer;
+		pProp->Get(answer);
+		telemetry_->SetIntervalMS( answer );
+	}
+
+	return DEVICE_OK;
+
+}
+
+//Empty Path Closes the File Sink and Returns the Ring to PopSamples() Consumers
+int OrientalMotorFocus::OnTelemetryFile(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( telemetry_->GetFileSinkPath().c_str() );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		std::string answer;
+		pProp->Get(answer);
+
+		if( answer.empty() )
+		{
+			telemetry_->CloseFileSink();
+		}
+		else if( telemetry_->OpenFileSink( answer ) != 0 )
+		{
+			pProp->Set( "" );
+			return DEVICE_INVALID_PROPERTY_VALUE;
+		}
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnTelemetrySampleCount(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( static_cast<long>( telemetry_->GetSampleCount() ) );
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnTelemetryDroppedCount(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( static_cast<long>( telemetry_->GetDroppedCount() ) );
+	}
+
+	return DEVICE_OK;
+
+}
+
+/* Run the Move Latency Benchmark From the Current Position
+*   Note:  Blocks until every move has settled; the stage ends where it started
+*/
+int OrientalMotorFocus::OnMoveLatencyBenchmark(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+	int ret = DEVICE_OK;
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( g_OrientalMoveLatencyIdleOption );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		std::string answer;
+		pProp->Get(answer);
+
+		if( answer == g_OrientalMoveLatencyRunOption )
+		{
+			MoveLatencyBenchmark benchmark( *this, controller_ );
+			if( benchmark.Run() != 0 )
+			{
+				LogMessage( "Move Latency Benchmark: Some Moves Did Not Settle" );
+			}
+			LogMessage( "Move Latency Benchmark:\n" + benchmark.Summary() );
+
+			MoveLatencyBusInfo busInfo;
+			busInfo.simulated = hub_->GetBusSimulation( busInfo.baudRate, busInfo.usbLatencyMs, busInfo.motorSpeedStepsPerSec );
+			if( moveLatencyReportFile_.empty() == false && benchmark.WriteJson( moveLatencyReportFile_, busInfo ) != 0 )
+			{
+				LogMessage( "Could Not Write Move Latency Report to " + moveLatencyReportFile_ );
+				ret = DEVICE_ERR;
+			}
+		}
+		pProp->Set( g_OrientalMoveLatencyIdleOption );
+	}
+
+	return ret;
+
+}
+
+int OrientalMotorFocus::OnMoveLatencyReportFile(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( moveLatencyReportFile_.c_str() );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		pProp->Get( moveLatencyReportFile_ );
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnEncoderCountsPerRev(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( encoderCountsPerRev_ );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		double answer;
+		pProp->Get(answer);
+		if( answer < 1 )
+		{
+			pProp->Set( encoderCountsPerRev_ );
+			return DEVICE_INVALID_PROPERTY_VALUE;
+		}
+		//The Origin is Kept, Only the Scale of Counts Away From it Changes
+		encoderCountsPerRev_ = answer;
+	}
+
+	return DEVICE_OK;
+
+}
+
+/* Load and Validate Every Profile of a File, Then Offer Them in the Profile Property
+*   Note:  A file with any bad profile is rejected whole, before anything is written to the controller
+*/
+int OrientalMotorFocus::OnProfileFile(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( profileFile_.c_str() );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		std::string answer;
+		pProp->Get(answer);
+
+		std::vector< ControllerProfile > profiles;
+		std::string error;
+		if( answer.empty() == false )
+		{
+			int ret = ControllerProfileFile::Load( answer, profiles, error );
+			for( size_t i = 0; ret == 0 && i < profiles.size(); i++ )
+			{
+				ret = controller_->ValidateProfile( profiles[i], error );
+			}
+			if( ret != 0 )
+			{
+				LogMessage( "Controller Profile File " + answer + " Rejected: " + error );
+				pProp->Set( profileFile_.c_str() );
+				return DEVICE_INVALID_PROPERTY_VALUE;
+			}
+		}
+
+		profileFile_ = answer;
+		profiles_ = profiles;
+		activeProfile_ = g_OrientalProfileNoneOption;
+
+		ClearAllowedValues( g_OrientalProfileName );
+		AddAllowedValue( g_OrientalProfileName, g_OrientalProfileNoneOption );
+		for( size_t i = 0; i < profiles_.size(); i++ )
+		{
+			AddAllowedValue( g_OrientalProfileName, profiles_[i].name.c_str() );
+		}
+		OnPropertiesChanged();
+	}
+
+	return DEVICE_OK;
+
+}
+
+/* Apply the Selected Profile to the Controller ("None" Writes Nothing and Leaves the Registers as They Are)
+*/
+int OrientalMotorFocus::OnProfileSelect(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( activeProfile_.c_str() );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		std::string answer;
+		pProp->Get(answer);
+
+		if( answer == g_OrientalProfileNoneOption )
+		{
+			activeProfile_ = answer;
+			return DEVICE_OK;
+		}
+
+		size_t i = 0;
+		for( ; i < profiles_.size() && profiles_[i].name != answer; i++ );
+		if( i == profiles_.size() )
+		{
+			pProp->Set( activeProfile_.c_str() );
+			return DEVICE_INVALID_PROPERTY_VALUE;
+		}
+
+		EnsureAxisInitialized();
+		int errCode;
+		{
+			ControllerLogScope logScope( ( hub_ != nullptr ) ? hub_->GetLogSink() : nullptr );
+			errCode = controller_->ApplyProfile( profiles_[i] );
+		}
+		if( errCode != 0 )
+		{
+			LogMessage( "Controller Profile " + answer + " Failed With " + CDeviceUtils::ConvertToString( errCode ) );
+			pProp->Set( activeProfile_.c_str() );
+			return DEVICE_SERIAL_COMMAND_FAILED;
+		}
+
+		activeProfile_ = answer;
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnMotionPlannerState(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( ( motionPlannerEnabled_ ) ? "Enable" : "Disable" );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		std::string answer;
+		pProp->Get(answer);
+		bool enable = ( answer == "Enable" );
+
+		if( enable == motionPlannerEnabled_ )
+		{
+			return DEVICE_OK;
+		}
+
+		EnsureAxisInitialized();
+		int errCode;
+		{
+			ControllerLogScope logScope( ( hub_ != nullptr ) ? hub_->GetLogSink() : nullptr );
+			errCode = controller_->EnableMotionPlans( enable );
+		}
+		if( errCode != 0 )
+		{
+			pProp->Set( ( motionPlannerEnabled_ ) ? "Enable" : "Disable" );
+			return DEVICE_SERIAL_COMMAND_FAILED;
+		}
+
+		motionPlannerEnabled_ = enable;
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnMotionPlannerMaxSpeed(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( motionPlanner_.GetConfig().maxSpeedRevPerS );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		pProp->Get( motionPlanner_.GetConfig().maxSpeedRevPerS );
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnMotionPlannerMaxAccel(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( motionPlanner_.GetConfig().maxAccelRevPerS2 );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		pProp->Get( motionPlanner_.GetConfig().maxAccelRevPerS2 );
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnMotionPlannerSettleTolerance(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( motionPlanner_.GetConfig().settleToleranceUm );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		pProp->Get( motionPlanner_.GetConfig().settleToleranceUm );
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnMotionPlannerSettleTimeConstant(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( motionPlanner_.GetConfig().settleTimeConstantMs );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		pProp->Get( motionPlanner_.GetConfig().settleTimeConstantMs );
+	}
+
+	return DEVICE_OK;
+
+}
+
+/* Run the Motion Profile Tuner Sweep, Then Write its Report and Best Safe Profile
+*   Note:  The motion planner is held off for the sweep, so each grid point's speed and rates are the ones moved with
+*/
+int OrientalMotorFocus::OnMotionTuner(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	int ret = DEVICE_OK;
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( g_OrientalMotionTunerIdleOption );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		std::string answer;
+		pProp->Get(answer);
+
+		if( answer == g_OrientalMotionTunerRunOption )
+		{
+			EnsureAxisInitialized();
+			ControllerLogScope logScope( ( hub_ != nullptr ) ? hub_->GetLogSink() : nullptr );
+			bool plannerEnabled = motionPlannerEnabled_;
+			motionPlannerEnabled_ = false;
+
+			MotionProfileTuner tuner( *this, controller_ );
+			int errCode = tuner.Run();
+			motionPlannerEnabled_ = plannerEnabled;
+			if( errCode != 0 )
+			{
+				LogMessage( "Motion Profile Tuner: Stopped or Not Restored With " + std::string( CDeviceUtils::ConvertToString( errCode ) ) );
+				ret = DEVICE_ERR;
+			}
+			LogMessage( "Motion Profile Tuner:\n" + tuner.Summary() );
+
+			if( motionTunerReportFile_.empty() == false && tuner.WriteJson( motionTunerReportFile_, hub_ ) != 0 )
+			{
+				LogMessage( "Could Not Write Motion Profile Tuner Report to " + motionTunerReportFile_ );
+				ret = DEVICE_ERR;
+			}
+			if( motionTunerProfileFile_.empty() == false && tuner.WriteProfile( motionTunerProfileFile_ ) != 0 )
+			{
+				LogMessage( "No Safe Grid Point (Trials Are Unverified Without Encoder Readback or Step-Out Detection), or Could Not Write the Profile to " + motionTunerProfileFile_ );
+				ret = DEVICE_ERR;
+			}
+		}
+		pProp->Set( g_OrientalMotionTunerIdleOption );
+	}
+
+	return ret;
+
+}
+
+int OrientalMotorFocus::OnMotionTunerReportFile(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( motionTunerReportFile_.c_str() );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		pProp->Get( motionTunerReportFile_ );
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnMotionTunerProfileFile(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( motionTunerProfileFile_.c_str() );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		pProp->Get( motionTunerProfileFile_ );
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnTriggerOutput(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( ( triggerOutput_ == 0 ) ? g_OrientalTriggerOutputNoneOption : ( std::string( "OUT" ) + CDeviceUtils::ConvertToString( (long) triggerOutput_ ) ).c_str() );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		std::string answer;
+		pProp->Get(answer);
+		unsigned int output = ( answer == g_OrientalTriggerOutputNoneOption ) ? 0 : static_cast< unsigned int >( atoi( answer.c_str() + 3 ) );
+
+		if( output == triggerOutput_ )
+		{
+			return DEVICE_OK;
+		}
+
+		EnsureAxisInitialized();
+		int errCode = 0;
+		{
+			ControllerLogScope logScope( ( hub_ != nullptr ) ? hub_->GetLogSink() : nullptr );
+			//The Output Given up Goes Back to its Power-On Signal
+			if( triggerOutput_ != 0 )
+			{
+				errCode = controller_->SetTriggerOutput( triggerOutput_, TriggerOutputDefault );
+			}
+			if( errCode == 0 && output != 0 )
+			{
+				errCode = controller_->SetTriggerOutput( output, triggerSignal_ );
+			}
+		}
+		if( errCode != 0 )
+		{
+			pProp->Set( ( triggerOutput_ == 0 ) ? g_OrientalTriggerOutputNoneOption : ( std::string( "OUT" ) + CDeviceUtils::ConvertToString( (long) triggerOutput_ ) ).c_str() );
+			return DEVICE_SERIAL_COMMAND_FAILED;
+		}
+
+		triggerOutput_ = output;
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnTriggerSignal(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( ( triggerSignal_ == TriggerOutputArea ) ? g_OrientalTriggerAreaOption : g_OrientalTriggerInPositionOption );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		std::string answer;
+		pProp->Get(answer);
+		TriggerOutputSignal signal = ( answer == g_OrientalTriggerAreaOption ) ? TriggerOutputArea : TriggerOutputInPosition;
+
+		if( signal == triggerSignal_ )
+		{
+			return DEVICE_OK;
+		}
+
+		if( triggerOutput_ != 0 )
+		{
+			EnsureAxisInitialized();
+			int errCode;
+			{
+				ControllerLogScope logScope( ( hub_ != nullptr ) ? hub_->GetLogSink() : nullptr );
+				errCode = controller_->SetTriggerOutput( triggerOutput_, signal );
+			}
+			if( errCode != 0 )
+			{
+				pProp->Set( ( triggerSignal_ == TriggerOutputArea ) ? g_OrientalTriggerAreaOption : g_OrientalTriggerInPositionOption );
+				return DEVICE_SERIAL_COMMAND_FAILED;
+			}
+		}
+
+		triggerSignal_ = signal;
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnTriggerWindow(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( triggerWindowUm_ );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		pProp->Get( triggerWindowUm_ );
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnSequenceDwell(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( sequenceDwellMs_ );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		pProp->Get( sequenceDwellMs_ );
+	}
+
+	return DEVICE_OK;
+
+}
+
+int OrientalMotorFocus::OnPositioningMode(MM::PropertyBase* pProp, MM::ActionType eAct)
+{
+
+	if( eAct == MM::BeforeGet )
+	{
+		pProp->Set( ( controller_->IsAbsolutePositioning() ) ? g_OrientalPositioningAbsoluteOption : g_OrientalPositioningIncrementalOption );
+	}
+	else if ( eAct == MM::AfterSet )
+	{
+		std::string answer;
+		pProp->Get(answer);
+		bool absolute = ( answer == g_OrientalPositioningAbsoluteOption );
+
+		if( absolute == controller_->IsAbsolutePositioning() )
+		{
+			return DEVICE_OK;
+		}
+
+		MMThreadGuard guard( motionLock_ );
+		EnsureAxisInitialized();
+		int errCode;
+		{
+			ControllerLogScope logScope( ( hub_ != nullptr ) ? hub_->GetLogSink() : nullptr );
+			//The Origin is Taken Before the Mode Changes, so the First Absolute Target Can Not Use a Stale One
+			errCode = ( absolute ) ? AnchorAbsolutePositioning() : DEVICE_OK;
+			if( errCode == DEVICE_OK )
+			{
+				errCode = controller_->SetAbsolutePositioning( absolute );
+			}
+		}
+		if( errCode != 0 )
+		{
+			pProp->Set( ( absolute ) ? g_OrientalPositioningIncrementalOption : g_OrientalPositioningAbsoluteOption );
+			return DEVICE_SERIAL_COMMAND_FAILED;
+		}
+	}
+
+	return DEVICE_OK;
+
+}
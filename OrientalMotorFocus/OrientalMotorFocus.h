@@ -7,6 +7,9 @@
 #include "OrientalFocusKnobs.h"
 #include "OrientalControllerTemplate.h"
 #include "OrientalMotorHub.h"
+#include "MotionTelemetrySampler.h"
+#include "StageSequenceExecutor.h"
+#include "MoveLatencyBenchmark.h"
 /*
 class ErrorLogger : public CGenericBase< ErrorLogger >
 {
@@ -28,7 +31,10 @@ class ErrorLogger : public CGenericBase< ErrorLogger >
 
 }*/
 
-class OrientalMotorFocus : public CStageBase<OrientalMotorFocus>
+//Forward Declarations
+class StageSequenceExecutor;
+
+class OrientalMotorFocus : public CStageBase<OrientalMotorFocus>, public SequencedStage, public BenchmarkedStage
 {
 public:
 	OrientalMotorFocus( std::string name );
@@ -42,7 +48,7 @@ public:
      
    // Stage API
    int SetPositionUm(double pos);
-   int GetPositionUm(double& pos) {pos = pos_um_; LogMessage("Reporting position", true); return DEVICE_OK;}
+   int GetPositionUm(double& pos);
    double GetStepSize() {return stepSize_um_;}
    int SetPositionSteps(long steps) 
    {
@@ -61,10 +67,11 @@ public:
       upper = upperLimit_;
       return DEVICE_OK;
    }
-   int Move(double /*v*/) {return DEVICE_OK;}
+   int Move(double velocity);
+   int Stop();
 
    int IsStageSequenceable(bool& isSequenceable) const;
-   bool IsContinuousFocusDrive() const {return false;}
+   bool IsContinuousFocusDrive() const {return true;}
    int GetStageSequenceMaxLength(long& nrEvents) const;
    int StartStageSequence();
    int StopStageSequence();
@@ -77,6 +84,31 @@ public:
    int OnBaseAngleSelect( MM::PropertyBase* pProp, MM::ActionType eAct );
    int OnBaseAnglePartitionSelect( MM::PropertyBase* pProp, MM::ActionType eAct );
    int OnRestingEnergyStateSelect(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnReadbackSourceSelect(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnEncoderCountsPerRev(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnReadbackMaxAge(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnTelemetryState(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnTelemetryInterval(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnTelemetryFile(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnTelemetrySampleCount(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnTelemetryDroppedCount(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnMoveLatencyBenchmark(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnMoveLatencyReportFile(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnProfileFile(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnProfileSelect(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnMotionPlannerState(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnMotionPlannerMaxSpeed(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnMotionPlannerMaxAccel(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnMotionPlannerSettleTolerance(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnMotionPlannerSettleTimeConstant(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnMotionTuner(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnMotionTunerReportFile(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnMotionTunerProfileFile(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnTriggerOutput(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnTriggerSignal(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnTriggerWindow(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnSequenceDwell(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnPositioningMode(MM::PropertyBase* pProp, MM::ActionType eAct);
 
    int OnPosition(MM::PropertyBase* pProp, MM::ActionType eAct);
    int OnAdjusterSelect(MM::PropertyBase* pProp, MM::ActionType eAct);
@@ -87,12 +119,72 @@ public:
 
    // Sequence functions
 
+   //Telemetry Consumer Access (nullptr Before Initialize), See MotionTelemetrySampler::PopSamples()
+   MotionTelemetrySampler* GetTelemetrySampler( void ) { return telemetry_; }
+
+   /* Bring pos_um_ Up to Date After a Hub Synchronized Move Included This Axis (See OrientalFTDIHub::RegisterAxis())
+   *   @param steps - relative steps the move gave the axis (as written to the controller)
+   *   @param settled - the axis reported the move finished
+   */
+   void OnSynchronizedMoveFinished( long steps, bool settled );
+
 private:
 
    //Constructor Property Logic
    int SetAdjuster( std::string key );
    int SetController( std::string key );
 
+   //Stop and Delete the Telemetry Sampler (Must Happen Before controller_ is Deleted)
+   void DestroyTelemetrySampler( void );
+
+   //Position Readback Logic
+   /* Tie the Current Controller Readback Count to a Stage Position in um
+   *   Note:  Must be redone whenever the step-to-um relation (partition, readback source) changes
+   *   @param posUm - stage position the current count represents
+   *   Returns - DEVICE_OK or DEVICE_SERIAL_COMMAND_FAILED if the count could not be read
+   */
+   int AnchorPositionReadback( double posUm );
+   //Convert a Difference in Readback Counts (Command Steps or Encoder Counts, Whichever is Read Back) to a Difference in um
+   double ReadbackStepsToUm( long steps );
+   //Convert a Difference in Command Position Steps to a Difference in um (Sign Matches OnPosition() Writes)
+   double CommandStepsToUm( long steps );
+   //SetBaseAnglePartition() That Keeps the Readback Origin Consistent Across the Change
+   int SetBaseAnglePartitionKeepOrigin( double baseAnglePartition );
+   //Take pos_um_ From Readback After Motion That Did Not End at an OnPosition() Target (Left Unchanged Without Readback)
+   void SyncPositionFromReadback( void );
+
+   //Longest a Stop or Ramp-Down is Waited Out Before pos_um_ is Synced Anyway
+   static const long motionStopTimeoutMS_ = 10000;
+   //Sleep Between Busy Polls While Waiting Out a Stop (Each Poll is Also a Bus Round Trip)
+   static const long motionStopPollMS_ = 1;
+   /* After a Stop or Ramp-Down Was Commanded:  Wait Until the Motor Stops, Then SyncPositionFromReadback()
+   *   Note:  Syncing mid-ramp would take a position the motor is still moving away from
+   */
+   void SyncPositionWhenStopped( void );
+
+   /* Center the Trigger Window on the Target of a Move About to be Written
+   *   @param moveSteps - relative move as written to the controller
+   */
+   void ArmTriggerWindow( long moveSteps );
+
+   /* Tie the Controller's Present Command Position to pos_um_ For Absolute Positioning
+   *   Note:  Must be redone whenever the step-to-um relation (partition) changes
+   *   Returns - DEVICE_OK or DEVICE_SERIAL_COMMAND_FAILED if the command position could not be read
+   */
+   int AnchorAbsolutePositioning( void );
+   /* Command Position (Controller Steps) of Stage Position posUm, Rounded From the Absolute Origin so Errors Never Accumulate
+   *   Returns - DEVICE_OK, or DEVICE_UNKNOWN_POSITION if the position register can not hold the target
+   */
+   int AbsoluteTargetSteps( double posUm, long& target );
+
+   //Stop and Delete the Sequence Executor (Must Happen Before controller_ is Deleted)
+   void DestroySequenceExecutor( void );
+
+   /* Wait Once For the Hub's Batched Physical Initialization of controller_ and Anchor the Readback After it
+   *   Note:  Call before the first serial use of controller_ after Initialize(); failures are only logged, as a direct initialization's were
+   */
+   void EnsureAxisInitialized( void );
+
    std::string name_;
 
    //Adjuster knob used just for reference
@@ -104,7 +196,16 @@ private:
 
    double stepSize_um_;
    double pos_um_;
+   //Readback Origin: readbackOriginUm_ Corresponds to Controller Count readbackOriginSteps_
+   bool readbackAnchored_;
+   long readbackOriginSteps_;
+   double readbackOriginUm_;
+   //Encoder Counter Resolution, Independent of the Step Partition
+   double encoderCountsPerRev_;
    bool initialized_;
+   //Physical Initialization Queued on the Hub and Not Yet Waited For (See EnsureAxisInitialized())
+   bool axisInitPending_;
+   MMThreadLock axisInitLock_;
    double lowerLimit_;
    double upperLimit_;
 
@@ -114,6 +215,49 @@ private:
 
    OrientalFTDIHub* hub_;
 
+   //Background Motion Telemetry, Created in Initialize()
+   MotionTelemetrySampler* telemetry_;
+
+   //JSON Destination of the Move Latency Benchmark (Empty Only Logs the Summary)
+   std::string moveLatencyReportFile_;
+
+   //Profiles of profileFile_, All Validated Against controller_; activeProfile_ is the Last One Applied
+   std::vector< ControllerProfile > profiles_;
+   std::string profileFile_;
+   std::string activeProfile_;
+
+   //Plans Each OnPosition() Move While Enabled (the Controller is Then on Per-Move Rates)
+   MotionPlanner motionPlanner_;
+   bool motionPlannerEnabled_;
+
+   //Move() Has Run the Motor Since pos_um_ Was Last Known (Continuous Operation Also Uses the Planner's Speed and Acceleration Limits)
+   bool continuousDriven_;
+
+   //Held While pos_um_, continuousDriven_, absoluteTargetSteps_ or the Staged Move Plan Change:  sequenceExecutor_ Moves From its Own Thread
+   //Note:  Recursive (SetPositionUm() Takes it Again in OnPosition()); Never Held While Waiting on sequenceExecutor_
+   MMThreadLock motionLock_;
+
+   //Trigger Output (1 Based, 0 For None) and its Signal; TriggerOutputArea Windows Reach triggerWindowUm_ Either Side of Each OnPosition() Target
+   unsigned int triggerOutput_;
+   TriggerOutputSignal triggerSignal_;
+   double triggerWindowUm_;
+
+   //Positions From AddToStageSequence(), Run by sequenceExecutor_ Holding sequenceDwellMs_ at Each
+   static const long maxSequenceLength_ = 2000;
+   std::vector< double > sequence_;
+   double sequenceDwellMs_;
+   StageSequenceExecutor* sequenceExecutor_;
+
+   //Absolute Positioning Origin: absoluteOriginUm_ Corresponds to Command Position absoluteOriginSteps_;
+   //absoluteTargetSteps_ is the Last Command Position Written (or Anchored)
+   long absoluteOriginSteps_;
+   double absoluteOriginUm_;
+   long absoluteTargetSteps_;
+
+   //Destinations of the Motion Profile Tuner's Ranked JSON Report and Best Safe Profile (Empty Skips Either)
+   std::string motionTunerReportFile_;
+   std::string motionTunerProfileFile_;
+
 };
 
 
@@ -1,8 +1,16 @@
 #include "OrientalMotorHub.h"
+#include "OrientalMotorFocus.h"
 #include "../../MMDevice/ModuleInterface.h"
 #include "OrientalDeviceConstants.h"
+#include "AlternativeUtils.h"
+#include "ControllerLog.h"
+#include "ControllerTrace.h"
+#include "ProtocolBenchmark.h"
+#include "SynchronizedMove.h"
+#include <algorithm>
 #include <limits>
 #include <sstream>
+#include <stdio.h>
 
 //include possible Hub classes with options
 
@@ -26,11 +34,17 @@ const char* OrientalFTDIHub::hubRelatedPropertyNames_[] = {"", "Device Id", "",
 
 OrientalFTDIHub::OrientalFTDIHub( int maxConnRetries = 3 ) :
 		initialized_(false),
-		maxConnRetries_( maxConnRetries ),
+		connection_( maxConnRetries ),
+		listedGeneration_(0),
 		numPeripherals_(0),
-		statusMonitorThread_(nullptr)
+		statusMonitorThread_(nullptr),
+		peripheralInitializer_(nullptr),
+		captureTransport_( &ftdiTransport_ ),
+		replayActive_(false),
+		simulationActive_(false)
 {
 	InitializeDefaultErrorMessages();
+	connection_.SetListener( this );
 
 	//Pre-Initialize Data
 	
@@ -52,8 +66,21 @@ OrientalFTDIHub::OrientalFTDIHub( int maxConnRetries = 3 ) :
 	}
 
 	AddAllowedValue( g_GenericUsbHubPropName, "Unavailable" );
+
+	//Known Devices Come From the Port Cache, Only New Ones Are Opened (Off This Thread)
+	deviceEnumerator_.LoadCache( g_OrientalFTDIPortCacheFile );
+	deviceEnumerator_.StartScan();
+	if( deviceEnumerator_.WaitForScan( enumerationWaitMS_ ) == false )
+	{
+		LogMessage( "FTDI Enumeration Still Running, Remaining Devices Are Listed When it Finishes", false );
+	}
 	int numHubs = FindAvailableHubs( );
 
+	pAct = new CPropertyAction(this, &OrientalFTDIHub::OnRescanDevices);
+	CreateProperty( g_OrientalFTDIRescanName, g_OrientalFTDIRescanIdleOption, MM::String, false, pAct, true );
+	AddAllowedValue( g_OrientalFTDIRescanName, g_OrientalFTDIRescanIdleOption );
+	AddAllowedValue( g_OrientalFTDIRescanName, g_OrientalFTDIRescanRunOption );
+
 	//Check so that type conversions for DeviceUtils are not producing overflowed indices
 	if( numHubs > INT_MAX )
 	{
@@ -73,6 +100,21 @@ OrientalFTDIHub::OrientalFTDIHub( int maxConnRetries = 3 ) :
 		AddAllowedValue( "Number of Peripherals Attached", CDeviceUtils::ConvertToString(i) );
 	}
 
+	//Simulated Bus (Enable to Run Without Hardware, the Other Values Shape its Timing)
+	pAct = new CPropertyAction(this, &OrientalFTDIHub::OnBusSimulation);
+	CreateProperty( g_OrientalBusSimulationName, "Disable", MM::String, false, pAct, true );
+	AddAllowedValue( g_OrientalBusSimulationName, "Disable" );
+	AddAllowedValue( g_OrientalBusSimulationName, "Enable" );
+
+	pAct = new CPropertyAction(this, &OrientalFTDIHub::OnBusSimulationBaud);
+	CreateProperty( g_OrientalBusSimulationBaudName, CDeviceUtils::ConvertToString( static_cast< long >( SimulatedCRKTransport::defaultBaudRate_ ) ), MM::Integer, false, pAct, true );
+
+	pAct = new CPropertyAction(this, &OrientalFTDIHub::OnBusSimulationLatency);
+	CreateProperty( g_OrientalBusSimulationLatencyName, CDeviceUtils::ConvertToString( SimulatedCRKTransport::defaultUsbLatencyMS_ ), MM::Float, false, pAct, true );
+
+	pAct = new CPropertyAction(this, &OrientalFTDIHub::OnBusSimulationSpeed);
+	CreateProperty( g_OrientalBusSimulationSpeedName, CDeviceUtils::ConvertToString( SimulatedCRKTransport::defaultMotorSpeedStepsPerSec_ ), MM::Float, false, pAct, true );
+
 	/*  Semantic Use of Serial Port to Test Same Amounts of Stuff */
 /*	CPropertyAction* pAct = new CPropertyAction(this, &OrientalFTDIHub::OnPort);
 	CreateProperty(MM::g_Keyword_Port, "Undefined", MM::String, false, pAct, true);
@@ -87,9 +129,13 @@ OrientalFTDIHub::~OrientalFTDIHub() {
 int OrientalFTDIHub::Shutdown() { 
 
 		LogMessage( "In Hub ShutDown" );
-		if(openHub_) {
-			FT_Close(openHub_);
-		}    
+		ControllerLogScope logScope( &coreLogSink_ );
+		{
+			//No Transaction May See the Handle Close
+			MMThreadGuard guard( serialLineMutex_ );
+			connection_.Close( false );
+			ftdiTransport_.SetHandle( 0 );
+		}
 		//Values Being Initialized
 		LogMessage("Closed COM");
 		if(	initialized_ == true )
@@ -109,6 +155,26 @@ int OrientalFTDIHub::Shutdown() {
 				statusMonitorThread_ = nullptr;
 			}
 
+			if( peripheralInitializer_ != nullptr )
+			{
+				LogMessage( "Peripheral Initialization:\n" + peripheralInitializer_->Report() );
+				peripheralInitializer_->Stop();
+				peripheralInitializer_->wait();
+				delete peripheralInitializer_;
+				peripheralInitializer_ = nullptr;
+			}
+
+			telemetryRecorder_.Close();
+
+			{
+				MMThreadGuard guard( serialLineMutex_ );
+				captureTransport_.Close();
+				replayActive_ = false;
+			}
+
+			//Controllers Have Stopped Polling, Flush What They Logged
+			AbstractControllerInterfaceFactory::UnregisterLogger( &coreLogSink_ );
+
 		}
 
 	return DEVICE_OK; 
@@ -120,10 +186,27 @@ int OrientalFTDIHub::Initialize()
 	if( initialized_ == true )
 		return DEVICE_OK;
 
-		AbstractControllerInterfaceFactory::RegisterLogger(this, GetCoreCallback());
-		//Setup Status Monitor Thread For Hub
-		statusMonitorThread_ = new ControllerStatusMonitorThread( *this, *GetCoreCallback() );
+		coreLogSink_.Set( this, GetCoreCallback() );
+		coreLogSink_.SetTrace( &trace_ );
+		AbstractControllerInterfaceFactory::RegisterLogger( &coreLogSink_ );
+		ControllerLogScope logScope( &coreLogSink_ );
+		//Setup Status Monitor Thread For Hub (Each Hub Has its Own, Logging to This Hub)
+		statusMonitorThread_ = new ControllerStatusMonitorThread( 1, &coreLogSink_ );
 		statusMonitorThread_->Start();
+		//Axes Queue Their Physical Initialization Here as They Initialize, to be Batched on This Bus
+		//Fingerprints Are Kept Per FTDI Serial Number (the Simulated Bus Has One Fixed Name)
+		configFingerprints_.Load( g_OrientalConfigFingerprintFile );
+		std::string fingerprintBus;
+		if( simulationActive_ )
+		{
+			fingerprintBus = "Simulated";
+		}
+		else if( connection_.GetDevice() != nullptr )
+		{
+			fingerprintBus = connection_.GetDevice()->SerialNumber;
+		}
+		peripheralInitializer_ = new PeripheralInitializer( &coreLogSink_, &configFingerprints_, fingerprintBus );
+		peripheralInitializer_->Start();
 
 		LogMessage("In This Part of Initialize First");
 
@@ -139,6 +222,136 @@ int OrientalFTDIHub::Initialize()
 		if (DEVICE_OK != ret)
 			return ret;
 
+		//Binary Telemetry Recording (Empty Path is Off)
+		CPropertyAction* pAct = new CPropertyAction(this, &OrientalFTDIHub::OnTelemetryRecordingFile);
+		ret = CreateProperty( g_OrientalTelemetryRecordingFileName, "", MM::String, false, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		//Bus Capture and Replay (Empty Paths Are Off)
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnBusCaptureFile);
+		ret = CreateProperty( g_OrientalBusCaptureFileName, "", MM::String, false, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnBusReplayFile);
+		ret = CreateProperty( g_OrientalBusReplayFileName, "", MM::String, false, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnBusReplayTiming);
+		ret = CreateProperty( g_OrientalBusReplayTimingName, g_OrientalBusReplayOriginalOption, MM::String, false, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+		AddAllowedValue( g_OrientalBusReplayTimingName, g_OrientalBusReplayOriginalOption );
+		AddAllowedValue( g_OrientalBusReplayTimingName, g_OrientalBusReplayFastOption );
+
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnBusReplayMismatches);
+		ret = CreateProperty( g_OrientalBusReplayMismatchesName, "0", MM::Integer, true, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		//Bus Statistics (Read Only Summaries, One Per Function Code, the Total and a Selectable Slave)
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnBusStatsTotal);
+		ret = CreateProperty( g_OrientalBusStatsTotalName, "", MM::String, true, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		for( long i = 0; i < BusStatistics::NumFunctionSlots; i++ )
+		{
+			std::string propName( g_OrientalBusStatsPrefix );
+			propName += BusStatistics::FunctionSlotName( static_cast< BusStatistics::FunctionSlot >( i ) );
+			CPropertyActionEx* pActEx = new CPropertyActionEx(this, &OrientalFTDIHub::OnBusStatsFunction, i);
+			ret = CreateProperty( propName.c_str(), "", MM::String, true, pActEx );
+			if (DEVICE_OK != ret)
+				return ret;
+		}
+
+		ret = CreateProperty( g_OrientalBusStatsSlaveName, "1", MM::Integer, false );
+		if (DEVICE_OK != ret)
+			return ret;
+		SetPropertyLimits( g_OrientalBusStatsSlaveName, 0, BusStatistics::maxSlaveAddress_ );
+
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnBusStatsSelectedSlave);
+		ret = CreateProperty( g_OrientalBusStatsSelectedSlaveName, "", MM::String, true, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnBusStatsReset);
+		ret = CreateProperty( g_OrientalBusStatsResetName, g_OrientalBusStatsResetIdleOption, MM::String, false, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+		AddAllowedValue( g_OrientalBusStatsResetName, g_OrientalBusStatsResetIdleOption );
+		AddAllowedValue( g_OrientalBusStatsResetName, g_OrientalBusStatsResetOption );
+
+		//Controller Logging Level (Statements Below it Cost One Branch)
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnControllerLogLevel);
+		ret = CreateProperty( g_OrientalControllerLogLevelName, ControllerLog::LevelName( coreLogSink_.GetLevel() ), MM::String, false, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+		for( int level = LogLevelTrace; level <= LogLevelOff; level++ )
+		{
+			AddAllowedValue( g_OrientalControllerLogLevelName, ControllerLog::LevelName( level ) );
+		}
+
+		//Records Lost to a Full Log Ring (Logging Never Waits, so Bursts Can Overflow it)
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnControllerLogDropped);
+		ret = CreateProperty( g_OrientalControllerLogDroppedName, "0", MM::Integer, true, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		//Span Tracing (Enabling Starts a New Recording, Setting the Export File Writes the Recording There)
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnTraceState);
+		ret = CreateProperty( g_OrientalTraceStateName, "Disable", MM::String, false, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+		AddAllowedValue( g_OrientalTraceStateName, "Enable" );
+		AddAllowedValue( g_OrientalTraceStateName, "Disable" );
+
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnTraceExportFile);
+		ret = CreateProperty( g_OrientalTraceExportFileName, "", MM::String, false, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnTraceEventCount);
+		ret = CreateProperty( g_OrientalTraceEventCountName, "0", MM::Integer, true, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnTraceDroppedCount);
+		ret = CreateProperty( g_OrientalTraceDroppedCountName, "0", MM::Integer, true, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		//Protocol Benchmark (Run Times the Frame and Register Layers, One Report Line Per Operation)
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnProtocolBenchmark);
+		ret = CreateProperty( g_OrientalProtocolBenchmarkName, g_OrientalProtocolBenchmarkIdleOption, MM::String, false, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+		AddAllowedValue( g_OrientalProtocolBenchmarkName, g_OrientalProtocolBenchmarkIdleOption );
+		AddAllowedValue( g_OrientalProtocolBenchmarkName, g_OrientalProtocolBenchmarkRunOption );
+
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnProtocolBenchmarkReport);
+		ret = CreateProperty( g_OrientalProtocolBenchmarkReportName, "", MM::String, true, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		//Synchronized Move (Setting it Moves the Listed Axes, Started Together by One Broadcast Frame)
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnSynchronizedMove);
+		ret = CreateProperty( g_OrientalSynchronizedMoveName, "", MM::String, false, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnSynchronizedMoveReport);
+		ret = CreateProperty( g_OrientalSynchronizedMoveReportName, "", MM::String, true, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
+		pAct = new CPropertyAction(this, &OrientalFTDIHub::OnPeripheralInitReport);
+		ret = CreateProperty( g_OrientalPeripheralInitReportName, "", MM::String, true, pAct );
+		if (DEVICE_OK != ret)
+			return ret;
+
 		initialized_ = true;
 
 		return DEVICE_OK;
@@ -209,7 +422,9 @@ int OrientalFTDIHub::SetHubAndRelatedValues( MM::PropertyBase* hubProp )
 	}
 	else
 	{
-		if( ChangeOpenHubBySerialNumber( availDevObj->SerialNumber ) == DEVICE_INVALID_PROPERTY_VALUE )
+		//Only a Different Serial Number Reopens; Transactions Finish Before the Handle Changes
+		MMThreadGuard guard( serialLineMutex_ );
+		if( connection_.Select( *availDevObj ) != 0 )
 		{
 			availDevObj = nullptr;
 		}
@@ -218,6 +433,21 @@ int OrientalFTDIHub::SetHubAndRelatedValues( MM::PropertyBase* hubProp )
 	//A Set that Disregards the SetValue Rules from higher access levels
 	hubProp->Set( hubName.c_str() );	
 
+	//Related Values Were Refreshed by OnFTDIConnectionChanged() if the Device Changed
+	if( availDevObj == nullptr )
+	{
+		SetHubRelatedProperties( nullptr );
+	}
+
+	return DEVICE_OK;
+}
+
+/* Show device's Info in the Hub Related Properties ("Unavailable" For nullptr)
+*/
+void OrientalFTDIHub::SetHubRelatedProperties( const FT_DEVICE_LIST_INFO_NODE* availDevObj )
+{
+	int ret;
+
 	for(std::size_t i = 0; i < (sizeof(hubRelatedPropertyNames_) / sizeof(hubRelatedPropertyNames_[0])); i++)
 	{
 		//Only For Properties with non-"" names
@@ -259,62 +489,68 @@ int OrientalFTDIHub::SetHubAndRelatedValues( MM::PropertyBase* hubProp )
 		}
 
 	}
+}
 
-	return DEVICE_OK;
+/* Change Event of the Connection:  Called by connection_ (Under serialLineMutex_) Only When the Open Device Changed
+*/
+void OrientalFTDIHub::OnFTDIConnectionChanged( FT_HANDLE handle, const FT_DEVICE_LIST_INFO_NODE* device )
+{
+	ftdiTransport_.SetHandle( handle );
+
+	SetHubRelatedProperties( device );
+	OnPropertiesChanged();
+
+	if( device != nullptr )
+	{
+		std::ostringstream os;
+		os << "Opened FTDI Device " << device->SerialNumber << " (Open " << connection_.GetOpenCount() << ")";
+		LogMessage( os.str(), true );
+	}
+	else
+	{
+		LogMessage( "FTDI Device Closed", true );
+	}
 }
 
 
 
 
 //Bundled Separately Due to the constant need to update the List 
-//Fills Map of <IDS, FTDI_DEVICE_LIST_INFO_NODE> for current Setup
+//Fills Map of <IDS, FTDI_DEVICE_LIST_INFO_NODE> From the Enumerator's Last Scan (No Device is Opened Here)
 //Completely clears any previous data
-//Should only be used to determine and store Handle Data
+//Selects the First Device if None is Selected Yet
 //Returns Vector Length
  int OrientalFTDIHub::FindAvailableHubs( )
  {
+	std::map< std::string, FTDIDeviceEntry > devices;
+	listedGeneration_ = deviceEnumerator_.GetDevices( devices );
+
 	//Ensure Map List Is Completely Blank
 	curAvailDevMap_.clear();
+	ClearAllowedValues( g_GenericUsbHubPropName );
+	AddAllowedValue( g_GenericUsbHubPropName, "Unavailable" );
 
-	DWORD numHubs;
-
-	FT_CreateDeviceInfoList( &numHubs );
-
-	//if( numHubs == 0 ) Prompt for plugins
-
-	FT_DEVICE_LIST_INFO_NODE devList[ MM::MaxStrLength/sizeof(FT_DEVICE_LIST_INFO_NODE) ];
-	long portNum;
 	std::string hubName(g_GenericHubFoundPrefix);
 	std::string hubOption;
-	bool first = true;
-	FT_HANDLE handle;
-
-	FT_GetDeviceInfoList( devList, &numHubs );
+	std::string firstOption;
 
-	//Cycle through Device List Info
-	for( int i = 0; i < numHubs; ++i )
+	for( std::map< std::string, FTDIDeviceEntry >::iterator it = devices.begin(); it != devices.end(); ++it )
 	{
-		//Check if Device is not opened in other threads and store as an option
-		if( (devList[i].Flags & 1) == 0 )
+		hubOption = hubName + CDeviceUtils::ConvertToString( it->second.comPort );
+		curAvailDevMap_[ hubOption ] = it->second.info;
+		AddAllowedValue( g_GenericUsbHubPropName, hubOption.c_str() );
+		if( firstOption.empty() )
 		{
-			//If Device Won't open, softly discard it from available lists
-			if( FT_OpenEx( devList[i].SerialNumber, FT_OPEN_BY_SERIAL_NUMBER, &handle ) == FT_OK )
-			{
-				FT_GetComPortNumber( handle, &portNum );
-				FT_Close( handle );
-
-				hubOption = hubName + CDeviceUtils::ConvertToString( portNum );
-				curAvailDevMap_[ hubOption ] = devList[i];
-				AddAllowedValue( g_GenericUsbHubPropName, hubOption.c_str() );
-				if( first )
-				{
-					SetProperty(g_GenericUsbHubPropName, hubOption.c_str() );
-					first = false;
-				}
-			}
+			firstOption = hubOption;
 		}
 	}
 
+	char selected[MM::MaxStrLength];
+	if( firstOption.empty() == false && GetProperty( g_GenericUsbHubPropName, selected ) == DEVICE_OK && strcmp( selected, "Unavailable" ) == 0 )
+	{
+		SetProperty( g_GenericUsbHubPropName, firstOption.c_str() );
+	}
+
 	return curAvailDevMap_.size();
 
  }
@@ -325,120 +561,602 @@ int OrientalFTDIHub::SetHubAndRelatedValues( MM::PropertyBase* hubProp )
 
  *******************************************/
 
- int OrientalFTDIHub::FTDISerialCommunicate( unsigned char txMsgBuffer[], int txMsgLen,  AbstractControllerInterface* controller, bool broadcast )
-{
+ //Empty Path Closes the Recording, Any Other Path Starts a New One
+ int OrientalFTDIHub::OnTelemetryRecordingFile(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( telemetryRecorder_.GetPath().c_str() );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 std::string path;
+		 pProp->Get( path );
+
+		 if( path.empty() )
+		 {
+			 telemetryRecorder_.Close();
+		 }
+		 else if( telemetryRecorder_.Open( path ) != 0 )
+		 {
+			 LogMessage( "Could Not Open Telemetry Recording " + path );
+			 pProp->Set( "" );
+			 return DEVICE_INVALID_PROPERTY_VALUE;
+		 }
+	 }
 
-	DWORD bytesWritten;
-	std::ostringstream os;
+	 return DEVICE_OK;
+ }
 
-	MMThreadGuard guard(serialLineMutex_);
+ //SerialControllerBus:  Live FTDI Device, or the Loaded Capture While Replaying, Wrapped by the Capture When Recording
+ SerialTransport* OrientalFTDIHub::ActiveTransport( void )
+ {
+	 SerialTransport* base = static_cast< SerialTransport* >( &ftdiTransport_ );
+	 if( replayActive_ )
+	 {
+		 base = &replayTransport_;
+	 }
+	 else if( simulationActive_ )
+	 {
+		 base = &simulatedTransport_;
+	 }
 
-	/*
-	*  This Set Rate will change to a dynamic value in the another function
-	*/
-	if( FT_SetBaudRate( openHub_, 9600 ) != FT_OK )
-	{
-		LogMessage( "Could not set Baud Rate" );
-	}
+	 if( captureTransport_.IsOpen() )
+	 {
+		 captureTransport_.SetWrapped( base );
+		 return &captureTransport_;
+	 }
 
-	if( FT_SetDataCharacteristics(openHub_, FT_BITS_8, FT_STOP_BITS_1, FT_PARITY_EVEN) != FT_OK )
-	{
-		LogMessage("Could not set characteristics");
-	}
-	FT_SetTimeouts( openHub_, 5000, 0 );
-	/*
-	*
-	*/
-	/*
-	os << "The address being sent is " << (int) txMsgBuffer[0] << " and Data is ";
-	for( int i = 1; i< txMsgLen; i++ )
-	{
-		os << "byte " << i << " Is: " << (int) txMsgBuffer[i] << "\n";
-	}
-	LogMessage( os.str() );*/
-	
-	FT_Write( openHub_, txMsgBuffer, txMsgLen, &bytesWritten );
+	 return base;
+ }
 
-	if( bytesWritten != txMsgLen )
-	{
-		//error handling internal Write Error
-		return 1;
-	}
+ //Empty Path Stops Capturing, Any Other Path Starts a New Capture
+ int OrientalFTDIHub::OnBusCaptureFile(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( captureTransport_.GetPath().c_str() );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 std::string path;
+		 pProp->Get( path );
+
+		 MMThreadGuard guard( serialLineMutex_ );
+
+		 if( path.empty() )
+		 {
+			 captureTransport_.Close();
+		 }
+		 else if( captureTransport_.Open( path ) != 0 )
+		 {
+			 LogMessage( "Could Not Open Bus Capture " + path );
+			 pProp->Set( "" );
+			 return DEVICE_INVALID_PROPERTY_VALUE;
+		 }
+	 }
 
-	if( broadcast == true)
-		return DEVICE_OK;
-	LogMessage("Header Length Look Up");
-	int headerLen = controller->headerLengthLookup( txMsgBuffer, txMsgLen );
-	//Handle Internal Error
-	if( headerLen <= 0 )
-	{
-		return DEVICE_ERR;
-	}
+	 return DEVICE_OK;
+ }
 
-	unsigned char rxBuffer[ MM::MaxStrLength ];
-	DWORD bytesRead;
-	LogMessage("Retrieve Header");
-	if( FT_Read( openHub_, rxBuffer, headerLen, &bytesRead ) != FT_OK )
-	{
-		LogMessage( "Error Read" );
-		return 1;
-	}
-	else if( bytesRead != headerLen )
-	{
-		LogMessage( "Failed To Read all of this" );
-		//Error Report:  TimeOut Without response
-		return DEVICE_ERR;
-	}
+ //Empty Path Returns to the Live Device, Any Other Path Loads That Capture and Replays it From the Start
+ int OrientalFTDIHub::OnBusReplayFile(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( ( replayActive_ ) ? replayTransport_.GetPath().c_str() : "" );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 std::string path;
+		 pProp->Get( path );
 
-	LogMessage("Check Address");
-	//Generic Address Check
-	if( controller->sameAddress( rxBuffer, bytesRead ) == false )
-	{
-		//Error Mismatched Slave Address
-		return DEVICE_ERR;
-	}
-	LogMessage("dataLengthLookup");
-	int dataLen = controller->dataLengthLookup( rxBuffer, bytesRead );
+		 MMThreadGuard guard( serialLineMutex_ );
 
-	if( dataLen <= 0 )
-	{
-		//Data Length Lookup Unexpected Header Information
-		return DEVICE_ERR;
-	}
+		 replayActive_ = false;
+		 if( path.empty() )
+		 {
+			 return DEVICE_OK;
+		 }
 
-	LogMessage("Read Data");
-	if( FT_Read( openHub_, &rxBuffer[headerLen], dataLen, &bytesRead ) != FT_OK )
-	{
-		LogMessage("Read Issue");
-		return 1;
-	}
-	else if( bytesRead != dataLen )
-	{
-		LogMessage("bytes not equal to dataLen");
-		//Error Report:  TimeOut Without response
-		return DEVICE_ERR;
-	}
+		 if( replayTransport_.Load( path ) != 0 )
+		 {
+			 LogMessage( "Could Not Load Bus Capture " + path );
+			 pProp->Set( "" );
+			 return DEVICE_INVALID_PROPERTY_VALUE;
+		 }
 
-	LogMessage("Parse Data");
-	//Generic controller 
-	int errCode = controller->parseData( txMsgBuffer, txMsgLen, rxBuffer, bytesRead + headerLen );
-	if( errCode != DEVICE_OK )
-	{
-		//Error Report: data returns an error
-		LogMessage( CDeviceUtils::ConvertToString( errCode ) );
-		return errCode;
-	}
+		 replayActive_ = true;
+	 }
 
-	LogMessage( "It's all good." );
+	 return DEVICE_OK;
+ }
 
-	return DEVICE_OK;
-}
+ //Enabling Starts From Fresh Slaves (Every Motor at Rest at 0)
+ int OrientalFTDIHub::OnBusSimulation(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( ( simulationActive_ ) ? "Enable" : "Disable" );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 std::string answer;
+		 pProp->Get( answer );
+
+		 MMThreadGuard guard( serialLineMutex_ );
+		 if( answer == "Enable" && simulationActive_ == false )
+		 {
+			 simulatedTransport_.Reset();
+		 }
+		 simulationActive_ = ( answer == "Enable" );
+	 }
 
- /******************************************
+	 return DEVICE_OK;
+ }
 
- Action Handlers
+ int OrientalFTDIHub::OnBusSimulationBaud(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( static_cast< long >( simulatedTransport_.GetBaudRate() ) );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 long baudRate;
+		 pProp->Get( baudRate );
+		 if( baudRate <= 0 )
+		 {
+			 return DEVICE_INVALID_PROPERTY_VALUE;
+		 }
+
+		 MMThreadGuard guard( serialLineMutex_ );
+		 simulatedTransport_.SetBaudRate( static_cast< unsigned long >( baudRate ) );
+	 }
 
- *******************************************/
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnBusSimulationLatency(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( simulatedTransport_.GetUsbLatencyMs() );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 double latencyMs;
+		 pProp->Get( latencyMs );
+		 if( latencyMs < 0 )
+		 {
+			 return DEVICE_INVALID_PROPERTY_VALUE;
+		 }
+
+		 MMThreadGuard guard( serialLineMutex_ );
+		 simulatedTransport_.SetUsbLatencyMs( latencyMs );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnBusSimulationSpeed(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( simulatedTransport_.GetMotorSpeed() );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 double stepsPerSec;
+		 pProp->Get( stepsPerSec );
+		 if( stepsPerSec <= 0 )
+		 {
+			 return DEVICE_INVALID_PROPERTY_VALUE;
+		 }
+
+		 MMThreadGuard guard( serialLineMutex_ );
+		 simulatedTransport_.SetMotorSpeed( stepsPerSec );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ bool OrientalFTDIHub::GetBusSimulation( unsigned long& baudRate, double& usbLatencyMs, double& motorSpeedStepsPerSec )
+ {
+	 MMThreadGuard guard( serialLineMutex_ );
+
+	 baudRate = simulatedTransport_.GetBaudRate();
+	 usbLatencyMs = simulatedTransport_.GetUsbLatencyMs();
+	 motorSpeedStepsPerSec = simulatedTransport_.GetMotorSpeed();
+
+	 return simulationActive_ && replayActive_ == false;
+ }
+
+ int OrientalFTDIHub::OnBusReplayTiming(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( ( replayTransport_.GetOriginalTiming() ) ? g_OrientalBusReplayOriginalOption : g_OrientalBusReplayFastOption );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 std::string answer;
+		 pProp->Get( answer );
+
+		 MMThreadGuard guard( serialLineMutex_ );
+		 replayTransport_.SetOriginalTiming( answer == g_OrientalBusReplayOriginalOption );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnBusReplayMismatches(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 MMThreadGuard guard( serialLineMutex_ );
+		 pProp->Set( static_cast< long >( replayTransport_.GetMismatchCount() ) );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnBusStatsTotal(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( busStatistics_.GetTotal().Summary( CAlternativeUtils::GetMonotonicTimeMs() ).c_str() );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnBusStatsFunction(MM::PropertyBase* pProp, MM::ActionType eAct, long slot)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 const BusTransactionStats& stats = busStatistics_.GetByFunction( static_cast< BusStatistics::FunctionSlot >( slot ) );
+		 pProp->Set( stats.Summary( CAlternativeUtils::GetMonotonicTimeMs() ).c_str() );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnBusStatsSelectedSlave(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 long slave = 0;
+		 GetProperty( g_OrientalBusStatsSlaveName, slave );
+		 const BusTransactionStats& stats = busStatistics_.GetBySlave( static_cast< uint8_t >( slave ) );
+		 pProp->Set( stats.Summary( CAlternativeUtils::GetMonotonicTimeMs() ).c_str() );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ //Setting "Reset" Clears Every Counter and Histogram, Then Reads Back as Idle
+ int OrientalFTDIHub::OnBusStatsReset(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( g_OrientalBusStatsResetIdleOption );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 std::string answer;
+		 pProp->Get( answer );
+
+		 if( answer == g_OrientalBusStatsResetOption )
+		 {
+			 busStatistics_.Reset();
+		 }
+		 pProp->Set( g_OrientalBusStatsResetIdleOption );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnControllerLogLevel(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( ControllerLog::LevelName( coreLogSink_.GetLevel() ) );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 std::string answer;
+		 pProp->Get( answer );
+
+		 int level = ControllerLog::LevelFromName( answer );
+		 if( level < 0 )
+		 {
+			 return DEVICE_INVALID_PROPERTY_VALUE;
+		 }
+		 coreLogSink_.SetLevel( level );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnControllerLogDropped(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( static_cast< long >( ControllerLog::GetDroppedCount() ) );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnTraceState(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( ( trace_.IsEnabled() ) ? "Enable" : "Disable" );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 std::string answer;
+		 pProp->Get( answer );
+
+		 if( answer == "Enable" )
+		 {
+			 if( trace_.IsEnabled() == false && trace_.Start() != 0 )
+			 {
+				 pProp->Set( "Disable" );
+				 return DEVICE_OUT_OF_MEMORY;
+			 }
+		 }
+		 else
+		 {
+			 trace_.Stop();
+		 }
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ //Writes the Current Recording Each Time a Path is Set (Recording Continues if Enabled)
+ int OrientalFTDIHub::OnTraceExportFile(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if ( eAct == MM::AfterSet )
+	 {
+		 std::string path;
+		 pProp->Get( path );
+
+		 if( path.empty() == false && trace_.ExportChromeJson( path ) != 0 )
+		 {
+			 LogMessage( "Could Not Export Trace to " + path );
+			 return DEVICE_ERR;
+		 }
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnTraceEventCount(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( static_cast< long >( trace_.GetEventCount() ) );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnTraceDroppedCount(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( static_cast< long >( trace_.GetDroppedCount() ) );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnProtocolBenchmark(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 int ret = DEVICE_OK;
+
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( g_OrientalProtocolBenchmarkIdleOption );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 std::string answer;
+		 pProp->Get( answer );
+
+		 if( answer == g_OrientalProtocolBenchmarkRunOption )
+		 {
+			 ProtocolBenchmark benchmark;
+			 if( benchmark.Run() != 0 )
+			 {
+				 ret = DEVICE_ERR;
+			 }
+			 protocolBenchmarkReport_ = benchmark.Report();
+			 LogMessage( "Protocol Benchmark:\n" + protocolBenchmarkReport_ );
+		 }
+		 pProp->Set( g_OrientalProtocolBenchmarkIdleOption );
+	 }
+
+	 return ret;
+ }
+
+ int OrientalFTDIHub::OnProtocolBenchmarkReport(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( protocolBenchmarkReport_.c_str() );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ int OrientalFTDIHub::OnSynchronizedMove(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 int ret = DEVICE_OK;
+
+	 if( eAct == MM::AfterSet )
+	 {
+		 std::string request;
+		 pProp->Get( request );
+
+		 if( request.empty() == false )
+		 {
+			 ret = RunSynchronizedMove( request );
+		 }
+		 //Request is Consumed
+		 pProp->Set( "" );
+	 }
+
+	 return ret;
+ }
+
+ int OrientalFTDIHub::OnSynchronizedMoveReport(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( synchronizedMoveReport_.c_str() );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ /* Axes a Synchronized Move Can Include
+ *   Note:  Registering the same controller twice has no effect
+ */
+ void OrientalFTDIHub::RegisterAxis( AbstractControllerInterface* controller, OrientalMotorFocus* owner )
+ {
+	 MMThreadGuard guard( axesLock_ );
+	 if( controller != nullptr && std::find( axes_.begin(), axes_.end(), controller ) == axes_.end() )
+	 {
+		 axes_.push_back( controller );
+		 axisOwners_.push_back( owner );
+	 }
+ }
+
+ /* Note:  Also drops the axis from the initializer, waiting out a batch that uses it
+ */
+ void OrientalFTDIHub::UnregisterAxis( AbstractControllerInterface* controller )
+ {
+	 if( peripheralInitializer_ != nullptr )
+	 {
+		 peripheralInitializer_->Remove( controller );
+	 }
+
+	 MMThreadGuard guard( axesLock_ );
+	 std::vector< AbstractControllerInterface* >::iterator it = std::find( axes_.begin(), axes_.end(), controller );
+	 if( it != axes_.end() )
+	 {
+		 axisOwners_.erase( axisOwners_.begin() + ( it - axes_.begin() ) );
+		 axes_.erase( it );
+	 }
+ }
+
+ /* Queue an Axis For the Hub's Batched Physical Initialization
+ *   Returns - DEVICE_OK if queued, DEVICE_ERR if the hub is not initialized (the caller initializes the axis itself)
+ */
+ int OrientalFTDIHub::QueueAxisInitialization( AbstractControllerInterface* controller )
+ {
+	 if( peripheralInitializer_ == nullptr || controller == nullptr )
+	 {
+		 return DEVICE_ERR;
+	 }
+
+	 peripheralInitializer_->Enqueue( controller );
+	 return DEVICE_OK;
+ }
+
+ /* Wait For a Queued Axis' Physical Initialization
+ *   Returns - the InitializePhysicalController() result, or DEVICE_ERR if the axis is not queued or the wait timed out
+ */
+ int OrientalFTDIHub::WaitForAxisInitialization( AbstractControllerInterface* controller, long timeoutMS )
+ {
+	 int errCode;
+
+	 if( peripheralInitializer_ == nullptr || peripheralInitializer_->WaitForAxis( controller, errCode, timeoutMS ) == false )
+	 {
+		 return DEVICE_ERR;
+	 }
+
+	 return errCode;
+ }
+
+ int OrientalFTDIHub::OnPeripheralInitReport(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( ( peripheralInitializer_ != nullptr ) ? peripheralInitializer_->Report().c_str() : "" );
+	 }
+
+	 return DEVICE_OK;
+ }
+
+ /* Run a Synchronized Move From a "address:steps[,address:steps...]" Request
+ *   Note:  Registered axes that are not listed are preloaded with 0 steps, since the broadcast start reaches them too
+ *   Note:  Focus devices owning a moved axis (or one that failed) are told after the move, so their Position follows it
+ *   Returns - 0 if every axis settled, DEVICE_INVALID_PROPERTY_VALUE for a bad request, otherwise the first axis error
+ */
+ int OrientalFTDIHub::RunSynchronizedMove( const std::string& request )
+ {
+	 ControllerLogScope logScope( &coreLogSink_ );
+	 MMThreadGuard guard( axesLock_ );
+	 std::vector< long > steps( axes_.size(), 0 );
+
+	 std::istringstream entries( request );
+	 std::string entry;
+	 while( std::getline( entries, entry, ',' ) )
+	 {
+		 unsigned int address;
+		 long entrySteps;
+		 if( sscanf( entry.c_str(), " %u : %ld", &address, &entrySteps ) != 2 )
+		 {
+			 return DEVICE_INVALID_PROPERTY_VALUE;
+		 }
+
+		 size_t i = 0;
+		 for( ; i < axes_.size(); i++ )
+		 {
+			 unsigned char axisAddress = 0;
+			 axes_[i]->GetAddress( axisAddress );
+			 if( axisAddress == address )
+			 {
+				 break;
+			 }
+		 }
+		 if( i == axes_.size() )
+		 {
+			 return DEVICE_INVALID_PROPERTY_VALUE;
+		 }
+		 steps[i] = entrySteps;
+	 }
+
+	 SynchronizedMove move;
+	 for( size_t i = 0; i < axes_.size(); i++ )
+	 {
+		 //A Move Must Not Overtake an Axis Still Being Configured (Axes Initialized Directly Return at Once)
+		 WaitForAxisInitialization( axes_[i], PeripheralInitializer::defaultWaitMS_ );
+		 move.AddAxis( axes_[i], steps[i] );
+	 }
+
+	 int ret = move.Execute();
+	 synchronizedMoveReport_ = move.Summary();
+
+	 //OnPosition() Moves Are Relative to the Focus Device's Position, Which Must Not be Left Behind
+	 const std::vector< SynchronizedMoveAxisResult >& results = move.GetResults();
+	 for( size_t i = 0; i < axisOwners_.size(); i++ )
+	 {
+		 if( axisOwners_[i] != nullptr )
+		 {
+			 axisOwners_[i]->OnSynchronizedMoveFinished( results[i].steps, results[i].errCode == 0 );
+		 }
+	 }
+	 LogMessage( "Synchronized Move:\n" + synchronizedMoveReport_ );
+
+	 return ( ret == 0 ) ? DEVICE_OK : DEVICE_ERR;
+ }
 
  int OrientalFTDIHub::OnHubSelect(MM::PropertyBase* pProp, MM::ActionType eAct)
  {
@@ -446,7 +1164,12 @@ int OrientalFTDIHub::SetHubAndRelatedValues( MM::PropertyBase* hubProp )
 	
 	 if( eAct == MM::BeforeGet )
 	 {
-		 ret = SetHubAndRelatedValues( pProp );
+		 //The Stored Value and the Related Properties Are Current (Changes Go Through AfterSet), so the Device is Not Touched
+		 //A Scan That Finished Late Only Changes the Options
+		 if( deviceEnumerator_.GetGeneration() != listedGeneration_ )
+		 {
+			 FindAvailableHubs();
+		 }
 	 }
 	 else if ( eAct == MM::AfterSet )
 	 {
@@ -458,6 +1181,31 @@ int OrientalFTDIHub::SetHubAndRelatedValues( MM::PropertyBase* hubProp )
 	 return DEVICE_OK;
  }
 
+ /* Rescan Action:  Lists New and Removed Devices (Only New Serial Numbers Without a Cached Port Are Opened)
+ */
+ int OrientalFTDIHub::OnRescanDevices(MM::PropertyBase* pProp, MM::ActionType eAct)
+ {
+	 if( eAct == MM::BeforeGet )
+	 {
+		 pProp->Set( g_OrientalFTDIRescanIdleOption );
+	 }
+	 else if ( eAct == MM::AfterSet )
+	 {
+		 std::string answer;
+		 pProp->Get( answer );
+
+		 if( answer == g_OrientalFTDIRescanRunOption )
+		 {
+			 deviceEnumerator_.StartScan();
+			 deviceEnumerator_.WaitForScan( enumerationWaitMS_ );
+			 FindAvailableHubs();
+		 }
+		 pProp->Set( g_OrientalFTDIRescanIdleOption );
+	 }
+
+	 return DEVICE_OK;
+ }
+
  //Used to Allow for Addition of other controllers
 int OrientalFTDIHub::OnPeripheralNumber(MM::PropertyBase* pProp, MM::ActionType eAct)
 {
@@ -479,30 +1227,6 @@ int OrientalFTDIHub::OnPeripheralNumber(MM::PropertyBase* pProp, MM::ActionType
 
 }
 
- //Attempt to Open Hub A Number of Times, in case it is still enumerating
- int OrientalFTDIHub::ChangeOpenHubBySerialNumber( char serialNum[16] )
- {
-	 int ret;
-	 //Close Previous Connection
-	 if( openHub_ )
-	 {
-		FT_Close( openHub_ );
-	 }
-	
-	 for( int i = 0; i < maxConnRetries_; i++ )
-	 {
-		ret = FT_OpenEx( serialNum, FT_OPEN_BY_SERIAL_NUMBER, &openHub_ );
-		if( ret == FT_OK )
-		{
-			return DEVICE_OK;
-		}
-	 }
-
-	 openHub_ = 0;
-
-	 return DEVICE_INVALID_PROPERTY_VALUE;
- }
-
  //Use the User Interface Value to correlate to 
 FT_DEVICE_LIST_INFO_NODE* OrientalFTDIHub::GetFTDIDeviceFromComValue( std::string value )
 {
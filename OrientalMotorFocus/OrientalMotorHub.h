@@ -4,9 +4,17 @@
 #include "../../MMDevice/MMDevice.h"
 #include "../../MMDevice/DeviceBase.h"
 #include "OrientalControllerTemplate.h"
+#include "SerialControllerBus.h"
 #include "ControllerStatusMonitorThread.h"
+#include "FTDISerialTransport.h"
+#include "FTDIConnectionManager.h"
+#include "FTDIDeviceEnumerator.h"
+#include "PeripheralInitializer.h"
+#include "ConfigFingerprintCache.h"
+#include "ControllerTrace.h"
 #include <string>
 #include <map>
+#include <boost/atomic.hpp>
 #include "ftd2xx.h"
 
 
@@ -17,8 +25,26 @@
 //Custom Constants
 #define DEVICE_OCCUPIED -1
 
+//Forward Declarations
+class OrientalMotorFocus;
 
-class OrientalFTDIHub : public HubBase<OrientalFTDIHub>
+
+/*  Hands Controller Log Records to a Device's Core Callback (the Core Logs For That Device)
+*/
+class CoreControllerLogSink : public ControllerLogSink
+{
+	public:
+		CoreControllerLogSink() : device_(nullptr), core_(nullptr) {}
+
+		void Set( MM::Device* device, MM::Core* core ) { device_ = device; core_ = core; }
+		void LogMessage( const char* text, bool debugOnly ) { if( core_ != nullptr ) core_->LogMessage( device_, text, debugOnly ); }
+
+	private:
+		MM::Device* device_;
+		MM::Core* core_;
+};
+
+class OrientalFTDIHub : public HubBase<OrientalFTDIHub>, public SerialControllerBus, public FTDIConnectionListener
 {
 public:
 	OrientalFTDIHub( int maxConnRetries );
@@ -42,39 +68,125 @@ public:
    int VerifiedClose(void* &ptr, int retries = 3);
    int DetectInstalledDevices(void);
 
-   //Using FTDI Library...  
-
-   int FTDISerialCommunicate( unsigned char txMsgBuffer[], int txMsgLen,  AbstractControllerInterface* controller, bool broadcast = false );
-
    //Property Events
    int OnVID(MM::PropertyBase* pProp, MM::ActionType pAct);
    int OnPID(MM::PropertyBase* pProp, MM::ActionType pAct);
    int OnHubSelect(MM::PropertyBase* pProp, MM::ActionType eAct);
+   int OnRescanDevices(MM::PropertyBase* pProp, MM::ActionType eAct);
    int OnPeripheralNumber(MM::PropertyBase* pProp, MM::ActionType eAct);
    int OnControllerSelect(MM::PropertyBase* pProp, MM::ActionType eAct, long peripheralNumber);
    int onPort( MM::PropertyBase* pProp, MM::ActionType pAct );
+   int OnTelemetryRecordingFile( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnBusCaptureFile( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnBusReplayFile( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnBusReplayTiming( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnBusReplayMismatches( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnBusSimulation( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnBusSimulationBaud( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnBusSimulationLatency( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnBusSimulationSpeed( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnBusStatsTotal( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnBusStatsFunction( MM::PropertyBase* pProp, MM::ActionType eAct, long slot );
+   int OnBusStatsSelectedSlave( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnBusStatsReset( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnControllerLogLevel( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnControllerLogDropped( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnTraceState( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnTraceExportFile( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnTraceEventCount( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnTraceDroppedCount( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnProtocolBenchmark( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnProtocolBenchmarkReport( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnSynchronizedMove( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnSynchronizedMoveReport( MM::PropertyBase* pProp, MM::ActionType eAct );
+   int OnPeripheralInitReport( MM::PropertyBase* pProp, MM::ActionType eAct );
+
+   /* Axes a Synchronized Move Can Include (Focus Devices Register Their Controller in Initialize())
+   *   Note:  The broadcast start reaches every slave, so every registered axis is preloaded by a synchronized move
+   *   @param owner - focus device whose position a synchronized move changes (told after each move), or nullptr
+   */
+   void RegisterAxis( AbstractControllerInterface* controller, OrientalMotorFocus* owner = nullptr );
+   void UnregisterAxis( AbstractControllerInterface* controller );
+
+   /* Queue an Axis For the Hub's Batched Physical Initialization (See PeripheralInitializer)
+   *   Returns - DEVICE_OK if queued, DEVICE_ERR if the hub is not initialized (the caller initializes the axis itself)
+   */
+   int QueueAxisInitialization( AbstractControllerInterface* controller );
+
+   /* Wait For a Queued Axis' Physical Initialization
+   *   @param timeoutMS - longest to wait
+   *   Returns - the InitializePhysicalController() result, or DEVICE_ERR if the axis is not queued or the wait timed out
+   */
+   int WaitForAxisInitialization( AbstractControllerInterface* controller, long timeoutMS );
 
    //Monitor Thread
    ControllerStatusMonitorThread* GetStatusMonitorThread( void ) { return statusMonitorThread_; }
 
+   //FTDIConnectionListener: Points the Live Transport at the New Handle and Refreshes the Hub Related Properties
+   void OnFTDIConnectionChanged( FT_HANDLE handle, const FT_DEVICE_LIST_INFO_NODE* device );
+
+   //Controller Logging of This Hub Only (Records Emitted in a ControllerLogScope of it)
+   ControllerLogSink* GetLogSink( void ) { return &coreLogSink_; }
+
+   /* Line Parameters of the Simulated Bus, For Reports
+   *   Returns - true if transactions currently go to the simulated slaves (replay takes precedence)
+   */
+   bool GetBusSimulation( unsigned long& baudRate, double& usbLatencyMs, double& motorSpeedStepsPerSec );
+
 private:
 		
    void GetPeripheralInventory();
    int SetHubAndRelatedValues( MM::PropertyBase* hubProp );
-   int ChangeOpenHubBySerialNumber( char serialNum[16] );
+   //Show device's Info in the Hub Related Properties ("Unavailable" For nullptr)
+   void SetHubRelatedProperties( const FT_DEVICE_LIST_INFO_NODE* device );
 
    FT_DEVICE_LIST_INFO_NODE* GetFTDIDeviceFromComValue( std::string value );
 
    //Related to to selected FTDI (See Definition)
    static const char * hubRelatedPropertyNames_[];
 
-   	//ThreadLock For Serial Function
-	MMThreadLock serialLineMutex_;
 	ControllerStatusMonitorThread* statusMonitorThread_;
-
-   //Current Opened Device Handle
-   FT_HANDLE openHub_;
-   int maxConnRetries_;
+	//Batched Physical Initialization of the Axes, Created in Initialize()
+	PeripheralInitializer* peripheralInitializer_;
+	//Configurations the Initializer Last Applied, Loaded in Initialize()
+	ConfigFingerprintCache configFingerprints_;
+	//This Hub's Span Trace, Set on coreLogSink_ so Spans Under its Scopes Record Here
+	ControllerTrace trace_;
+	CoreControllerLogSink coreLogSink_;
+
+	//Byte Transports Under SerialCommunicate(), Only Changed While Holding serialLineMutex_
+	SerialTransport* ActiveTransport( void );
+	FTDISerialTransport ftdiTransport_;
+	ReplaySerialTransport replayTransport_;
+	CapturingSerialTransport captureTransport_;
+	bool replayActive_;
+	SimulatedCRKTransport simulatedTransport_;
+	bool simulationActive_;
+
+	//Report of the Last Protocol Benchmark Run
+	std::string protocolBenchmarkReport_;
+
+	//Controllers of the Axes on This Bus and the Focus Device Owning Each (See RegisterAxis())
+	MMThreadLock axesLock_;
+	std::vector< AbstractControllerInterface* > axes_;
+	std::vector< OrientalMotorFocus* > axisOwners_;
+
+	/* Run a Synchronized Move From a "address:steps[,address:steps...]" Request
+	*   Returns - 0 if every axis settled, DEVICE_INVALID_PROPERTY_VALUE for a bad request, otherwise the first axis error
+	*/
+	int RunSynchronizedMove( const std::string& request );
+
+	//Report of the Last Synchronized Move
+	std::string synchronizedMoveReport_;
+
+   //Current Opened Device (Only Reopened When the Selected Serial Number Changes)
+   FTDIConnectionManager connection_;
+
+   //Longest the Constructor or a Rescan Waits For Enumeration (Later Results Are Listed on the Next Hub Property Read)
+   static const long enumerationWaitMS_ = 2000;
+   FTDIDeviceEnumerator deviceEnumerator_;
+   //Enumeration Generation curAvailDevMap_ Was Built From
+   unsigned long listedGeneration_;
 
    std::vector<std::string> peripherals_;
    //static MMThreadLock lock_;
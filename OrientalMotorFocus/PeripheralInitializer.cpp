@@ -0,0 +1,310 @@
+#include "PeripheralInitializer.h"
+#include "OrientalControllerTemplate.h"
+#include "ControllerLog.h"
+#include "ConfigFingerprintCache.h"
+#include "AlternativeUtils.h"
+#include <stdio.h>
+
+PeripheralInitializer::PeripheralInitializer( ControllerLogSink* logSink, ConfigFingerprintCache* fingerprints, const std::string& bus ):
+	logSink_(logSink),
+	fingerprints_( ( bus.empty() ) ? nullptr : fingerprints ),
+	bus_(bus),
+	stop_(false),
+	lastEnqueueMs_(0)
+{ }
+
+PeripheralInitializer::~PeripheralInitializer()
+{ }
+
+int PeripheralInitializer::svc( void ) {
+
+	ControllerLogScope logScope( logSink_ );
+
+	while( stop_ == false )
+	{
+		bool ready = false;
+		{
+			MMThreadGuard guard( lock_ );
+			if( CAlternativeUtils::GetMonotonicTimeMs() - lastEnqueueMs_ >= batchWindowMS_ )
+			{
+				for( size_t i = 0; i < axes_.size() && ready == false; i++ )
+				{
+					ready = ( axes_[i].started == false );
+				}
+			}
+		}
+
+		if( ready )
+		{
+			RunBatch();
+		}
+		else
+		{
+			CAlternativeUtils::SleepMs( 1 );
+		}
+	}
+
+	return 0;
+
+}
+
+/* Queue controller For Physical Initialization
+*   Note:  An axis whose batch is running keeps that batch's result
+*/
+void PeripheralInitializer::Enqueue( AbstractControllerInterface* controller ) {
+
+	MMThreadGuard guard( lock_ );
+	double nowMs = CAlternativeUtils::GetMonotonicTimeMs();
+	lastEnqueueMs_ = nowMs;
+
+	size_t i = 0;
+	for( ; i < axes_.size() && axes_[i].controller != controller; i++ );
+
+	if( i == axes_.size() )
+	{
+		PeripheralInitResult entry;
+		entry.controller = controller;
+		axes_.push_back( entry );
+	}
+	else if( axes_[i].started && axes_[i].done == false )
+	{
+		return;
+	}
+
+	PeripheralInitResult& entry = axes_[i];
+	entry.address = 0;
+	controller->GetAddress( entry.address );
+	entry.started = false;
+	entry.done = false;
+	entry.errCode = 0;
+	entry.enqueuedMs = nowMs;
+	entry.elapsedMs = 0;
+	entry.configAction = PeripheralConfigNone;
+	entry.configChanged = false;
+
+}
+
+/* Wait For the Result of controller's Initialization
+*   Note:  Polls at the 1 ms sleep resolution, the same as the batch thread
+*   Returns - true if the result is in errCode, false if controller is not queued or the wait timed out
+*/
+bool PeripheralInitializer::WaitForAxis( AbstractControllerInterface* controller, int& errCode, long timeoutMS ) {
+
+	double startMs = CAlternativeUtils::GetMonotonicTimeMs();
+
+	while( true )
+	{
+		{
+			MMThreadGuard guard( lock_ );
+			size_t i = 0;
+			for( ; i < axes_.size() && axes_[i].controller != controller; i++ );
+
+			if( i == axes_.size() )
+			{
+				return false;
+			}
+			if( axes_[i].done )
+			{
+				errCode = axes_[i].errCode;
+				return true;
+			}
+		}
+
+		if( CAlternativeUtils::GetMonotonicTimeMs() - startMs > timeoutMS )
+		{
+			return false;
+		}
+		CAlternativeUtils::SleepMs( 1 );
+	}
+
+}
+
+/* Forget controller, Waiting Out a Batch That Uses it
+*   Note:  Call before deleting the controller
+*/
+void PeripheralInitializer::Remove( AbstractControllerInterface* controller ) {
+
+	MMThreadGuard batchGuard( batchLock_ );
+	MMThreadGuard guard( lock_ );
+
+	for( std::vector< PeripheralInitResult >::iterator it = axes_.begin(); it != axes_.end(); ++it )
+	{
+		if( it->controller == controller )
+		{
+			axes_.erase( it );
+			return;
+		}
+	}
+
+}
+
+/* Initialize Every Queued Axis That Has Not Started
+*   Note:  A warm start (every axis already configured) costs one configuration read per axis and no writes
+*   Note:  With more than one axis needing writes, the configuration is broadcast once instead of written per axis
+*          (4 unanswered frames in place of up to 4 round trips per axis); it reaches configured slaves too, without changing them
+*   Note:  Broadcasts are never answered, so each axis reads its configuration back before it counts as broadcast (and is cached);
+*          one still differing gets the addressed writes
+*   Note:  A broadcast reaches every slave on the line, including any no focus device manages:  those are switched to RS-485 inputs
+*          with counterclockwise rotation too
+*/
+void PeripheralInitializer::RunBatch( void ) {
+
+	MMThreadGuard batchGuard( batchLock_ );
+	std::vector< AbstractControllerInterface* > batch;
+	std::vector< unsigned int > addresses;
+
+	{
+		MMThreadGuard guard( lock_ );
+		for( size_t i = 0; i < axes_.size(); i++ )
+		{
+			if( axes_[i].started == false )
+			{
+				axes_[i].started = true;
+				batch.push_back( axes_[i].controller );
+				addresses.push_back( axes_[i].address );
+			}
+		}
+	}
+
+	if( batch.empty() )
+	{
+		return;
+	}
+
+	std::vector< int > errCodes( batch.size(), 0 );
+	std::vector< PeripheralConfigAction > actions( batch.size(), PeripheralConfigNone );
+	std::vector< bool > changed( batch.size(), false );
+	AbstractControllerInterface* broadcaster = nullptr;
+	size_t numUnapplied = 0;
+
+	for( size_t i = 0; i < batch.size(); i++ )
+	{
+		uint32_t fingerprint;
+		uint32_t cached;
+		bool applied;
+
+		if( ( errCodes[i] = batch[i]->ReadConfiguration( fingerprint, applied ) ) != 0 )
+		{
+			continue;
+		}
+
+		if( fingerprints_ != nullptr && fingerprints_->Get( bus_, addresses[i], cached ) && cached != fingerprint )
+		{
+			ORIENTAL_LOG_WARN( "Axis {} Configuration Changed Since the Adapter Last Set it (Fingerprint {x}, Cached {x})", addresses[i], fingerprint, cached );
+			changed[i] = true;
+		}
+
+		if( applied )
+		{
+			actions[i] = PeripheralConfigAlreadyApplied;
+		}
+		else
+		{
+			numUnapplied++;
+			if( broadcaster == nullptr )
+			{
+				broadcaster = batch[i];
+			}
+		}
+	}
+
+	if( numUnapplied > 1 )
+	{
+		int ret = broadcaster->BroadcastCommonConfiguration();
+		if( ret == 0 )
+		{
+			for( size_t i = 0; i < batch.size(); i++ )
+			{
+				uint32_t fingerprint;
+				bool applied;
+
+				if( errCodes[i] != 0 || actions[i] != PeripheralConfigNone )
+				{
+					continue;
+				}
+
+				//A Failed Read Leaves Every Value to Be Written Below
+				if( batch[i]->ReadConfiguration( fingerprint, applied ) == 0 && applied )
+				{
+					actions[i] = PeripheralConfigBroadcast;
+				}
+				else
+				{
+					ORIENTAL_LOG_WARN( "Axis {} Did Not Take the Broadcast Configuration, Writing it Directly", (unsigned int) addresses[i] );
+				}
+			}
+		}
+		else
+		{
+			ORIENTAL_LOG_WARN( "Broadcast Configuration Failed With {}, Writing Axes One at a Time", ret );
+		}
+	}
+
+	for( size_t i = 0; i < batch.size(); i++ )
+	{
+		//Axes That Did Not Answer the Read Keep That Error
+		if( errCodes[i] == 0 && actions[i] == PeripheralConfigNone )
+		{
+			if( ( errCodes[i] = batch[i]->WriteConfigurationDifferences() ) == 0 )
+			{
+				actions[i] = PeripheralConfigWritten;
+			}
+		}
+
+		if( errCodes[i] == 0 && fingerprints_ != nullptr )
+		{
+			fingerprints_->Set( bus_, addresses[i], batch[i]->GetConfigurationFingerprint() );
+		}
+	}
+
+	if( fingerprints_ != nullptr )
+	{
+		fingerprints_->Save();
+	}
+
+	MMThreadGuard guard( lock_ );
+	double nowMs = CAlternativeUtils::GetMonotonicTimeMs();
+	for( size_t b = 0; b < batch.size(); b++ )
+	{
+		for( size_t i = 0; i < axes_.size(); i++ )
+		{
+			if( axes_[i].controller == batch[b] )
+			{
+				axes_[i].done = true;
+				axes_[i].errCode = errCodes[b];
+				axes_[i].elapsedMs = nowMs - axes_[i].enqueuedMs;
+				axes_[i].configAction = actions[b];
+				axes_[i].configChanged = changed[b];
+				ORIENTAL_LOG_DEBUG( "Axis {} Initialized With {} After {} ms", (unsigned int) axes_[i].address, errCodes[b], axes_[i].elapsedMs );
+				break;
+			}
+		}
+	}
+
+}
+
+//One Line Per Axis For the Log and the Hub's Report Property
+std::string PeripheralInitializer::Report( void ) {
+
+	MMThreadGuard guard( lock_ );
+	static const char* const actionNames[] = { "", ", Configuration Already Applied", ", Configuration Written", ", Configuration Broadcast" };
+	std::string report;
+	char line[160];
+
+	for( size_t i = 0; i < axes_.size(); i++ )
+	{
+		const PeripheralInitResult& r = axes_[i];
+		if( r.done == false )
+		{
+			sprintf( line, "Address %u: %s\n", (unsigned int) r.address, ( r.started ) ? "Running" : "Queued" );
+		}
+		else
+		{
+			sprintf( line, "Address %u: errCode %d in %.1f ms%s%s\n", (unsigned int) r.address, r.errCode, r.elapsedMs, actionNames[ r.configAction ],
+						( r.configChanged ) ? " (Changed Outside the Adapter)" : "" );
+		}
+		report += line;
+	}
+
+	return report;
+}
@@ -0,0 +1,117 @@
+#ifndef _PERIPHERAL_INITIALIZER_
+#define _PERIPHERAL_INITIALIZER_
+
+#include "OrientalCoreDefs.h"
+#include <string>
+#include <vector>
+#include <assert.h>
+#include <boost/atomic.hpp>
+
+//Forward Declarations
+class AbstractControllerInterface;
+class ControllerLogSink;
+class ConfigFingerprintCache;
+
+//How an Axis Got its Configuration
+enum PeripheralConfigAction
+{
+	PeripheralConfigNone = 0,			//Not Reached (the Configuration Read Failed)
+	PeripheralConfigAlreadyApplied,		//One Read, Nothing Written
+	PeripheralConfigWritten,			//Differences Written to the Axis
+	PeripheralConfigBroadcast			//Applied by the Batch's Broadcast Frames (Confirmed by Reading it Back)
+};
+
+/*  Physical Initialization State of One Queued Axis
+*     elapsedMs is From Enqueue() to the Result
+*/
+struct PeripheralInitResult
+{
+	AbstractControllerInterface* controller;
+	unsigned char address;
+	bool started;
+	bool done;
+	int errCode;
+	double enqueuedMs;
+	double elapsedMs;
+	PeripheralConfigAction configAction;
+	bool configChanged;			//Read Configuration Differed From the Cached Fingerprint (Changed Outside the Adapter)
+};
+
+/*
+*  Runs the Physical Initialization of Every Axis on One Hub's Bus Off the Device Initialize() Calls
+*     Axes Queued Within batchWindowMS_ of Each Other Form a Batch:  Each Gets One Configuration Read (Which Also Verifies the Connection),
+*     Axes Already Configured Are Done; if More Than One Axis Needs Writes, the Configuration is Broadcast Once
+*     (AbstractControllerInterface::BroadcastCommonConfiguration()), Otherwise the Differences Are Written Per Axis
+*     A Broadcast is Read Back From Each Axis, and Any Axis it Missed Gets the Per-Axis Writes
+*     Note:  Broadcasts Also Reconfigure Slaves on the Line That No Focus Device Manages (RS-485 Inputs, Counterclockwise Rotation)
+*     Fingerprints of the Applied Configurations Are Persisted Per Bus and Address (See ConfigFingerprintCache)
+*     Note:  One Bus Carries One Request at a Time, so Batching Only Removes Round Trips; Each Hub Has its Own Thread, so Buses Run in Parallel
+*/
+class PeripheralInitializer: public MMDeviceThreadBase
+{
+	public:
+		//Quiet Time After the Last Enqueue() Before a Batch Starts (Devices Are Initialized One After Another)
+		static const long batchWindowMS_ = 20;
+		//Wait Long Enough For a Batch Where Every Axis Times Out
+		static const long defaultWaitMS_ = 10000;
+
+		/*
+		*   @param fingerprints - cache of applied configurations, or nullptr
+		*   @param bus - serial number of this bus in fingerprints ("" disables the cache)
+		*/
+		PeripheralInitializer( ControllerLogSink* logSink = nullptr, ConfigFingerprintCache* fingerprints = nullptr, const std::string& bus = "" );
+		~PeripheralInitializer();
+
+		/* Batching Loop, Runs Until Stop() is Called
+		*    Returns - 0 on completion
+		*/
+		int svc( void );
+
+		int open (void*) { return 0;}
+		int close(unsigned long) {return 0;}
+
+		//Used to Start the Thread Loop
+		void Start() { stop_ = false; activate(); }
+		//Used to Stop the Thread Loop (Follow With wait() Before Deleting), Axes Not Yet Started Stay Queued
+		void Stop() { stop_ = true; }
+
+		/* Queue controller For Physical Initialization (Re-Queuing Starts it Over)
+		*   @param controller - must stay valid until Remove() returns
+		*/
+		void Enqueue( AbstractControllerInterface* controller );
+
+		/* Wait For the Result of controller's Initialization
+		*   @param errCode - set to the InitializePhysicalController() style result
+		*   @param timeoutMS - longest to wait
+		*   Returns - true if the result is in errCode, false if controller is not queued or the wait timed out
+		*/
+		bool WaitForAxis( AbstractControllerInterface* controller, int& errCode, long timeoutMS );
+
+		/* Forget controller, Waiting Out a Batch That Uses it
+		*   Note:  Call before deleting the controller
+		*/
+		void Remove( AbstractControllerInterface* controller );
+
+		//One Line Per Axis For the Log and the Hub's Report Property
+		std::string Report( void );
+
+	private:
+
+		//Initialize Every Queued Axis That Has Not Started (Holds batchLock_)
+		void RunBatch( void );
+
+		ControllerLogSink* logSink_;
+		ConfigFingerprintCache* fingerprints_;
+		std::string bus_;
+		boost::atomic<bool> stop_;
+
+		//Order is batchLock_ Then lock_; lock_ is Never Held While the Bus is Used
+		MMThreadLock batchLock_;
+		MMThreadLock lock_;
+		std::vector< PeripheralInitResult > axes_;
+		double lastEnqueueMs_;
+
+		PeripheralInitializer& operator=(PeripheralInitializer& ) {assert(false); return *this;}
+};
+
+#endif
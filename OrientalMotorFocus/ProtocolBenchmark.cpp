@@ -0,0 +1,420 @@
+#include "ProtocolBenchmark.h"
+#include "OrientalCRK525PMAKD.h"
+#include "AlternativeUtils.h"
+#include "ControllerLog.h"
+#include "ReadWritePolicies.h"
+#include "AllocationCounter.h"
+#include "SerialControllerBus.h"
+#include <stdio.h>
+
+//Slave Address of the Scratch Controller
+static const uint8_t g_BenchmarkSlaveAddress = 1;
+//Register Block Parsed by OpParseRead (Same Span the Status Monitor Polls)
+static const uint16_t g_BenchmarkReadStart = 0x118;
+static const uint16_t g_BenchmarkReadNumRegs = 16;
+
+ProtocolBenchmark::ProtocolBenchmark( void ) :
+	controller_(nullptr),
+	transportBus_(nullptr),
+	transportController_(nullptr),
+	txLen_(0),
+	rxLen_(0),
+	sink_(0)
+{
+	controller_ = new OrientalCRK525MAKD( &bus_, &ControllerBus::SerialCommunicate );
+	controller_->setAddress( g_BenchmarkSlaveAddress );
+}
+
+ProtocolBenchmark::~ProtocolBenchmark()
+{
+	SetTransport( nullptr );
+	delete controller_;
+}
+
+/* Also Time Full Transactions Through a SerialControllerBus on transport
+*   @param transport - simulated, capturing or replaying transport (must outlive the benchmark), nullptr for none
+*/
+void ProtocolBenchmark::SetTransport( SerialTransport* transport )
+{
+	delete transportController_;
+	delete transportBus_;
+	transportController_ = nullptr;
+	transportBus_ = nullptr;
+
+	if( transport != nullptr )
+	{
+		transportBus_ = new SerialControllerBus( transport );
+		transportController_ = new OrientalCRK525MAKD( transportBus_, &ControllerBus::SerialCommunicate );
+		transportController_->setAddress( g_BenchmarkSlaveAddress );
+	}
+}
+
+/* Time Every Operation
+*   @param iterations - operations per measurement
+*   Returns - 0 if all operations ran, otherwise the first non-zero return of an operation
+*/
+int ProtocolBenchmark::Run( unsigned long iterations )
+{
+	int errCode = 0;
+	int ret;
+
+	results_.clear();
+
+	//Each Entry Times One Operation, Listed in Frame Order (Checksum, Serialize, Register, Frame, Parse, Transaction)
+	struct { const char* name; BenchmarkOp op; bool allocationFree; } ops[] = {
+		{ "crcCompute 6 Byte Request", &ProtocolBenchmark::OpCrcRequest, true },
+		{ "crcCompute 35 Byte Response", &ProtocolBenchmark::OpCrcResponse, true },
+		{ "ReadWrite<int32_t, BigEndian> read+write", &ProtocolBenchmark::OpReadWriteBigEndian32, true },
+		{ "ReadWrite<uint16_t, LittleEndian> read+write", &ProtocolBenchmark::OpReadWriteLittleEndian16, true },
+		{ "GenericRegister::write int32", &ProtocolBenchmark::OpRegisterWrite, true },
+		{ "GenericRegister::testSerialDataConformance int32", &ProtocolBenchmark::OpRegisterConformance, true },
+		{ "GetRegisterByAddress Hit", &ProtocolBenchmark::OpRegisterLookupHit, true },
+		{ "GetRegisterByAddress Miss", &ProtocolBenchmark::OpRegisterLookupMiss, true },
+		{ "serialWriteSingleRegister Frame", &ProtocolBenchmark::OpBuildSingleWrite, true },
+		{ "ReadRegisters Frame", &ProtocolBenchmark::OpBuildRead, true },
+		{ "Fixed Status Poll Frame", &ProtocolBenchmark::OpFixedStatusPoll, true },
+		{ "serialWriteMultiRegister Frame", &ProtocolBenchmark::OpBuildMultiWrite, true },
+		{ "parseData Single Write Response", &ProtocolBenchmark::OpParseSingleWrite, true },
+		{ "parseData Multi Write Response", &ProtocolBenchmark::OpParseMultiWrite, true },
+		{ "parseData 16 Register Read Response", &ProtocolBenchmark::OpParseRead, true },
+		{ "WritePosBuffer Transaction (3 Frames)", &ProtocolBenchmark::OpWritePosTransaction, true },
+		{ "ReadRegisters 16 Register Transaction", &ProtocolBenchmark::OpReadTransaction, true },
+		//Only With a Transport (SetTransport())
+		{ "WritePosBuffer Over SerialControllerBus", &ProtocolBenchmark::OpWritePosOverTransport, true },
+		{ "Fixed Status Poll Over SerialControllerBus", &ProtocolBenchmark::OpStatusPollOverTransport, true }
+	};
+
+	for( size_t i = 0; i < sizeof( ops )/sizeof( ops[0] ); i++ )
+	{
+		if( transportController_ == nullptr && ( ops[i].op == &ProtocolBenchmark::OpWritePosOverTransport || ops[i].op == &ProtocolBenchmark::OpStatusPollOverTransport ) )
+		{
+			continue;
+		}
+
+		ret = Measure( ops[i].name, ops[i].op, iterations, ops[i].allocationFree );
+		if( ret != 0 && errCode == 0 )
+		{
+			errCode = ret;
+		}
+	}
+
+	//Steady State Transactions Must Not Touch the Heap
+	for( size_t i = 0; i < results_.size(); i++ )
+	{
+		if( results_[i].allocationFree && results_[i].allocsPerOp > 0 )
+		{
+			ORIENTAL_LOG_ERROR( "Benchmark {} Allocated {} Times Per Operation", results_[i].name, results_[i].allocsPerOp );
+			if( errCode == 0 )
+			{
+				errCode = 1;
+			}
+		}
+	}
+
+	return errCode;
+}
+
+//One Line Per Operation:  "<name>: <ns>/op <allocs> allocs/op"
+std::string ProtocolBenchmark::Report( void ) const
+{
+	std::string report;
+	char line[160];
+
+	for( size_t i = 0; i < results_.size(); i++ )
+	{
+		if( results_[i].allocsPerOp < 0 )
+		{
+			sprintf( line, "%s: %.1f ns/op n/a allocs/op\n", results_[i].name.c_str(), results_[i].nsPerOp );
+		}
+		else
+		{
+			sprintf( line, "%s: %.1f ns/op %.2f allocs/op%s\n", results_[i].name.c_str(), results_[i].nsPerOp, results_[i].allocsPerOp,
+						( results_[i].allocationFree && results_[i].allocsPerOp > 0 ) ? " (FAIL: must not allocate)" : "" );
+		}
+		report += line;
+	}
+
+	return report;
+}
+
+/* Time iterations Calls of op and Append the Result
+*   Note:  One untimed call first, so lazily built state is not charged to the measurement
+*   @param allocationFree - the op must not allocate (checked by Run() in counting builds)
+*   Returns - 0, or the first non-zero return of op (the result is still recorded)
+*/
+int ProtocolBenchmark::Measure( const char* name, BenchmarkOp op, unsigned long iterations, bool allocationFree )
+{
+	int errCode = (this->*op)();
+	int ret;
+
+	if( iterations == 0 )
+	{
+		iterations = 1;
+	}
+
+	unsigned long startAllocs = AllocationCounter::GetCount();
+	double startMs = CAlternativeUtils::GetMonotonicTimeMs();
+	for( unsigned long i = 0; i < iterations; i++ )
+	{
+		ret = (this->*op)();
+		if( ret != 0 && errCode == 0 )
+		{
+			errCode = ret;
+		}
+	}
+	double elapsedMs = CAlternativeUtils::GetMonotonicTimeMs() - startMs;
+	unsigned long allocs = AllocationCounter::GetCount() - startAllocs;
+
+	ProtocolBenchmarkResult result;
+	result.name = name;
+	result.nsPerOp = elapsedMs * 1000000.0 / iterations;
+	result.allocationFree = allocationFree;
+	result.allocsPerOp = ( AllocationCounter::IsCounting() ) ? static_cast< double >( allocs ) / iterations : -1;
+	results_.push_back( result );
+
+	if( errCode != 0 )
+	{
+		ORIENTAL_LOG_WARN( "Benchmark {} Returned {}", name, errCode );
+	}
+
+	return errCode;
+}
+
+/*
+*
+*  Operations
+*
+*/
+
+int ProtocolBenchmark::OpCrcRequest( void )
+{
+	static const unsigned char request[] = { 0x01, 0x06, 0x00, 0x1E, 0x20, 0x00 };
+	sink_ = controller_->crcCompute( request, sizeof( request ) );
+	return 0;
+}
+
+int ProtocolBenchmark::OpCrcResponse( void )
+{
+	unsigned char response[ 3 + 2*g_BenchmarkReadNumRegs ] = { 0x01, 0x03, 2*g_BenchmarkReadNumRegs };
+	sink_ = controller_->crcCompute( response, sizeof( response ) );
+	return 0;
+}
+
+int ProtocolBenchmark::OpReadWriteBigEndian32( void )
+{
+	unsigned char buffer[ sizeof( int32_t ) ];
+	int32_t in = static_cast< int32_t >( sink_ ) - 8388608;
+	int32_t out;
+
+	ReadWrite< int32_t, true >::read( buffer, sizeof( buffer ), in );
+	ReadWrite< int32_t, true >::write( buffer, sizeof( buffer ), out );
+	sink_ = static_cast< uint32_t >( out );
+	return 0;
+}
+
+int ProtocolBenchmark::OpReadWriteLittleEndian16( void )
+{
+	unsigned char buffer[ sizeof( uint16_t ) ];
+	uint16_t in = static_cast< uint16_t >( sink_ + 1 );
+	uint16_t out;
+
+	ReadWrite< uint16_t, false >::read( buffer, sizeof( buffer ), in );
+	ReadWrite< uint16_t, false >::write( buffer, sizeof( buffer ), out );
+	sink_ = out;
+	return 0;
+}
+
+int ProtocolBenchmark::OpRegisterWrite( void )
+{
+	static const unsigned char value[] = { 0x00, 0x01, 0x86, 0xA0 };
+	sink_ = controller_->posReg.write( value, sizeof( value ) );
+	return 0;
+}
+
+int ProtocolBenchmark::OpRegisterConformance( void )
+{
+	unsigned char value[] = { 0x00, 0x01, 0x86, 0xA0 };
+	sink_ = controller_->posReg.testSerialDataConformance( value, sizeof( value ) );
+	return 0;
+}
+
+int ProtocolBenchmark::OpRegisterLookupHit( void )
+{
+	AbstractRegisterBase* reg = controller_->GetRegisterByAddress( 0x126 );
+	sink_ = ( reg != nullptr ) ? 1 : 0;
+	return ( reg != nullptr ) ? 0 : 1;
+}
+
+int ProtocolBenchmark::OpRegisterLookupMiss( void )
+{
+	AbstractRegisterBase* reg = controller_->GetRegisterByAddress( 0x0FFF );
+	sink_ = ( reg != nullptr ) ? 1 : 0;
+	return ( reg == nullptr ) ? 0 : 1;
+}
+
+int ProtocolBenchmark::OpBuildSingleWrite( void )
+{
+	return controller_->serialWriteSingleRegister( controller_->cmd1Reg, static_cast< uint16_t >( 0 ) );
+}
+
+int ProtocolBenchmark::OpBuildRead( void )
+{
+	return controller_->ReadRegisters( &controller_->CommandPosReg, g_BenchmarkReadNumRegs );
+}
+
+//Same Request as OpBuildRead, Copied From the Prebuilt Frame
+int ProtocolBenchmark::OpFixedStatusPoll( void )
+{
+	return controller_->SendFixedFrame( OrientalCRK525MAKD::FrameMonitorBlockRead );
+}
+
+int ProtocolBenchmark::OpBuildMultiWrite( void )
+{
+	unsigned char value[ sizeof( int32_t ) ];
+	int32_t pos = 100000;
+
+	ReadWrite< int32_t, true >::read( value, sizeof( value ), pos );
+	return controller_->serialWriteMultiRegister( controller_->posReg, sizeof( int32_t )/OrientalCRK525MAKD::baseRegisterByteSize_, value, sizeof( value ) );
+}
+
+int ProtocolBenchmark::OpParseSingleWrite( void )
+{
+	//Write Responses Echo the Request
+	static const unsigned char request[] = { g_BenchmarkSlaveAddress, 0x06, 0x00, 0x1E, 0x00, 0x00 };
+
+	if( txLen_ == 0 || txBuffer_[1] != 0x06 )
+	{
+		memcpy( txBuffer_, request, sizeof( request ) );
+		txLen_ = sizeof( request ) + controller_->appendCRCCheckValue( txBuffer_, sizeof( txBuffer_ ), sizeof( request ) );
+		BuildResponse( request, sizeof( request ) );
+	}
+
+	return controller_->parseData( txBuffer_, txLen_, rxBuffer_, rxLen_ );
+}
+
+int ProtocolBenchmark::OpParseMultiWrite( void )
+{
+	static const unsigned char request[] = { g_BenchmarkSlaveAddress, 0x10, 0x00, 0x1C, 0x00, 0x02, 0x04, 0x00, 0x01, 0x86, 0xA0 };
+
+	if( txLen_ == 0 || txBuffer_[1] != 0x10 )
+	{
+		memcpy( txBuffer_, request, sizeof( request ) );
+		txLen_ = sizeof( request ) + controller_->appendCRCCheckValue( txBuffer_, sizeof( txBuffer_ ), sizeof( request ) );
+		//Response is the Request Header Without the Values
+		BuildResponse( request, 6 );
+	}
+
+	return controller_->parseData( txBuffer_, txLen_, rxBuffer_, rxLen_ );
+}
+
+int ProtocolBenchmark::OpParseRead( void )
+{
+	if( txLen_ == 0 || txBuffer_[1] != 0x03 )
+	{
+		unsigned char request[] = { g_BenchmarkSlaveAddress, 0x03, 0x00, 0x00, 0x00, 0x00 };
+		ReadWrite< uint16_t, true >::read( &request[2], sizeof( uint16_t ), g_BenchmarkReadStart );
+		ReadWrite< uint16_t, true >::read( &request[4], sizeof( uint16_t ), g_BenchmarkReadNumRegs );
+		memcpy( txBuffer_, request, sizeof( request ) );
+		txLen_ = sizeof( request ) + controller_->appendCRCCheckValue( txBuffer_, sizeof( txBuffer_ ), sizeof( request ) );
+
+		//All Zero Register Data is Accepted by Every Register in the Block
+		unsigned char response[ 3 + 2*g_BenchmarkReadNumRegs ] = { g_BenchmarkSlaveAddress, 0x03, 2*g_BenchmarkReadNumRegs };
+		BuildResponse( response, sizeof( response ) );
+	}
+
+	return controller_->parseData( txBuffer_, txLen_, rxBuffer_, rxLen_ );
+}
+
+//Full Position Write (Mode, Position and Start Frames), Each Answered and Parsed
+int ProtocolBenchmark::OpWritePosTransaction( void )
+{
+	unsigned char value[ sizeof( int32_t ) ];
+	int32_t pos = 100000;
+	int errCode;
+
+	ReadWrite< int32_t, true >::read( value, sizeof( value ), pos );
+
+	bus_.SetLoopback( this );
+	errCode = controller_->WritePosBuffer( value, sizeof( value ), true, &ControllerBus::SerialCommunicate );
+	bus_.SetLoopback( nullptr );
+
+	return errCode;
+}
+
+//Monitor Block Read, Answered and Parsed
+int ProtocolBenchmark::OpReadTransaction( void )
+{
+	int errCode;
+
+	bus_.SetLoopback( this );
+	errCode = controller_->ReadRegisters( &controller_->CommandPosReg, g_BenchmarkReadNumRegs );
+	bus_.SetLoopback( nullptr );
+
+	return errCode;
+}
+
+//Full Position Write, Through the Bus and Transport of SetTransport()
+int ProtocolBenchmark::OpWritePosOverTransport( void )
+{
+	unsigned char value[ sizeof( int32_t ) ];
+	int32_t pos = 100000;
+
+	ReadWrite< int32_t, true >::read( value, sizeof( value ), pos );
+	return transportController_->WritePosBuffer( value, sizeof( value ), true, &ControllerBus::SerialCommunicate );
+}
+
+//Prebuilt Monitor Block Read, Through the Bus and Transport of SetTransport()
+int ProtocolBenchmark::OpStatusPollOverTransport( void )
+{
+	return transportController_->SendFixedFrame( OrientalCRK525MAKD::FrameMonitorBlockRead );
+}
+
+/* Answer a Frame as the Slave Would (in loopbackBuffer_) and Parse the Answer, as SerialControllerBus::SerialCommunicate() Does
+*   Note:  Writes are echoed (multi-writes without their values), reads answer all zero registers
+*   Returns - 0, or the parseData() errCode
+*/
+int ProtocolBenchmark::AnswerFrame( const unsigned char txMsgBuffer[], int txMsgLen )
+{
+	int bodyLen;
+
+	if( txMsgLen < 8 )
+	{
+		return 1;
+	}
+
+	switch( txMsgBuffer[1] )
+	{
+		case 0x03:
+			{
+				int numRegs = ( txMsgBuffer[4] << 8 ) | txMsgBuffer[5];
+				bodyLen = 3 + 2*numRegs;
+				if( bodyLen + 2 > static_cast< int >( sizeof( loopbackBuffer_ ) ) )
+				{
+					return 1;
+				}
+				memset( loopbackBuffer_, 0, bodyLen );
+				loopbackBuffer_[0] = txMsgBuffer[0];
+				loopbackBuffer_[1] = txMsgBuffer[1];
+				loopbackBuffer_[2] = static_cast< unsigned char >( 2*numRegs );
+			}
+			break;
+		case 0x10:
+			bodyLen = 6;
+			memcpy( loopbackBuffer_, txMsgBuffer, bodyLen );
+			break;
+		default:
+			bodyLen = txMsgLen - 2;
+			memcpy( loopbackBuffer_, txMsgBuffer, bodyLen );
+			break;
+	}
+
+	int rxLen = bodyLen + controller_->appendCRCCheckValue( loopbackBuffer_, sizeof( loopbackBuffer_ ), bodyLen );
+	return controller_->parseData( txMsgBuffer, txMsgLen, loopbackBuffer_, rxLen );
+}
+
+//Build a Response Frame With its CRC in rxBuffer_
+void ProtocolBenchmark::BuildResponse( const unsigned char body[], int bodyLen )
+{
+	memcpy( rxBuffer_, body, bodyLen );
+	rxLen_ = bodyLen + controller_->appendCRCCheckValue( rxBuffer_, sizeof( rxBuffer_ ), bodyLen );
+}
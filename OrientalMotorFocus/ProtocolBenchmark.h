@@ -0,0 +1,136 @@
+#ifndef _PROTOCOL_BENCHMARK_
+#define _PROTOCOL_BENCHMARK_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "ControllerBus.h"
+
+//Forward Declarations
+class OrientalCRK525MAKD;
+class SerialTransport;
+class SerialControllerBus;
+
+/*  Timing of One Benchmarked Operation
+*     allocsPerOp - heap allocations per operation, or < 0 when this build cannot count them
+*     allocationFree - the operation is on the steady-state transaction path and must not allocate
+*/
+struct ProtocolBenchmarkResult
+{
+	std::string name;
+	double nsPerOp;
+	double allocsPerOp;
+	bool allocationFree;
+};
+
+/*
+*  Per-Frame CPU Cost of the Protocol and Register Layers
+*     Runs Against a Scratch OrientalCRK525MAKD on its Own Bus, so No Hub or Line is Involved
+*     Transaction Operations Loop Frames Back Through parseData() With Synthetic Slave Responses (WritePos to parseData in Full)
+*     With SetTransport(), Full Transactions Are Also Timed Through a SerialControllerBus (Simulated Slaves, or a Capture of Them)
+*     Allocations Are Counted by AllocationCounter, Only in Programs That Link its operator new (the ProtocolBenchmark Tool)
+*     Note:  Frame, Parse and Transaction Operations Must Not Allocate; Run() Fails if One Does (Counting Programs Only)
+*/
+class ProtocolBenchmark
+{
+	public:
+		static const unsigned long defaultIterations_ = 20000;
+
+		ProtocolBenchmark( void );
+		~ProtocolBenchmark();
+
+		/* Time Every Operation
+		*   @param iterations - operations per measurement
+		*   Returns - 0 if all operations ran allocation-free where required, otherwise the first non-zero return of an operation (or 1)
+		*/
+		int Run( unsigned long iterations = defaultIterations_ );
+
+		/* Also Time Full Transactions Through a SerialControllerBus on transport
+		*   @param transport - simulated, capturing or replaying transport (must outlive the benchmark), nullptr for none
+		*/
+		void SetTransport( SerialTransport* transport );
+
+		const std::vector< ProtocolBenchmarkResult >& GetResults( void ) const { return results_; }
+
+		//One Line Per Operation:  "<name>: <ns>/op <allocs> allocs/op"
+		std::string Report( void ) const;
+
+	private:
+
+		typedef int (ProtocolBenchmark::*BenchmarkOp)( void );
+
+		/*  Bus of the Scratch Controller:  Drops Frames, or Hands Them to the Benchmark's AnswerFrame() While Looping Back
+		*/
+		class BenchmarkBus : public NullControllerBus
+		{
+			public:
+				BenchmarkBus() : loopback_(nullptr) {}
+
+				//nullptr Drops Frames Again
+				void SetLoopback( ProtocolBenchmark* loopback ) { loopback_ = loopback; }
+				int SerialCommunicate( unsigned char txMsgBuffer[], int txMsgLen, AbstractControllerInterface* /*controller*/, bool broadcast )
+				{
+					return ( loopback_ != nullptr && broadcast == false ) ? loopback_->AnswerFrame( txMsgBuffer, txMsgLen ) : 0;
+				}
+
+			private:
+				ProtocolBenchmark* loopback_;
+		};
+
+		/* Time iterations Calls of op and Append the Result
+		*   @param allocationFree - the op must not allocate (checked in counting builds)
+		*   Returns - 0, or the first non-zero return of op (the result is still recorded)
+		*/
+		int Measure( const char* name, BenchmarkOp op, unsigned long iterations, bool allocationFree );
+
+		//Operations (Each Returns 0 on Success)
+		int OpCrcRequest( void );
+		int OpCrcResponse( void );
+		int OpReadWriteBigEndian32( void );
+		int OpReadWriteLittleEndian16( void );
+		int OpRegisterWrite( void );
+		int OpRegisterConformance( void );
+		int OpRegisterLookupHit( void );
+		int OpRegisterLookupMiss( void );
+		int OpBuildSingleWrite( void );
+		int OpBuildRead( void );
+		int OpFixedStatusPoll( void );
+		int OpBuildMultiWrite( void );
+		int OpParseSingleWrite( void );
+		int OpParseMultiWrite( void );
+		int OpParseRead( void );
+		int OpWritePosTransaction( void );
+		int OpReadTransaction( void );
+		int OpWritePosOverTransport( void );
+		int OpStatusPollOverTransport( void );
+
+		//Build a Response Frame With its CRC in rxBuffer_
+		void BuildResponse( const unsigned char body[], int bodyLen );
+
+		/* Answer a Frame as the Slave Would (in loopbackBuffer_) and Parse the Answer, as SerialControllerBus::SerialCommunicate() Does
+		*   Returns - 0, or the parseData() errCode
+		*/
+		int AnswerFrame( const unsigned char txMsgBuffer[], int txMsgLen );
+
+		BenchmarkBus bus_;
+		OrientalCRK525MAKD* controller_;
+		//Scratch Controller on the Bus Over the SetTransport() Transport, or nullptr
+		SerialControllerBus* transportBus_;
+		OrientalCRK525MAKD* transportController_;
+		std::vector< ProtocolBenchmarkResult > results_;
+
+		//Synthetic Frames For the Parse Operations
+		unsigned char txBuffer_[ 64 ];
+		int txLen_;
+		unsigned char rxBuffer_[ 64 ];
+		int rxLen_;
+		unsigned char loopbackBuffer_[ 64 ];
+
+		//Operation Results Land Here so They Are Not Optimized Away
+		volatile uint32_t sink_;
+
+		ProtocolBenchmark( const ProtocolBenchmark& );
+		ProtocolBenchmark& operator=( const ProtocolBenchmark& );
+};
+
+#endif
@@ -15,7 +15,7 @@
 
 #include <stdlib.h>
 #include <vector>
-#include "../../MMDevice/DeviceThreads.h"
+#include "OrientalCoreDefs.h"
 
 //Forward Declaration of ResetDependency
 class ResetDependency;
@@ -0,0 +1,197 @@
+#include "SerialControllerBus.h"
+#include "OrientalControllerTemplate.h"
+#include "AlternativeUtils.h"
+#include "ControllerLog.h"
+#include "ControllerTrace.h"
+
+SerialControllerBus::SerialControllerBus( SerialTransport* transport, ControllerLogSink* logSink ) :
+	transport_(transport),
+	logSink_(logSink),
+	serialTransactionsInFlight_(0)
+{ }
+
+int SerialControllerBus::SerialCommunicate( unsigned char txMsgBuffer[], int txMsgLen,  AbstractControllerInterface* controller, bool broadcast )
+{
+
+	BusTransactionOutcome outcome = BusOutcomeOk;
+	ControllerLogScope logScope( GetLogSink() );
+
+	TraceSpan transactionSpan( "SerialCommunicate", g_TraceCategoryBus, "function", ( txMsgLen >= 2 ) ? txMsgBuffer[1] : -1 );
+
+	//Counted Before the Lock So Pollers Also See Transactions Waiting For the Line
+	SerialTransactionCounter inFlight( serialTransactionsInFlight_ );
+	double firstMs = CAlternativeUtils::GetMonotonicTimeMs();
+	int errCode;
+
+	//A Lost or Corrupted Answer to a Request That is Safe to Repeat is Retried (Each Attempt is Recorded);
+	//the Lock is Taken Per Attempt, so a Retry Queues Behind Transactions Already Waiting
+	for( unsigned int attempt = 0; ; attempt++ )
+	{
+		double startMs;
+		double latencyUs;
+		{
+			TraceSpan lockSpan( "Line Wait", g_TraceCategoryBus );
+			MMThreadGuard guard(serialLineMutex_);
+			lockSpan.End();
+
+			//Latency Covers Time on the Line, Not Time Waiting For it
+			outcome = BusOutcomeOk;
+			startMs = CAlternativeUtils::GetMonotonicTimeMs();
+			errCode = SerialTransaction( txMsgBuffer, txMsgLen, controller, broadcast, outcome );
+			latencyUs = ( CAlternativeUtils::GetMonotonicTimeMs() - startMs ) * 1000;
+
+			//A Late Answer Must Not be Taken For the Next Transaction's, Whoever Sends it
+			if( outcome == BusOutcomeTimeout || outcome == BusOutcomeCrcError )
+			{
+				ActiveTransport()->Purge();
+			}
+		}
+
+		if( txMsgLen < 2 )
+		{
+			break;
+		}
+		busStatistics_.Record( txMsgBuffer[0], txMsgBuffer[1], outcome, static_cast< uint32_t >( latencyUs ) );
+
+		if( attempt >= maxIdempotentRetries_ || ( outcome != BusOutcomeTimeout && outcome != BusOutcomeCrcError )
+			|| CAlternativeUtils::GetMonotonicTimeMs() - firstMs > maxRetryWindowMS_ || controller->isIdempotentRequest( txMsgBuffer, txMsgLen ) == false )
+		{
+			break;
+		}
+
+		ORIENTAL_LOG_DEBUG( "Retrying Function {x} to Slave {} After Outcome {}", (unsigned int) txMsgBuffer[1], (unsigned int) txMsgBuffer[0], (int) outcome );
+		busStatistics_.RecordRetry( txMsgBuffer[0], txMsgBuffer[1] );
+	}
+
+	return errCode;
+}
+
+/* One Request/Response Exchange on the Active Transport
+*   Note:  Caller Must Hold serialLineMutex_
+*   @param outcome - set to the BusTransactionOutcome for statistics
+*   Returns - DEVICE_OK, or the errCode SerialCommunicate() reports
+*/
+int SerialControllerBus::SerialTransaction( unsigned char txMsgBuffer[], int txMsgLen,  AbstractControllerInterface* controller, bool broadcast, BusTransactionOutcome& outcome )
+{
+
+	unsigned long bytesWritten;
+
+	SerialTransport* transport = ActiveTransport();
+	if( transport == nullptr )
+	{
+		outcome = BusOutcomeError;
+		return DEVICE_NOT_CONNECTED;
+	}
+
+	/*
+	*  This Set Rate will change to a dynamic value in the another function
+	*/
+	if( transport->Configure( 9600 ) != 0 )
+	{
+		ORIENTAL_LOG_WARN( "Could Not Set Baud Rate and Characteristics" );
+	}
+	
+	TraceSpan writeSpan( "Write", g_TraceCategoryBus, "bytes", txMsgLen );
+	transport->Write( txMsgBuffer, txMsgLen, bytesWritten );
+	writeSpan.End();
+
+	if( bytesWritten != static_cast< unsigned long >( txMsgLen ) )
+	{
+		//error handling internal Write Error
+		outcome = BusOutcomeError;
+		return 1;
+	}
+
+	if( broadcast == true)
+	{
+		//Nothing Answers, so Give Every Slave Time to Act Before the Next Request
+		CAlternativeUtils::SleepMs( broadcastTurnaroundMS_ );
+		return DEVICE_OK;
+	}
+	int headerLen = controller->headerLengthLookup( txMsgBuffer, txMsgLen );
+	//Handle Internal Error
+	if( headerLen <= 0 )
+	{
+		outcome = BusOutcomeError;
+		return DEVICE_ERR;
+	}
+
+	unsigned char rxBuffer[ MM::MaxStrLength ];
+	unsigned long bytesRead;
+	TraceSpan headerSpan( "Header Read", g_TraceCategoryBus, "bytes", headerLen );
+	int readStatus = transport->Read( rxBuffer, headerLen, bytesRead );
+	headerSpan.End();
+	if( readStatus != 0 )
+	{
+		ORIENTAL_LOG_WARN( "Header Read Failed" );
+		outcome = BusOutcomeError;
+		return 1;
+	}
+	else if( bytesRead != static_cast< unsigned long >( headerLen ) )
+	{
+		ORIENTAL_LOG_WARN( "Header Timeout, {} of {} Bytes", bytesRead, headerLen );
+		//Error Report:  TimeOut Without response
+		outcome = BusOutcomeTimeout;
+		return DEVICE_ERR;
+	}
+
+	//Generic Address Check
+	if( controller->sameAddress( rxBuffer, bytesRead ) == false )
+	{
+		//Error Mismatched Slave Address
+		outcome = BusOutcomeError;
+		return DEVICE_ERR;
+	}
+	int dataLen = controller->dataLengthLookup( rxBuffer, bytesRead );
+
+	if( dataLen <= 0 )
+	{
+		//Data Length Lookup Unexpected Header Information
+		outcome = BusOutcomeError;
+		return DEVICE_ERR;
+	}
+
+	TraceSpan dataSpan( "Data Read", g_TraceCategoryBus, "bytes", dataLen );
+	readStatus = transport->Read( &rxBuffer[headerLen], dataLen, bytesRead );
+	dataSpan.End();
+	if( readStatus != 0 )
+	{
+		ORIENTAL_LOG_WARN( "Data Read Failed" );
+		outcome = BusOutcomeError;
+		return 1;
+	}
+	else if( bytesRead != static_cast< unsigned long >( dataLen ) )
+	{
+		ORIENTAL_LOG_WARN( "Data Timeout, {} of {} Bytes", bytesRead, dataLen );
+		//Error Report:  TimeOut Without response
+		outcome = BusOutcomeTimeout;
+		return DEVICE_ERR;
+	}
+
+	//Generic controller 
+	TraceSpan parseSpan( "Parse", g_TraceCategoryBus );
+	int errCode = controller->parseData( txMsgBuffer, txMsgLen, rxBuffer, bytesRead + headerLen );
+	parseSpan.End();
+	if( errCode != DEVICE_OK )
+	{
+		//Error Report: data returns an error
+		ORIENTAL_LOG_DEBUG( "Response Parse Returned {}", errCode );
+		if( controller->isCorruptResponse( rxBuffer, bytesRead + headerLen ) )
+		{
+			outcome = BusOutcomeCrcError;
+		}
+		else if( controller->isExceptionResponse( rxBuffer, bytesRead + headerLen ) )
+		{
+			outcome = BusOutcomeException;
+		}
+		else
+		{
+			outcome = BusOutcomeError;
+		}
+		return errCode;
+	}
+
+	ORIENTAL_LOG_TRACE( "Transaction Complete, {} Bytes Received", bytesRead + headerLen );
+
+	return DEVICE_OK;
+}
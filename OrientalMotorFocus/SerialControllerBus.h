@@ -0,0 +1,95 @@
+#ifndef _SERIAL_CONTROLLER_BUS_
+#define _SERIAL_CONTROLLER_BUS_
+
+#include "OrientalCoreDefs.h"
+#include "ControllerBus.h"
+#include "SerialTransport.h"
+#include "BusStatistics.h"
+#include "TelemetryRecorder.h"
+#include <assert.h>
+#include <boost/atomic.hpp>
+
+/*
+*  ControllerBus Over a SerialTransport:  One Request/Response Exchange at a Time on the Line, Recorded in BusStatistics,
+*     With Idempotent Requests Retried After a Timeout or Corrupt Response
+*     Note:  The Line Lock is Held For One Attempt at a Time, so Other Axes Get the Line Between a Failed Attempt and its Retry
+*     OrientalFTDIHub Derives From it and Picks the Transport (Live, Simulated, Replay or Capture); Tools and Tests Use it Directly
+*     Note:  The Transport Must Only Change While Holding GetLineLock()
+*/
+class SerialControllerBus : public ControllerBus
+{
+	public:
+		//Time the Slaves Get to Apply a Broadcast Before the Line is Used Again (No Response Marks the End)
+		static const long broadcastTurnaroundMS_ = 10;
+
+		//Times a Request the Controller Calls Idempotent is Sent Again After a Timeout or Corrupt Response
+		static const unsigned int maxIdempotentRetries_ = 2;
+		//No Retry Starts Once This Long Has Passed Since the First Attempt (Bounds a Request's Time on the Line With Slow Timeouts)
+		static const long maxRetryWindowMS_ = 2000;
+
+		SerialControllerBus( SerialTransport* transport = nullptr, ControllerLogSink* logSink = nullptr );
+		virtual ~SerialControllerBus() {}
+
+		/* One Request/Response Exchange With controller's Slave, Retried if the Request is Idempotent (Within maxRetryWindowMS_)
+		*   @param txMsgBuffer[] - complete request frame, including the check value
+		*   @param txMsgLen - number of bytes in txMsgBuffer
+		*   @param controller - controller the response is parsed by
+		*   @param broadcast - true if no response is expected
+		*   Returns - 0 (DEVICE_OK) or errCode otherwise
+		*/
+		int SerialCommunicate( unsigned char txMsgBuffer[], int txMsgLen, AbstractControllerInterface* controller, bool broadcast );
+
+		TelemetryRecorder& GetTelemetryRecorder( void ) { return telemetryRecorder_; }
+		ControllerStatusMonitorThread* GetStatusMonitorThread( void ) { return nullptr; }
+		ControllerLogSink* GetLogSink( void ) { return logSink_; }
+
+		//Transport Used When ActiveTransport() is Not Overridden (Hold GetLineLock() While Changing it)
+		void SetTransport( SerialTransport* transport ) { transport_ = transport; }
+
+		/* Non-Blocking Check For Background Pollers (Telemetry) Before Queuing a Transaction
+		*   Returns - true if no transaction is running or waiting on the serial line
+		*/
+		bool IsSerialLineIdle( void ) const { return serialTransactionsInFlight_ == 0; }
+
+		//Held For Every Transaction
+		MMThreadLock& GetLineLock( void ) { return serialLineMutex_; }
+
+		//Lock-Free Per Function Code/Per Slave Transaction Statistics
+		BusStatistics& GetBusStatistics( void ) { return busStatistics_; }
+
+	protected:
+		//Transport the Next Transaction Goes Through, Called Holding serialLineMutex_
+		virtual SerialTransport* ActiveTransport( void ) { return transport_; }
+
+		//ThreadLock For Serial Function
+		MMThreadLock serialLineMutex_;
+		TelemetryRecorder telemetryRecorder_;
+		BusStatistics busStatistics_;
+
+	private:
+		/* One Request/Response Exchange on the Active Transport
+		*   Note:  Caller Must Hold serialLineMutex_
+		*   @param outcome - set to the BusTransactionOutcome for statistics
+		*   Returns - DEVICE_OK, or the errCode SerialCommunicate() reports
+		*/
+		int SerialTransaction( unsigned char txMsgBuffer[], int txMsgLen, AbstractControllerInterface* controller, bool broadcast, BusTransactionOutcome& outcome );
+
+		SerialTransport* transport_;
+		ControllerLogSink* logSink_;
+
+		//Transactions Running or Waiting on serialLineMutex_
+		boost::atomic<int> serialTransactionsInFlight_;
+
+		//Scoped Count of a Transaction in serialTransactionsInFlight_
+		class SerialTransactionCounter
+		{
+			public:
+				SerialTransactionCounter( boost::atomic<int>& count ) : count_(count) { count_++; }
+				~SerialTransactionCounter() { count_--; }
+			private:
+				boost::atomic<int>& count_;
+				SerialTransactionCounter& operator=( SerialTransactionCounter& ) { assert(false); return *this; }
+		};
+};
+
+#endif
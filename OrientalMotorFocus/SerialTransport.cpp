@@ -0,0 +1,696 @@
+#include "SerialTransport.h"
+#include "AlternativeUtils.h"
+#include "MotionPlanner.h"
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <boost/static_assert.hpp>
+
+static const char g_BusCaptureMagic[8] = { 'O', 'M', 'B', 'U', 'S', 'C', 'A', 'P' };
+static const uint32_t g_BusCaptureVersion = 1;
+
+//Layouts Are Part of the File Format
+BOOST_STATIC_ASSERT( sizeof( BusCaptureFileHeader ) == 16 );
+BOOST_STATIC_ASSERT( sizeof( BusCaptureRecordHeader ) == 16 );
+
+/******************************************
+
+ CapturingSerialTransport
+
+ *******************************************/
+
+CapturingSerialTransport::CapturingSerialTransport( SerialTransport* wrapped ) :
+	wrapped_(wrapped),
+	file_(nullptr)
+{ }
+
+CapturingSerialTransport::~CapturingSerialTransport()
+{
+	Close();
+}
+
+/* Start a New Capture File (Overwritten if Present)
+*   Returns - 0 if opened, otherwise non-zero
+*/
+int CapturingSerialTransport::Open( const std::string& path )
+{
+	Close();
+
+	if( path.empty() || ( file_ = fopen( path.c_str(), "wb" ) ) == nullptr )
+	{
+		return 1;
+	}
+
+	BusCaptureFileHeader header;
+	memset( &header, 0, sizeof( header ) );
+	memcpy( header.magic, g_BusCaptureMagic, sizeof( g_BusCaptureMagic ) );
+	header.version = g_BusCaptureVersion;
+	fwrite( &header, sizeof( header ), 1, file_ );
+
+	path_ = path;
+	return 0;
+}
+
+void CapturingSerialTransport::Close( void )
+{
+	if( file_ != nullptr )
+	{
+		fclose( file_ );
+		file_ = nullptr;
+	}
+	path_.clear();
+}
+
+int CapturingSerialTransport::Configure( unsigned long baudRate )
+{
+	return wrapped_->Configure( baudRate );
+}
+
+int CapturingSerialTransport::Write( const unsigned char buffer[], unsigned long len, unsigned long& bytesWritten )
+{
+	int status = wrapped_->Write( buffer, len, bytesWritten );
+	Append( BusCaptureTx, status, buffer, bytesWritten );
+	return status;
+}
+
+int CapturingSerialTransport::Read( unsigned char buffer[], unsigned long len, unsigned long& bytesRead )
+{
+	int status = wrapped_->Read( buffer, len, bytesRead );
+	Append( BusCaptureRx, status, buffer, bytesRead );
+	return status;
+}
+
+void CapturingSerialTransport::Append( uint8_t direction, int status, const unsigned char buffer[], unsigned long len )
+{
+	if( file_ == nullptr )
+	{
+		return;
+	}
+
+	BusCaptureRecordHeader record;
+	record.timeMs = CAlternativeUtils::GetMonotonicTimeMs();
+	record.byteCount = static_cast< uint32_t >( len );
+	record.direction = direction;
+	record.status = ( status == 0 ) ? 0 : 1;
+	record.reserved = 0;
+
+	fwrite( &record, sizeof( record ), 1, file_ );
+	if( len > 0 )
+	{
+		fwrite( buffer, 1, len, file_ );
+	}
+}
+
+/******************************************
+
+ ReplaySerialTransport
+
+ *******************************************/
+
+ReplaySerialTransport::ReplaySerialTransport() :
+	next_(0),
+	originalTiming_(true),
+	replayStartMs_(0),
+	mismatchCount_(0)
+{ }
+
+/* Load a Capture File Into Memory and Rewind
+*   Note:  A truncated final record (capture cut off mid-write) is dropped
+*   Returns - 0 if the file is a valid capture, otherwise non-zero
+*/
+int ReplaySerialTransport::Load( const std::string& path )
+{
+	records_.clear();
+	bytes_.clear();
+	path_.clear();
+
+	FILE* file = fopen( path.c_str(), "rb" );
+	if( file == nullptr )
+	{
+		return 1;
+	}
+
+	BusCaptureFileHeader header;
+	if( fread( &header, sizeof( header ), 1, file ) != 1 || memcmp( header.magic, g_BusCaptureMagic, sizeof( g_BusCaptureMagic ) ) != 0
+			|| header.version != g_BusCaptureVersion )
+	{
+		fclose( file );
+		return 2;
+	}
+
+	ReplayRecord record;
+	while( fread( &record.header, sizeof( record.header ), 1, file ) == 1 )
+	{
+		record.offset = bytes_.size();
+		bytes_.resize( bytes_.size() + record.header.byteCount );
+		if( record.header.byteCount > 0 && fread( &bytes_[ record.offset ], 1, record.header.byteCount, file ) != record.header.byteCount )
+		{
+			bytes_.resize( record.offset );
+			break;
+		}
+		records_.push_back( record );
+	}
+
+	fclose( file );
+
+	path_ = path;
+	Rewind();
+	return 0;
+}
+
+void ReplaySerialTransport::Rewind( void )
+{
+	next_ = 0;
+	mismatchCount_ = 0;
+	replayStartMs_ = CAlternativeUtils::GetMonotonicTimeMs();
+}
+
+/* Advance to the Next Record of direction, Pacing if Requested
+*   Note:  Records of the other direction in between are skipped and counted as mismatches
+*   Returns - the record, or nullptr at the end of the capture
+*/
+const ReplaySerialTransport::ReplayRecord* ReplaySerialTransport::Next( uint8_t direction )
+{
+	while( next_ < records_.size() && records_[ next_ ].header.direction != direction )
+	{
+		mismatchCount_++;
+		next_++;
+	}
+
+	if( next_ >= records_.size() )
+	{
+		return nullptr;
+	}
+
+	const ReplayRecord* record = &records_[ next_++ ];
+
+	if( originalTiming_ )
+	{
+		//Capture Times Are Relative to the First Record, Replay Times to the Last Rewind()
+		double dueMs = replayStartMs_ + ( record->header.timeMs - records_[0].header.timeMs );
+		double waitMs = dueMs - CAlternativeUtils::GetMonotonicTimeMs();
+		if( waitMs >= 1 )
+		{
+			CAlternativeUtils::SleepMs( static_cast< long >( waitMs ) );
+		}
+	}
+
+	return record;
+}
+
+int ReplaySerialTransport::Write( const unsigned char buffer[], unsigned long len, unsigned long& bytesWritten )
+{
+	const ReplayRecord* record = Next( BusCaptureTx );
+
+	bytesWritten = 0;
+	if( record == nullptr )
+	{
+		return 1;
+	}
+
+	//The Controller Code Under Replay Should Send What Was Captured
+	if( record->header.byteCount != len || ( len > 0 && memcmp( &bytes_[ record->offset ], buffer, len ) != 0 ) )
+	{
+		mismatchCount_++;
+	}
+
+	bytesWritten = len;
+	return record->header.status;
+}
+
+int ReplaySerialTransport::Read( unsigned char buffer[], unsigned long len, unsigned long& bytesRead )
+{
+	const ReplayRecord* record = Next( BusCaptureRx );
+
+	bytesRead = 0;
+	if( record == nullptr )
+	{
+		return 1;
+	}
+
+	bytesRead = ( record->header.byteCount < len ) ? record->header.byteCount : len;
+	if( bytesRead > 0 )
+	{
+		memcpy( buffer, &bytes_[ record->offset ], bytesRead );
+	}
+
+	return record->header.status;
+}
+
+/******************************************
+
+ SimulatedCRKTransport
+
+ *******************************************/
+
+//Register Addresses the Simulation Gives Meaning To (See OrientalCRK525MAKD)
+static const uint16_t g_SimPosModeRegister = 0x0015;
+static const uint16_t g_SimPosRegister = 0x001C;
+static const uint16_t g_SimCmd1Register = 0x001E;
+static const uint16_t g_SimCommandPosRegister = 0x0118;
+static const uint16_t g_SimCommandSpeedRegister = 0x011C;
+static const uint16_t g_SimEncoderCounterRegister = 0x011E;
+static const uint16_t g_SimIOStatusRegister = 0x0126;
+static const uint16_t g_SimDecelRateRegister = 0x0016;
+static const uint16_t g_SimAccelRateRegister = 0x0018;
+static const uint16_t g_SimOperatingSpeedRegister = 0x001A;
+static const uint16_t g_SimOperatingCurrentRegister = 0x021E;
+static const uint16_t g_SimCommonAccelRateRegister = 0x0224;
+static const uint16_t g_SimCommonDecelRateRegister = 0x0226;
+static const uint16_t g_SimAccelRateTypeRegister = 0x0236;
+static const uint16_t g_SimJogSpeedRegister = 0x0230;
+static const uint16_t g_SimStepOutActionRegister = 0x025C;
+static const uint16_t g_SimStepOutDetectionRegister = 0x0310;
+static const uint16_t g_SimResetAlarmRegister = 0x0040;
+static const uint16_t g_SimClearWarningRecordsRegister = 0x0042;
+static const uint16_t g_SimPresentAlarmRegister = 0x0100;
+static const uint16_t g_SimPresentWarningRegister = 0x010B;
+
+//Step-Out Actions (0x025C) and the Code Reported For One (Excessive Position Deviation)
+static const uint16_t g_SimStepOutWarning = 1;
+static const uint16_t g_SimStepOutAlarm = 2;
+static const uint16_t g_SimStepOutCode = 0x10;
+
+static const uint16_t g_SimCmd1Start = 0x0100;
+static const uint16_t g_SimCmd1Stop = 0x1000;
+static const uint16_t g_SimCmd1Fwd = 0x0200;
+static const uint16_t g_SimCmd1Rvs = 0x0400;
+//MOVE Output, Bit 24 of the 32 Bit IO Status (Upper Register)
+static const uint16_t g_SimIOStatusMoveHigh = 0x0100;
+
+//Modbus Limits and Exception Codes
+static const uint16_t g_SimMaxReadRegisters = 125;
+static const uint8_t g_SimExceptionBase = 0x80;
+static const uint8_t g_SimIllegalFunction = 0x01;
+static const uint8_t g_SimIllegalDataValue = 0x03;
+
+//Modbus RTU CRC-16 (Polynomial 0xA001, Initial 0xFFFF)
+static uint16_t SimulatedCrc( const unsigned char bytes[], unsigned long numBytes )
+{
+	uint16_t crc = 0xFFFF;
+
+	for( unsigned long i = 0; i < numBytes; i++ )
+	{
+		crc ^= bytes[i];
+		for( int bit = 0; bit < 8; bit++ )
+		{
+			crc = ( crc & 0x0001 ) ? ( ( crc >> 1 ) ^ 0xA001 ) : ( crc >> 1 );
+		}
+	}
+
+	return crc;
+}
+
+//Sleep Whole Milliseconds, Then Spin Out the Remainder
+static void SimulatedWaitUntil( double dueMs )
+{
+	double waitMs;
+	while( ( waitMs = dueMs - CAlternativeUtils::GetMonotonicTimeMs() ) > 0 )
+	{
+		if( waitMs >= 1 )
+		{
+			CAlternativeUtils::SleepMs( static_cast< long >( waitMs ) );
+		}
+	}
+}
+
+SimulatedCRKTransport::SimulatedCRKTransport() :
+	baudRate_(defaultBaudRate_),
+	usbLatencyMs_(defaultUsbLatencyMS_),
+	motorSpeedStepsPerSec_(defaultMotorSpeedStepsPerSec_),
+	responseRead_(0),
+	responseReadyMs_(0)
+{ }
+
+void SimulatedCRKTransport::Reset( void )
+{
+	slaves_.clear();
+	response_.clear();
+	responseRead_ = 0;
+}
+
+/* Accept a Request Once it Would Have Crossed the USB Link and the Wire
+*   Note:  Any unread response to the previous request is discarded, as a real slave's would be by the next request
+*/
+int SimulatedCRKTransport::Write( const unsigned char buffer[], unsigned long len, unsigned long& bytesWritten )
+{
+	double requestEndMs = CAlternativeUtils::GetMonotonicTimeMs() + usbLatencyMs_ + WireTimeMs( len );
+
+	response_.clear();
+	responseRead_ = 0;
+
+	SimulatedWaitUntil( requestEndMs );
+	bytesWritten = len;
+
+	Respond( buffer, len, requestEndMs );
+
+	return 0;
+}
+
+/* Return Response Bytes Once They Would Have Arrived
+*   Note:  With nothing queued (broadcast, corrupt request) returns 0 bytes at once rather than waiting out a read timeout
+*/
+int SimulatedCRKTransport::Read( unsigned char buffer[], unsigned long len, unsigned long& bytesRead )
+{
+	bytesRead = 0;
+
+	if( responseRead_ >= response_.size() )
+	{
+		return 0;
+	}
+
+	SimulatedWaitUntil( responseReadyMs_ + usbLatencyMs_ );
+
+	unsigned long remaining = static_cast< unsigned long >( response_.size() - responseRead_ );
+	bytesRead = ( remaining < len ) ? remaining : len;
+	memcpy( buffer, &response_[ responseRead_ ], bytesRead );
+	responseRead_ += bytesRead;
+
+	return 0;
+}
+
+/* Apply a Request and Queue its Response
+*   Note:  Requests failing their CRC are ignored like a real slave ignores them; broadcasts (address 0) are applied to every known slave
+*/
+void SimulatedCRKTransport::Respond( const unsigned char request[], unsigned long len, double nowMs )
+{
+	if( len < 4 || SimulatedCrc( request, len - 2 ) != static_cast< uint16_t >( request[ len - 2 ] | ( request[ len - 1 ] << 8 ) ) )
+	{
+		return;
+	}
+
+	uint8_t address = request[0];
+	uint8_t functionCode = request[1];
+	bool broadcast = ( address == 0 );
+	unsigned char body[ 3 + 2*g_SimMaxReadRegisters ];
+
+	switch( functionCode )
+	{
+		case 0x03:
+		{
+			uint16_t startReg = static_cast< uint16_t >( ( request[2] << 8 ) | request[3] );
+			uint16_t numRegs = static_cast< uint16_t >( ( request[4] << 8 ) | request[5] );
+			if( broadcast )
+			{
+				return;
+			}
+			if( len != 8 || numRegs == 0 || numRegs > g_SimMaxReadRegisters )
+			{
+				QueueException( address, functionCode, g_SimIllegalDataValue, nowMs );
+				return;
+			}
+
+			SimulatedSlave& slave = slaves_[ address ];
+			body[0] = address;
+			body[1] = functionCode;
+			body[2] = static_cast< unsigned char >( 2*numRegs );
+			for( uint16_t i = 0; i < numRegs; i++ )
+			{
+				uint16_t value = ReadRegister( slave, startReg + i, nowMs );
+				body[ 3 + 2*i ] = static_cast< unsigned char >( value >> 8 );
+				body[ 4 + 2*i ] = static_cast< unsigned char >( value );
+			}
+			QueueResponse( body, 3 + 2*numRegs, nowMs );
+			break;
+		}
+		case 0x06:
+		{
+			uint16_t reg = static_cast< uint16_t >( ( request[2] << 8 ) | request[3] );
+			uint16_t value = static_cast< uint16_t >( ( request[4] << 8 ) | request[5] );
+			if( len != 8 )
+			{
+				QueueException( address, functionCode, g_SimIllegalDataValue, nowMs );
+				return;
+			}
+
+			if( broadcast )
+			{
+				for( std::map< uint8_t, SimulatedSlave >::iterator it = slaves_.begin(); it != slaves_.end(); ++it )
+				{
+					WriteRegister( it->second, reg, value, nowMs );
+				}
+				return;
+			}
+
+			WriteRegister( slaves_[ address ], reg, value, nowMs );
+			//Response Echoes the Request
+			QueueResponse( request, 6, nowMs );
+			break;
+		}
+		case 0x10:
+		{
+			uint16_t startReg = static_cast< uint16_t >( ( request[2] << 8 ) | request[3] );
+			uint16_t numRegs = static_cast< uint16_t >( ( request[4] << 8 ) | request[5] );
+			if( len < 9 || request[6] != 2*numRegs || len != 9u + request[6] )
+			{
+				QueueException( address, functionCode, g_SimIllegalDataValue, nowMs );
+				return;
+			}
+
+			if( broadcast )
+			{
+				for( std::map< uint8_t, SimulatedSlave >::iterator it = slaves_.begin(); it != slaves_.end(); ++it )
+				{
+					for( uint16_t i = 0; i < numRegs; i++ )
+					{
+						WriteRegister( it->second, startReg + i, static_cast< uint16_t >( ( request[ 7 + 2*i ] << 8 ) | request[ 8 + 2*i ] ), nowMs );
+					}
+				}
+				return;
+			}
+
+			SimulatedSlave& slave = slaves_[ address ];
+			for( uint16_t i = 0; i < numRegs; i++ )
+			{
+				WriteRegister( slave, startReg + i, static_cast< uint16_t >( ( request[ 7 + 2*i ] << 8 ) | request[ 8 + 2*i ] ), nowMs );
+			}
+			//Response is the Request Header Without the Values
+			QueueResponse( request, 6, nowMs );
+			break;
+		}
+		case 0x08:
+			if( broadcast == false )
+			{
+				QueueResponse( request, len - 2, nowMs );
+			}
+			break;
+		default:
+			if( broadcast == false )
+			{
+				QueueException( address, functionCode, g_SimIllegalFunction, nowMs );
+			}
+			break;
+	}
+}
+
+//Queue body With its CRC, Ready Once the Slave's Silent Interval and the Response's Wire Time Have Passed
+void SimulatedCRKTransport::QueueResponse( const unsigned char body[], unsigned long bodyLen, double nowMs )
+{
+	uint16_t crc = SimulatedCrc( body, bodyLen );
+
+	response_.assign( body, body + bodyLen );
+	response_.push_back( static_cast< unsigned char >( crc ) );
+	response_.push_back( static_cast< unsigned char >( crc >> 8 ) );
+	responseRead_ = 0;
+
+	//3.5 Character Silent Interval Ends the Request Before the Slave Answers
+	responseReadyMs_ = nowMs + WireTimeMs( 4 ) + WireTimeMs( static_cast< unsigned long >( response_.size() ) );
+}
+
+void SimulatedCRKTransport::QueueException( uint8_t address, uint8_t functionCode, uint8_t exceptionCode, double nowMs )
+{
+	unsigned char body[] = { address, static_cast< unsigned char >( functionCode | g_SimExceptionBase ), exceptionCode };
+	QueueResponse( body, sizeof( body ), nowMs );
+}
+
+//Monitor Registers Are Computed From the Motion, Everything Else Reads Back What Was Written
+uint16_t SimulatedCRKTransport::ReadRegister( SimulatedSlave& slave, uint16_t address, double nowMs )
+{
+	bool moving = ( nowMs < slave.moveEndMs );
+	uint32_t position = static_cast< uint32_t >( PositionAt( slave, nowMs ) );
+	uint32_t operatingSpeed = Register32( slave, g_SimOperatingSpeedRegister );
+	uint32_t speed = ( moving ) ? ( ( operatingSpeed != 0 ) ? operatingSpeed : static_cast< uint32_t >( motorSpeedStepsPerSec_ ) ) : 0;
+	if( moving && slave.continuousHz != 0 )
+	{
+		speed = static_cast< uint32_t >( fabs( slave.continuousHz ) );
+	}
+
+	switch( address )
+	{
+		case g_SimCommandPosRegister:
+			return static_cast< uint16_t >( position >> 16 );
+		case g_SimCommandPosRegister + 1:
+			return static_cast< uint16_t >( position );
+		case g_SimEncoderCounterRegister:
+			return static_cast< uint16_t >( ( position + slave.encoderLag ) >> 16 );
+		case g_SimEncoderCounterRegister + 1:
+			return static_cast< uint16_t >( position + slave.encoderLag );
+		case g_SimCommandSpeedRegister:
+			return static_cast< uint16_t >( speed >> 16 );
+		case g_SimCommandSpeedRegister + 1:
+			return static_cast< uint16_t >( speed );
+		case g_SimIOStatusRegister:
+			return ( moving ) ? g_SimIOStatusMoveHigh : 0;
+		case g_SimIOStatusRegister + 1:
+			return 0;
+		default:
+			break;
+	}
+
+	return Register16( slave, address );
+}
+
+/* Store a Register Value, Starting or Stopping Motion on Cmd1 Edges
+*   Note:  A Start edge while moving, or with an alarm present, is ignored, as the controller ignores it
+*   Note:  The low word of the jog speed (written last in a multi-write) changes the speed of continuous operation
+*/
+void SimulatedCRKTransport::WriteRegister( SimulatedSlave& slave, uint16_t address, uint16_t value, double nowMs )
+{
+	uint16_t previous = slave.registers[ address ];
+	slave.registers[ address ] = value;
+
+	bool risingEdge = ( value != 0 && previous == 0 );
+	if( address == g_SimResetAlarmRegister && risingEdge )
+	{
+		slave.registers[ g_SimPresentAlarmRegister ] = 0;
+	}
+	else if( address == g_SimClearWarningRecordsRegister && risingEdge )
+	{
+		slave.registers[ g_SimPresentWarningRegister ] = 0;
+	}
+	else if( address == g_SimJogSpeedRegister + 1 && slave.continuousHz != 0 && nowMs < slave.moveEndMs )
+	{
+		StartContinuous( slave, ( slave.continuousHz > 0 ) ? 1 : -1, nowMs );
+	}
+
+	if( address != g_SimCmd1Register )
+	{
+		return;
+	}
+
+	bool moving = ( nowMs < slave.moveEndMs );
+	long current = PositionAt( slave, nowMs );
+	int direction = ( ( value & g_SimCmd1Fwd ) != 0 ) ? 1 : ( ( ( value & g_SimCmd1Rvs ) != 0 ) ? -1 : 0 );
+	int previousDirection = ( ( previous & g_SimCmd1Fwd ) != 0 ) ? 1 : ( ( ( previous & g_SimCmd1Rvs ) != 0 ) ? -1 : 0 );
+
+	if( ( ( value & g_SimCmd1Stop ) != 0 && moving ) || ( direction == 0 && slave.continuousHz != 0 ) )
+	{
+		slave.startPos = current;
+		slave.targetPos = current;
+		slave.moveEndMs = nowMs;
+		slave.continuousHz = 0;
+	}
+	else if( direction != 0 && direction != previousDirection && ( moving == false || slave.continuousHz != 0 ) && Register16( slave, g_SimPresentAlarmRegister ) == 0 )
+	{
+		StartContinuous( slave, direction, nowMs );
+	}
+	else if( ( value & g_SimCmd1Start ) != 0 && ( previous & g_SimCmd1Start ) == 0 && moving == false && Register16( slave, g_SimPresentAlarmRegister ) == 0 )
+	{
+		int32_t distance = static_cast< int32_t >( Register32( slave, g_SimPosRegister ) );
+
+		//Positioning Mode 0 is Incremental, 1 Absolute
+		StartMove( slave, ( Register16( slave, g_SimPosModeRegister ) == 0 ) ? distance : distance - current, nowMs );
+	}
+}
+
+/* Start a Move of distance Steps:  Time it From the Speed and Rate Registers and Apply the Step-Out Model
+*   Note:  Unwritten speed or rates keep the constant motor speed; a step-out still reaches the commanded position, the encoder lags it
+*/
+void SimulatedCRKTransport::StartMove( SimulatedSlave& slave, long distance, double nowMs )
+{
+	long current = PositionAt( slave, nowMs );
+	uint32_t operatingSpeed = Register32( slave, g_SimOperatingSpeedRegister );
+	bool separateRates = ( Register16( slave, g_SimAccelRateTypeRegister ) != 0 );
+	uint32_t accelRate = Register32( slave, ( separateRates ) ? g_SimAccelRateRegister : g_SimCommonAccelRateRegister );
+	uint32_t decelRate = Register32( slave, ( separateRates ) ? g_SimDecelRateRegister : g_SimCommonDecelRateRegister );
+
+	double speedHz = ( operatingSpeed != 0 ) ? operatingSpeed : motorSpeedStepsPerSec_;
+	double peakHz = speedHz;
+	double hardestHzPerS = 0;
+	double moveS;
+	if( accelRate != 0 && decelRate != 0 )
+	{
+		//Rates Are the Time For 1 kHz in 0.001 ms
+		double accelHzPerS = 1e9 / accelRate;
+		double decelHzPerS = 1e9 / decelRate;
+		moveS = MotionPlanner::MoveTimeS( static_cast< double >( labs( distance ) ), 0, speedHz, accelHzPerS, decelHzPerS, peakHz );
+		hardestHzPerS = ( accelHzPerS > decelHzPerS ) ? accelHzPerS : decelHzPerS;
+	}
+	else
+	{
+		moveS = labs( distance ) / speedHz;
+	}
+
+	slave.startPos = current;
+	slave.targetPos = current + distance;
+	slave.moveStartMs = nowMs;
+	slave.moveEndMs = nowMs + moveS * 1000;
+	slave.continuousHz = 0;
+
+	//Torque Falls With the Operating Current (Unwritten is the 100% Factory Setting)
+	uint16_t currentPercent = Register16( slave, g_SimOperatingCurrentRegister );
+	double torque = ( currentPercent != 0 ) ? currentPercent / 100.0 : 1.0;
+	double speedOverload = peakHz / ( simPullOutSpeedHz_ * torque );
+	double accelOverload = hardestHzPerS / ( simMaxAccelHzPerS_ * torque );
+	double overload = ( speedOverload > accelOverload ) ? speedOverload : accelOverload;
+	if( overload <= 1 )
+	{
+		return;
+	}
+
+	long lost = static_cast< long >( labs( distance ) * ( 1 - 1 / overload ) + 0.5 );
+	slave.encoderLag += ( distance > 0 ) ? -lost : lost;
+
+	if( Register16( slave, g_SimStepOutDetectionRegister ) != 0 && lost > 0 )
+	{
+		uint16_t action = Register16( slave, g_SimStepOutActionRegister );
+		if( action == g_SimStepOutWarning )
+		{
+			slave.registers[ g_SimPresentWarningRegister ] = g_SimStepOutCode;
+		}
+		else if( action == g_SimStepOutAlarm )
+		{
+			slave.registers[ g_SimPresentAlarmRegister ] = g_SimStepOutCode;
+		}
+	}
+}
+
+/* Run Continuously in direction at the Jog Speed:  a Move of continuousHorizonS_ From the Current Position
+*   Note:  Unwritten jog speed keeps the constant motor speed
+*/
+void SimulatedCRKTransport::StartContinuous( SimulatedSlave& slave, int direction, double nowMs )
+{
+	long current = PositionAt( slave, nowMs );
+	uint32_t jogSpeed = Register32( slave, g_SimJogSpeedRegister );
+	double speedHz = ( jogSpeed != 0 ) ? jogSpeed : motorSpeedStepsPerSec_;
+
+	slave.startPos = current;
+	slave.targetPos = current + direction * static_cast< long >( speedHz * continuousHorizonS_ );
+	slave.moveStartMs = nowMs;
+	slave.moveEndMs = nowMs + continuousHorizonS_ * 1000.0;
+	slave.continuousHz = direction * speedHz;
+}
+
+//Stored Register Value (0 if Never Written)
+uint16_t SimulatedCRKTransport::Register16( const SimulatedSlave& slave, uint16_t address )
+{
+	std::map< uint16_t, uint16_t >::const_iterator it = slave.registers.find( address );
+	return ( it != slave.registers.end() ) ? it->second : 0;
+}
+
+//Stored Two Register (Big Endian Word Order) Value
+uint32_t SimulatedCRKTransport::Register32( const SimulatedSlave& slave, uint16_t address )
+{
+	return ( static_cast< uint32_t >( Register16( slave, address ) ) << 16 ) | Register16( slave, address + 1 );
+}
+
+long SimulatedCRKTransport::PositionAt( const SimulatedSlave& slave, double nowMs ) const
+{
+	if( nowMs >= slave.moveEndMs || slave.moveEndMs <= slave.moveStartMs )
+	{
+		return slave.targetPos;
+	}
+
+	double fraction = ( nowMs - slave.moveStartMs ) / ( slave.moveEndMs - slave.moveStartMs );
+	return slave.startPos + static_cast< long >( ( slave.targetPos - slave.startPos ) * fraction );
+}
@@ -0,0 +1,226 @@
+#ifndef _SERIAL_TRANSPORT_
+#define _SERIAL_TRANSPORT_
+
+#include "OrientalCoreDefs.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <map>
+
+/*
+*  Byte Transport Under SerialControllerBus::SerialCommunicate()
+*     Every Transaction is Configure(), Write() of the Request, Then One Read() per Expected Chunk
+*     All Functions Return 0 on Success or a Transport Specific Error Code Otherwise
+*/
+class SerialTransport
+{
+	public:
+		virtual ~SerialTransport() {}
+
+		//Set Line Parameters Before a Transaction (Bus Settings Are Fixed by the Controllers For Now)
+		virtual int Configure( unsigned long baudRate ) = 0;
+		virtual int Write( const unsigned char buffer[], unsigned long len, unsigned long& bytesWritten ) = 0;
+		virtual int Read( unsigned char buffer[], unsigned long len, unsigned long& bytesRead ) = 0;
+		//Drop Bytes Still in Flight (a Late Answer to a Timed-Out Request) Before a Retry, Transports Without a Buffer Have Nothing to Drop
+		virtual int Purge( void ) { return 0; }
+};
+
+/*
+*  Bus Capture Format
+*     BusCaptureFileHeader, Then a Sequence of BusCaptureRecordHeader Each Followed by byteCount Bytes
+*     Rx Records Hold the Bytes Actually Returned, Which May Be Fewer Than Requested (Timeouts)
+*/
+enum BusCaptureDirection
+{
+	BusCaptureTx = 0,
+	BusCaptureRx = 1
+};
+
+struct BusCaptureFileHeader
+{
+	char magic[8];				//"OMBUSCAP"
+	uint32_t version;
+	uint32_t reserved;
+};
+
+struct BusCaptureRecordHeader
+{
+	double timeMs;				//CAlternativeUtils::GetMonotonicTimeMs() When the Call Returned
+	uint32_t byteCount;
+	uint8_t direction;			//BusCaptureDirection
+	uint8_t status;				//0 if the Wrapped Call Succeeded
+	uint16_t reserved;
+};
+
+/*  Decorator That Records Every Byte Through Another Transport to a Capture File
+*/
+class CapturingSerialTransport : public SerialTransport
+{
+	public:
+		CapturingSerialTransport( SerialTransport* wrapped );
+		~CapturingSerialTransport();
+
+		/* Start a New Capture File (Overwritten if Present)
+		*   Returns - 0 if opened, otherwise non-zero
+		*/
+		int Open( const std::string& path );
+		void Close( void );
+		bool IsOpen( void ) const { return file_ != nullptr; }
+		const std::string& GetPath( void ) const { return path_; }
+
+		//Transport That Captured Calls Are Forwarded To
+		void SetWrapped( SerialTransport* wrapped ) { wrapped_ = wrapped; }
+
+		int Configure( unsigned long baudRate );
+		int Write( const unsigned char buffer[], unsigned long len, unsigned long& bytesWritten );
+		int Read( unsigned char buffer[], unsigned long len, unsigned long& bytesRead );
+		//Not Captured, Only Forwarded
+		int Purge( void ) { return wrapped_->Purge(); }
+
+	private:
+		void Append( uint8_t direction, int status, const unsigned char buffer[], unsigned long len );
+
+		SerialTransport* wrapped_;
+		FILE* file_;
+		std::string path_;
+};
+
+/*  Serves a Capture Back in Place of the Bus
+*     Writes Consume the Next Tx Record (Mismatched Requests Are Counted, Not Rejected)
+*     Reads Return the Next Rx Record, Paced to the Original Timing or Immediately
+*/
+class ReplaySerialTransport : public SerialTransport
+{
+	public:
+		ReplaySerialTransport();
+
+		/* Load a Capture File Into Memory and Rewind
+		*   Returns - 0 if the file is a valid capture, otherwise non-zero
+		*/
+		int Load( const std::string& path );
+		void Rewind( void );
+		const std::string& GetPath( void ) const { return path_; }
+
+		//true to Wait Out the Captured Gaps Between Records, false to Replay as Fast as Possible
+		void SetOriginalTiming( bool originalTiming ) { originalTiming_ = originalTiming; }
+		bool GetOriginalTiming( void ) const { return originalTiming_; }
+
+		unsigned long GetMismatchCount( void ) const { return mismatchCount_; }
+		bool AtEnd( void ) const { return next_ >= records_.size(); }
+
+		int Configure( unsigned long /*baudRate*/ ) { return 0; }
+		int Write( const unsigned char buffer[], unsigned long len, unsigned long& bytesWritten );
+		int Read( unsigned char buffer[], unsigned long len, unsigned long& bytesRead );
+
+	private:
+		struct ReplayRecord
+		{
+			BusCaptureRecordHeader header;
+			size_t offset;			//Into bytes_
+		};
+
+		//Advance to the Next Record of direction, Pacing if Requested; Returns nullptr at the End of the Capture
+		const ReplayRecord* Next( uint8_t direction );
+
+		std::vector< ReplayRecord > records_;
+		std::vector< unsigned char > bytes_;
+		std::string path_;
+		size_t next_;
+		bool originalTiming_;
+		double replayStartMs_;
+		unsigned long mismatchCount_;
+};
+
+/*  Simulated CRK Series Slaves in Place of the Bus (Benchmarks and Development Without Hardware)
+*     Answers Modbus RTU Reads (0x03), Writes (0x06, 0x10) and Diagnosis (0x08) For Any Slave Address, Broadcasts Reach Every Slave
+*     Timing:  Every Call Pays the USB Latency, Frames Pay Their Time on the Wire at the Simulated Baud Rate (11 Bits per Byte)
+*     Motion:  A Rising Start Bit in Cmd1 Moves to the Position Register (Incremental or Absolute per 0x0015) at a Constant Motor Speed,
+*              the Monitor Area Reports the Command Position, Encoder Count, Command Speed and the IO Status MOVE Bit While it Runs
+*              A Written Operating Speed (0x001A) Replaces the Motor Speed, Written Rates (Common, or Operation Data if 0x0236 is Separate)
+*              Make the Move Trapezoidal
+*     Continuous:  Fwd or Rvs in Cmd1 Runs at the Jog Speed (0x0230) Until Both Are Dropped or Stop is Set, a Jog Speed Write Applies at Once
+*              (Ramps Are Not Modelled; a Run Ends After continuousHorizonS_)
+*     Step-Out:  Moves Faster Than simPullOutSpeedHz_ or Harder Than simMaxAccelHzPerS_ (Both Scaled by the Operating Current, 0x021E)
+*              Lose Steps; the Encoder Count Falls Behind, and With Detection On (0x0310) the Action in 0x025C Raises a Warning or an Alarm
+*              An Alarm Refuses Starts Until a Reset Alarm Edge (0x0040); a Clear Warning Records Edge (0x0042) Clears the Warning
+*     Note:  The Hub Configures 9600 Baud For Every Transaction, the Simulated Line Runs at SetBaudRate() Instead
+*/
+class SimulatedCRKTransport : public SerialTransport
+{
+	public:
+		static const unsigned long defaultBaudRate_ = 9600;
+		static const long defaultUsbLatencyMS_ = 1;
+		static const long defaultMotorSpeedStepsPerSec_ = 1000;
+		//Torque Model at 100% Operating Current
+		static const long simPullOutSpeedHz_ = 6000;
+		static const long simMaxAccelHzPerS_ = 200000;
+		//Continuous Operation is a Move This Long at the Jog Speed
+		static const long continuousHorizonS_ = 600;
+
+		SimulatedCRKTransport();
+
+		void SetBaudRate( unsigned long baudRate ) { baudRate_ = ( baudRate > 0 ) ? baudRate : defaultBaudRate_; }
+		unsigned long GetBaudRate( void ) const { return baudRate_; }
+		void SetUsbLatencyMs( double latencyMs ) { usbLatencyMs_ = ( latencyMs > 0 ) ? latencyMs : 0; }
+		double GetUsbLatencyMs( void ) const { return usbLatencyMs_; }
+		void SetMotorSpeed( double stepsPerSec ) { motorSpeedStepsPerSec_ = ( stepsPerSec > 0 ) ? stepsPerSec : defaultMotorSpeedStepsPerSec_; }
+		double GetMotorSpeed( void ) const { return motorSpeedStepsPerSec_; }
+
+		//Forget Every Slave (All Registers 0, Motors at Rest at Position 0)
+		void Reset( void );
+
+		int Configure( unsigned long /*baudRate*/ ) { return 0; }
+		int Write( const unsigned char buffer[], unsigned long len, unsigned long& bytesWritten );
+		int Read( unsigned char buffer[], unsigned long len, unsigned long& bytesRead );
+
+	private:
+		struct SimulatedSlave
+		{
+			SimulatedSlave() : moveStartMs(0), moveEndMs(0), startPos(0), targetPos(0), encoderLag(0), continuousHz(0) {}
+
+			std::map< uint16_t, uint16_t > registers;
+			double moveStartMs;
+			double moveEndMs;
+			long startPos;
+			long targetPos;
+			long encoderLag;		//Steps Lost to Step-Out (Encoder Count Minus Command Position)
+			double continuousHz;	//Signed Speed of Continuous Operation, 0 For Positioning or at Rest
+		};
+
+		//Apply a Request and Queue its Response (Nothing is Queued For Broadcasts)
+		void Respond( const unsigned char request[], unsigned long len, double nowMs );
+		void QueueResponse( const unsigned char body[], unsigned long bodyLen, double nowMs );
+		void QueueException( uint8_t address, uint8_t functionCode, uint8_t exceptionCode, double nowMs );
+
+		uint16_t ReadRegister( SimulatedSlave& slave, uint16_t address, double nowMs );
+		void WriteRegister( SimulatedSlave& slave, uint16_t address, uint16_t value, double nowMs );
+		long PositionAt( const SimulatedSlave& slave, double nowMs ) const;
+
+		//Stored Register Values (0 if Never Written)
+		static uint16_t Register16( const SimulatedSlave& slave, uint16_t address );
+		static uint32_t Register32( const SimulatedSlave& slave, uint16_t address );
+
+		/* Start a Move of distance Steps:  Time it From the Speed and Rate Registers and Apply the Step-Out Model
+		*/
+		void StartMove( SimulatedSlave& slave, long distance, double nowMs );
+
+		/* Run Continuously in direction (1 or -1) at the Jog Speed From the Current Position (Also Applies a New Jog Speed)
+		*/
+		void StartContinuous( SimulatedSlave& slave, int direction, double nowMs );
+
+		double WireTimeMs( unsigned long numBytes ) const { return numBytes * 11 * 1000.0 / baudRate_; }
+
+		unsigned long baudRate_;
+		double usbLatencyMs_;
+		double motorSpeedStepsPerSec_;
+
+		std::map< uint8_t, SimulatedSlave > slaves_;
+
+		//Response Bytes Not Yet Read, Available From responseReadyMs_
+		std::vector< unsigned char > response_;
+		size_t responseRead_;
+		double responseReadyMs_;
+};
+
+#endif
@@ -0,0 +1,87 @@
+#include "StageSequenceExecutor.h"
+#include "OrientalControllerTemplate.h"
+#include "ControllerLog.h"
+#include "AlternativeUtils.h"
+
+StageSequenceExecutor::StageSequenceExecutor( SequencedStage& stage, AbstractControllerInterface* controller, const std::vector< double >& positionsUm,
+												double dwellMs, ControllerLogSink* logSink ):
+	stage_(stage),
+	controller_(controller),
+	positionsUm_(positionsUm),
+	dwellMs_( ( dwellMs > 0 ) ? dwellMs : 0 ),
+	logSink_(logSink),
+	stop_(false),
+	done_(false),
+	errCode_(0),
+	positionsDone_(0)
+{ }
+
+StageSequenceExecutor::~StageSequenceExecutor()
+{ }
+
+int StageSequenceExecutor::svc( void ) {
+
+	ControllerLogScope logScope( logSink_ );
+	double startMs = CAlternativeUtils::GetMonotonicTimeMs();
+
+	for( size_t i = 0; i < positionsUm_.size() && stop_ == false; i++ )
+	{
+		int ret = VisitPosition( positionsUm_[i] );
+		if( ret != 0 )
+		{
+			ORIENTAL_LOG_WARN( "Stage Sequence Stopped at Position {} ({} um) With {}", (unsigned long) i, positionsUm_[i], ret );
+			errCode_ = ret;
+			break;
+		}
+		positionsDone_++;
+	}
+
+	ORIENTAL_LOG_DEBUG( "Stage Sequence Reached {} of {} Positions in {} ms", (unsigned long) positionsDone_, (unsigned long) positionsUm_.size(),
+						CAlternativeUtils::GetMonotonicTimeMs() - startMs );
+
+	done_ = true;
+	return 0;
+
+}
+
+/* Move to positionUm and Wait Out the Move and the Dwell
+*   Note:  The dwell is slept in 1 ms slices and busy polls are busyPollMS_ apart, so Stop() is noticed within a millisecond or one busy poll
+*   Returns - 0, or the failing error code (0 too if Stop() cut the wait short)
+*/
+int StageSequenceExecutor::VisitPosition( double positionUm ) {
+
+	int ret;
+	double startMs = CAlternativeUtils::GetMonotonicTimeMs();
+
+	if( ( ret = stage_.SetPositionUm( positionUm ) ) != 0 )
+	{
+		return ret;
+	}
+
+	//IsMotorBusy() is 1 While Moving, 0 Once Stopped, Any Other Value an Error
+	while( ( ret = controller_->IsMotorBusy() ) == 1 )
+	{
+		if( stop_ )
+		{
+			return 0;
+		}
+		if( CAlternativeUtils::GetMonotonicTimeMs() - startMs > settleTimeoutMS_ )
+		{
+			return DEVICE_ERR;
+		}
+		CAlternativeUtils::SleepMs( busyPollMS_ );
+	}
+	if( ret != 0 )
+	{
+		return ret;
+	}
+
+	double settledMs = CAlternativeUtils::GetMonotonicTimeMs();
+	while( stop_ == false && CAlternativeUtils::GetMonotonicTimeMs() - settledMs < dwellMs_ )
+	{
+		CAlternativeUtils::SleepMs( 1 );
+	}
+
+	return 0;
+
+}
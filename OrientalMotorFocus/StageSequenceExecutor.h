@@ -0,0 +1,92 @@
+#ifndef _STAGE_SEQUENCE_EXECUTOR_
+#define _STAGE_SEQUENCE_EXECUTOR_
+
+#include "OrientalCoreDefs.h"
+#include <vector>
+#include <assert.h>
+#include <boost/atomic.hpp>
+
+//Forward Declarations
+class AbstractControllerInterface;
+class ControllerLogSink;
+
+/*  Stage a Sequence Moves (OrientalMotorFocus)
+*/
+class SequencedStage
+{
+	public:
+		virtual ~SequencedStage() {}
+
+		/* Start a Move to posUm
+		*   Returns - 0, or errCode otherwise
+		*/
+		virtual int SetPositionUm( double posUm ) = 0;
+};
+
+/*
+*  Runs a Stage Sequence Off the Calling Thread:  Moves Through Every Position Once, Holding dwellMs at Each
+*     The Stage Leads:  the Controller's Trigger Output (AbstractControllerInterface::SetTriggerOutput()) Fires the Camera
+*     as Each Position is Reached, Nothing Waits For a Camera Trigger to Advance
+*     Note:  Moves Go Through SequencedStage::SetPositionUm() (OrientalMotorFocus), so the Motion Planner and the Trigger Window Apply to Each;
+*            it Holds the Stage's Motion Lock For the Move, so Calls on the Device Thread Wait For the Move to be Written
+*     Note:  Completion is Confirmed by Polling IsMotorBusy() on the Controller, as MoveLatencyBenchmark Does, busyPollMS_ Apart
+*     Limitation:  Nothing Reports the Trigger Back to the Host, so Each Poll is an RS-485 Round Trip; the Next Move Lags the Stop
+*                  by Up to a Round Trip Plus busyPollMS_, and the Polls Share the Bus With Every Other Axis During a Run
+*/
+class StageSequenceExecutor: public MMDeviceThreadBase
+{
+	public:
+		static const long settleTimeoutMS_ = 10000;
+		//Sleep Between IsMotorBusy() Polls
+		static const long busyPollMS_ = 1;
+
+		/*
+		*   @param positionsUm - stage positions in the order they are visited
+		*   @param dwellMs - time held at each position after the move finishes
+		*/
+		StageSequenceExecutor( SequencedStage& stage, AbstractControllerInterface* controller, const std::vector< double >& positionsUm,
+								double dwellMs, ControllerLogSink* logSink = nullptr );
+		~StageSequenceExecutor();
+
+		/* Sequence Loop, Ends After the Last Position, an Error or Stop()
+		*    Returns - 0 on completion
+		*/
+		int svc( void );
+
+		int open (void*) { return 0;}
+		int close(unsigned long) {return 0;}
+
+		//Used to Start the Thread Loop
+		void Start() { stop_ = false; done_ = false; activate(); }
+		//Used to Stop the Thread Loop (Follow With wait() Before Deleting), a Move Under Way Still Finishes
+		void Stop() { stop_ = true; }
+
+		//The Loop Has Ended
+		bool IsDone( void ) const { return done_; }
+		//0, or the First Error of a Move
+		int GetErrCode( void ) const { return errCode_; }
+		//Positions Reached So Far
+		unsigned long GetPositionsDone( void ) const { return positionsDone_; }
+
+	private:
+
+		/* Move to positionUm and Wait Out the Move and the Dwell
+		*   Returns - 0, or the failing error code (0 too if Stop() cut the wait short)
+		*/
+		int VisitPosition( double positionUm );
+
+		SequencedStage& stage_;
+		AbstractControllerInterface* controller_;
+		std::vector< double > positionsUm_;
+		double dwellMs_;
+		ControllerLogSink* logSink_;
+
+		boost::atomic<bool> stop_;
+		boost::atomic<bool> done_;
+		boost::atomic<int> errCode_;
+		boost::atomic<unsigned long> positionsDone_;
+
+		StageSequenceExecutor& operator=(StageSequenceExecutor& ) {assert(false); return *this;}
+};
+
+#endif
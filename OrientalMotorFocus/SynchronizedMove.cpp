@@ -0,0 +1,149 @@
+#include "SynchronizedMove.h"
+#include "OrientalControllerTemplate.h"
+#include "AlternativeUtils.h"
+#include "MotionTelemetrySample.h"
+#include <stdio.h>
+
+/* Add an Axis to the Move
+*   Returns - 0, or 1 if controller is nullptr or already added
+*/
+int SynchronizedMove::AddAxis( AbstractControllerInterface* controller, long steps )
+{
+	if( controller == nullptr )
+	{
+		return 1;
+	}
+
+	for( size_t i = 0; i < controllers_.size(); i++ )
+	{
+		if( controllers_[i] == controller )
+		{
+			return 1;
+		}
+	}
+
+	SynchronizedMoveAxisResult result;
+	result.address = 0;
+	controller->GetAddress( result.address );
+	result.steps = steps;
+	result.errCode = 0;
+	result.settleMs = 0;
+
+	controllers_.push_back( controller );
+	results_.push_back( result );
+
+	return 0;
+}
+
+/* Preload Every Axis, Broadcast the Start and Wait For Every Axis to Finish
+*   Note:  Axes are polled round-robin, so one slow axis does not delay the settle time of the others
+*   Note:  Absolute axes cost one command position read each before the preload
+*   Returns - 0 if every axis settled, otherwise the first error (per-axis results are still kept)
+*/
+int SynchronizedMove::Execute( void )
+{
+	int errCode = 0;
+	int ret;
+
+	if( controllers_.empty() )
+	{
+		return 1;
+	}
+
+	//Addressed Writes, the Move is Not Started Yet
+	for( size_t i = 0; i < controllers_.size(); i++ )
+	{
+		long target = results_[i].steps;
+		MotionTelemetrySample sample;
+		ret = 0;
+		if( controllers_[i]->IsAbsolutePositioning() && ( ret = controllers_[i]->ReadMotionTelemetry( sample ) ) == 0 )
+		{
+			target += sample.commandPos;
+		}
+
+		if( ret != 0 || ( ret = controllers_[i]->PreloadPos( target ) ) != 0 )
+		{
+			results_[i].errCode = ret;
+			if( errCode == 0 )
+			{
+				errCode = ret;
+			}
+		}
+	}
+
+	if( errCode != 0 )
+	{
+		return errCode;
+	}
+
+	//One Frame Starts Every Axis
+	double startMs = CAlternativeUtils::GetMonotonicTimeMs();
+	if( ( errCode = controllers_.front()->BroadcastStart() ) != 0 )
+	{
+		for( size_t i = 0; i < results_.size(); i++ )
+		{
+			results_[i].errCode = errCode;
+		}
+		return errCode;
+	}
+	for( size_t i = 1; i < controllers_.size(); i++ )
+	{
+		controllers_[i]->MarkPosReadbackMoving();
+	}
+
+	//IsMotorBusy() is 1 While Moving, 0 Once Stopped, Any Other Value an Error
+	std::vector< bool > settled( controllers_.size(), false );
+	size_t remaining = controllers_.size();
+	while( remaining > 0 )
+	{
+		bool timedOut = ( CAlternativeUtils::GetMonotonicTimeMs() - startMs > settleTimeoutMS_ );
+
+		for( size_t i = 0; i < controllers_.size(); i++ )
+		{
+			if( settled[i] )
+			{
+				continue;
+			}
+
+			ret = controllers_[i]->IsMotorBusy();
+			if( ret == 1 && timedOut == false )
+			{
+				continue;
+			}
+
+			results_[i].settleMs = CAlternativeUtils::GetMonotonicTimeMs() - startMs;
+			results_[i].errCode = ( ret == 1 ) ? 1 : ret;
+			settled[i] = true;
+			remaining--;
+
+			if( results_[i].errCode != 0 && errCode == 0 )
+			{
+				errCode = results_[i].errCode;
+			}
+		}
+
+		if( remaining > 0 )
+		{
+			CAlternativeUtils::SleepMs( settlePollMS_ );
+		}
+	}
+
+	return errCode;
+}
+
+//One Line Per Axis For the Log
+std::string SynchronizedMove::Summary( void ) const
+{
+	std::string summary;
+	char line[120];
+
+	for( size_t i = 0; i < results_.size(); i++ )
+	{
+		const SynchronizedMoveAxisResult& r = results_[i];
+		sprintf( line, "Axis %u: %ld steps, %s (%d) after %.1f ms\n",
+					static_cast< unsigned int >( r.address ), r.steps, ( r.errCode == 0 ) ? "settled" : "failed", r.errCode, r.settleMs );
+		summary += line;
+	}
+
+	return summary;
+}
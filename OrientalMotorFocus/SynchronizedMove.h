@@ -0,0 +1,64 @@
+#ifndef _SYNCHRONIZED_MOVE_
+#define _SYNCHRONIZED_MOVE_
+
+#include <string>
+#include <vector>
+
+//Forward Declarations
+class AbstractControllerInterface;
+
+/*  Outcome of One Axis in a Synchronized Move
+*     settleMs - time from the broadcast start to the controller reporting the move finished
+*/
+struct SynchronizedMoveAxisResult
+{
+	unsigned char address;
+	long steps;
+	int errCode;
+	double settleMs;
+};
+
+/*
+*  Several Axes on One Bus Started by a Single Broadcast Frame
+*     Each Axis is Preloaded With Addressed Writes (PreloadPos()), Then One cmd1 Start Goes to Slave 0 so All Start Together
+*     Completion is Then Tracked Per Axis Through IsMotorBusy()
+*     Note:  The Broadcast Start Reaches Every Slave on the Bus, so Every Axis Sharing the Bus Must be Added (0 Steps to Hold)
+*     Note:  Steps Are Relative; an Axis in Absolute Positioning Mode is Preloaded With its Command Position Plus its Steps
+*            (so a Holding Axis Preloads Where it Is)
+*/
+class SynchronizedMove
+{
+	public:
+		static const long settleTimeoutMS_ = 10000;
+		//Sleep Between Passes Over the Axes Still Moving (Settle Times Are Resolved to About This)
+		static const long settlePollMS_ = 1;
+
+		SynchronizedMove( void ) {}
+
+		/* Add an Axis to the Move
+		*   @param controller - controller of the axis (must share the bus of the other axes)
+		*   @param steps - relative move, 0 keeps the axis where it is
+		*   Returns - 0, or 1 if controller is nullptr or already added
+		*/
+		int AddAxis( AbstractControllerInterface* controller, long steps );
+
+		/* Preload Every Axis, Broadcast the Start and Wait For Every Axis to Finish
+		*   Note:  Nothing is started if any axis fails to preload
+		*   Returns - 0 if every axis settled, otherwise the first error (per-axis results are still kept)
+		*/
+		int Execute( void );
+
+		const std::vector< SynchronizedMoveAxisResult >& GetResults( void ) const { return results_; }
+
+		//One Line Per Axis For the Log
+		std::string Summary( void ) const;
+
+	private:
+		std::vector< AbstractControllerInterface* > controllers_;
+		std::vector< SynchronizedMoveAxisResult > results_;
+
+		SynchronizedMove( const SynchronizedMove& );
+		SynchronizedMove& operator=( const SynchronizedMove& );
+};
+
+#endif
@@ -0,0 +1,583 @@
+#include "TelemetryRecorder.h"
+#include "AlternativeUtils.h"
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+
+#ifdef WIN32
+   #define WIN32_LEAN_AND_MEAN
+   #include <windows.h>
+#else
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <fcntl.h>
+   #include <unistd.h>
+#endif
+
+static const char g_TelemetryMagic[8] = { 'O', 'M', 'T', 'R', 'E', 'C', 0, 0 };
+static const uint32_t g_TelemetryVersion = 1;
+
+/******************************************
+
+ TelemetryMappedFile
+
+ *******************************************/
+
+TelemetryMappedFile::TelemetryMappedFile() :
+	data_(nullptr),
+	size_(0),
+	writable_(false)
+#ifdef WIN32
+	, fileHandle_(INVALID_HANDLE_VALUE),
+	mappingHandle_(nullptr)
+#else
+	, fd_(-1)
+#endif
+{ }
+
+TelemetryMappedFile::~TelemetryMappedFile()
+{
+	Close();
+}
+
+/* Create (or Overwrite) a File of initialBytes and Map it Read/Write
+*   Returns - 0 if mapped, otherwise non-zero
+*/
+int TelemetryMappedFile::OpenForWrite( const std::string& path, uint64_t initialBytes )
+{
+	Close();
+	writable_ = true;
+
+#ifdef WIN32
+	fileHandle_ = CreateFileA( path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL );
+	if( fileHandle_ == INVALID_HANDLE_VALUE )
+	{
+		return 1;
+	}
+#else
+	fd_ = open( path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+	if( fd_ < 0 )
+	{
+		return 1;
+	}
+#endif
+
+	if( Resize( initialBytes ) != 0 )
+	{
+		Close();
+		return 2;
+	}
+
+	return 0;
+}
+
+/* Map an Existing File Read Only
+*   Returns - 0 if mapped, otherwise non-zero
+*/
+int TelemetryMappedFile::OpenForRead( const std::string& path )
+{
+	Close();
+	writable_ = false;
+
+#ifdef WIN32
+	LARGE_INTEGER fileSize;
+	fileHandle_ = CreateFileA( path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+	if( fileHandle_ == INVALID_HANDLE_VALUE || GetFileSizeEx( fileHandle_, &fileSize ) == FALSE )
+	{
+		Close();
+		return 1;
+	}
+	size_ = static_cast< uint64_t >( fileSize.QuadPart );
+#else
+	struct stat fileStat;
+	fd_ = open( path.c_str(), O_RDONLY );
+	if( fd_ < 0 || fstat( fd_, &fileStat ) != 0 )
+	{
+		Close();
+		return 1;
+	}
+	size_ = static_cast< uint64_t >( fileStat.st_size );
+#endif
+
+	if( size_ == 0 || Map( false ) != 0 )
+	{
+		Close();
+		return 2;
+	}
+
+	return 0;
+}
+
+/* Extend the File to newBytes and Remap it
+*   Note:  Invalidates Data() pointers from before the call
+*   Returns - 0 if remapped, otherwise non-zero
+*/
+int TelemetryMappedFile::Resize( uint64_t newBytes )
+{
+	if( writable_ == false )
+	{
+		return 1;
+	}
+
+	Unmap();
+
+#ifdef WIN32
+	//CreateFileMapping() Extends the File to the Mapping Size
+	size_ = newBytes;
+#else
+	if( ftruncate( fd_, static_cast< off_t >( newBytes ) ) != 0 )
+	{
+		return 2;
+	}
+	size_ = newBytes;
+#endif
+
+	return Map( true );
+}
+
+int TelemetryMappedFile::Map( bool writable )
+{
+#ifdef WIN32
+	mappingHandle_ = CreateFileMappingA( fileHandle_, NULL, ( writable ) ? PAGE_READWRITE : PAGE_READONLY,
+											static_cast< DWORD >( size_ >> 32 ), static_cast< DWORD >( size_ & 0xFFFFFFFF ), NULL );
+	if( mappingHandle_ == nullptr )
+	{
+		return 1;
+	}
+
+	data_ = static_cast< unsigned char* >( MapViewOfFile( mappingHandle_, ( writable ) ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, static_cast< SIZE_T >( size_ ) ) );
+	if( data_ == nullptr )
+	{
+		CloseHandle( mappingHandle_ );
+		mappingHandle_ = nullptr;
+		return 2;
+	}
+#else
+	void* view = mmap( nullptr, static_cast< size_t >( size_ ), ( writable ) ? ( PROT_READ | PROT_WRITE ) : PROT_READ, MAP_SHARED, fd_, 0 );
+	if( view == MAP_FAILED )
+	{
+		return 2;
+	}
+	data_ = static_cast< unsigned char* >( view );
+#endif
+
+	return 0;
+}
+
+void TelemetryMappedFile::Unmap( void )
+{
+	if( data_ == nullptr )
+	{
+		return;
+	}
+
+#ifdef WIN32
+	if( writable_ )
+	{
+		FlushViewOfFile( data_, 0 );
+	}
+	UnmapViewOfFile( data_ );
+	CloseHandle( mappingHandle_ );
+	mappingHandle_ = nullptr;
+#else
+	if( writable_ )
+	{
+		msync( data_, static_cast< size_t >( size_ ), MS_ASYNC );
+	}
+	munmap( data_, static_cast< size_t >( size_ ) );
+#endif
+
+	data_ = nullptr;
+}
+
+/* Unmap and Close the File
+*   @param truncateBytes - if non-zero (writers only), the file is cut to this size after unmapping
+*/
+void TelemetryMappedFile::Close( uint64_t truncateBytes )
+{
+	Unmap();
+
+#ifdef WIN32
+	if( fileHandle_ != INVALID_HANDLE_VALUE )
+	{
+		if( writable_ && truncateBytes > 0 )
+		{
+			LARGE_INTEGER endPos;
+			endPos.QuadPart = static_cast< LONGLONG >( truncateBytes );
+			if( SetFilePointerEx( fileHandle_, endPos, NULL, FILE_BEGIN ) )
+			{
+				SetEndOfFile( fileHandle_ );
+			}
+		}
+		CloseHandle( fileHandle_ );
+		fileHandle_ = INVALID_HANDLE_VALUE;
+	}
+#else
+	if( fd_ >= 0 )
+	{
+		if( writable_ && truncateBytes > 0 )
+		{
+			if( ftruncate( fd_, static_cast< off_t >( truncateBytes ) ) != 0 )
+			{
+				//Leaves the Preallocated Tail, Readers Use recordCount
+			}
+		}
+		close( fd_ );
+		fd_ = -1;
+	}
+#endif
+
+	size_ = 0;
+}
+
+/******************************************
+
+ TelemetryRecorder
+
+ *******************************************/
+
+TelemetryRecorder::TelemetryRecorder() :
+	indexFile_(nullptr),
+	recordCapacity_(0),
+	indexStride_(defaultIndexStride_),
+	open_(false),
+	recordCount_(0),
+	droppedCount_(0),
+	writer_(nullptr)
+{ }
+
+TelemetryRecorder::~TelemetryRecorder()
+{
+	Close();
+}
+
+/* Create (or Overwrite) a Recording and its Index
+*   @param path - recording file, the index is written to path + ".idx"
+*   @param indexStride - records between index entries
+*   Returns - 0 if opened, otherwise non-zero
+*/
+int TelemetryRecorder::Open( const std::string& path, uint32_t indexStride )
+{
+	Close();
+
+	MMThreadGuard guard( lock_ );
+
+	if( path.empty() )
+	{
+		return 1;
+	}
+
+	if( file_.OpenForWrite( path, sizeof( TelemetryFileHeader ) + initialRecordCapacity_ * sizeof( TelemetryRecord ) ) != 0 )
+	{
+		return 2;
+	}
+
+	if( ( indexFile_ = fopen( ( path + ".idx" ).c_str(), "wb" ) ) == nullptr )
+	{
+		file_.Close();
+		return 3;
+	}
+
+	recordCapacity_ = initialRecordCapacity_;
+	indexStride_ = ( indexStride == 0 ) ? defaultIndexStride_ : indexStride;
+	recordCount_ = 0;
+	droppedCount_ = 0;
+	path_ = path;
+
+	//Records Queued After the Previous Close() Belong to No Recording
+	TelemetryRecord stale;
+	while( queue_.pop( stale ) )
+	{
+	}
+
+	TelemetryFileHeader* header = Header();
+	memset( header, 0, sizeof( TelemetryFileHeader ) );
+	memcpy( header->magic, g_TelemetryMagic, sizeof( g_TelemetryMagic ) );
+	header->version = g_TelemetryVersion;
+	header->recordSize = sizeof( TelemetryRecord );
+	header->recordCount = 0;
+	header->openMonotonicMs = CAlternativeUtils::GetMonotonicTimeMs();
+	header->openWallTimeSec = static_cast< int64_t >( time( nullptr ) );
+	header->indexStride = indexStride_;
+
+	writer_ = new TelemetryWriterThread( *this );
+	writer_->Start();
+
+	open_ = true;
+
+	return 0;
+}
+
+void TelemetryRecorder::Close( void )
+{
+	TelemetryWriterThread* writer = nullptr;
+
+	{
+		MMThreadGuard guard( lock_ );
+
+		if( open_ == false )
+		{
+			return;
+		}
+
+		open_ = false;
+		writer = writer_;
+		writer_ = nullptr;
+	}
+
+	//Joined Outside the Lock, the Writer Takes it Every Pass
+	if( writer != nullptr )
+	{
+		writer->Stop();
+		writer->wait();
+		delete writer;
+	}
+
+	//Records Queued Before open_ Went False
+	WriteQueued();
+
+	MMThreadGuard guard( lock_ );
+
+	file_.Close( sizeof( TelemetryFileHeader ) + recordCount_ * sizeof( TelemetryRecord ) );
+
+	if( indexFile_ != nullptr )
+	{
+		fclose( indexFile_ );
+		indexFile_ = nullptr;
+	}
+
+	path_.clear();
+}
+
+std::string TelemetryRecorder::GetPath( void )
+{
+	MMThreadGuard guard( lock_ );
+	return path_;
+}
+
+/* Queue One Record of Raw Register Bytes For the Writer Thread
+*   Note:  Lock free and no file access, so it is safe inside the serial line lock
+*   Returns - 0 if queued, otherwise non-zero (including when not open and when the queue is full)
+*/
+int TelemetryRecorder::Record( uint8_t kind, uint8_t slaveAddress, uint16_t startRegister, const unsigned char registerBytes[], unsigned int numBytes, uint32_t moveId )
+{
+	if( open_ == false )
+	{
+		return 1;
+	}
+
+	//Copied Out, std::min() Would Bind a Reference to the In-Class Constant (it Has No Definition)
+	unsigned int maxRegisters = TelemetryRecord::maxRegisters_;
+	unsigned int numRegisters = std::min< unsigned int >( numBytes / 2, maxRegisters );
+
+	TelemetryRecord record;
+	memset( &record, 0, sizeof( TelemetryRecord ) );
+	record.timeMs = CAlternativeUtils::GetMonotonicTimeMs();
+	record.moveId = moveId;
+	record.slaveAddress = slaveAddress;
+	record.kind = kind;
+	record.startRegister = startRegister;
+	record.numRegisters = static_cast< uint16_t >( numRegisters );
+	memcpy( record.registerBytes, registerBytes, numRegisters * 2 );
+
+	if( queue_.bounded_push( record ) == false )
+	{
+		droppedCount_.fetch_add( 1, boost::memory_order_relaxed );
+		return 2;
+	}
+
+	return 0;
+}
+
+/* Move the Queued Records Into the File
+*   Note:  The file is doubled while a full queue's worth of headroom is left, so growth normally happens ahead of the records
+*   Note:  A record is complete before the header count includes it, so a reader never sees a partial record
+*   Note:  The index is flushed once per pass
+*/
+void TelemetryRecorder::WriteQueued( void )
+{
+	MMThreadGuard guard( lock_ );
+
+	if( file_.IsOpen() == false )
+	{
+		return;
+	}
+
+	bool indexWritten = false;
+	TelemetryRecord queued;
+
+	while( queue_.pop( queued ) )
+	{
+		uint64_t recordNumber = recordCount_;
+
+		if( recordNumber + queueCapacity_ >= recordCapacity_ &&
+			file_.Resize( sizeof( TelemetryFileHeader ) + 2 * recordCapacity_ * sizeof( TelemetryRecord ) ) == 0 )
+		{
+			recordCapacity_ *= 2;
+		}
+
+		//A Failed Resize May Leave the File Unmapped
+		if( file_.Data() == nullptr || recordNumber >= recordCapacity_ )
+		{
+			droppedCount_.fetch_add( 1, boost::memory_order_relaxed );
+			continue;
+		}
+
+		Records()[ recordNumber ] = queued;
+
+		if( recordNumber % indexStride_ == 0 && indexFile_ != nullptr )
+		{
+			TelemetryIndexEntry entry;
+			entry.timeMs = queued.timeMs;
+			entry.recordNumber = recordNumber;
+			fwrite( &entry, sizeof( entry ), 1, indexFile_ );
+			indexWritten = true;
+		}
+
+		recordCount_ = recordNumber + 1;
+		Header()->recordCount = recordNumber + 1;
+	}
+
+	if( indexWritten )
+	{
+		fflush( indexFile_ );
+	}
+}
+
+/******************************************
+
+ TelemetryWriterThread
+
+ *******************************************/
+
+int TelemetryWriterThread::svc( void )
+{
+	while( stop_ == false )
+	{
+		recorder_.WriteQueued();
+		CAlternativeUtils::SleepMs( writeIntervalMS_ );
+	}
+
+	return 0;
+}
+
+/******************************************
+
+ TelemetryRecordReader
+
+ *******************************************/
+
+TelemetryRecordReader::TelemetryRecordReader() :
+	recordCount_(0)
+{ }
+
+TelemetryRecordReader::~TelemetryRecordReader()
+{
+	Close();
+}
+
+/* Map a Recording and Load its Index (A Missing Index Falls Back to Binary Search)
+*   Returns - 0 if the file is a valid recording, otherwise non-zero
+*/
+int TelemetryRecordReader::Open( const std::string& path )
+{
+	Close();
+
+	if( file_.OpenForRead( path ) != 0 )
+	{
+		return 1;
+	}
+
+	const TelemetryFileHeader* header = GetHeader();
+	if( file_.Size() < sizeof( TelemetryFileHeader ) || memcmp( header->magic, g_TelemetryMagic, sizeof( g_TelemetryMagic ) ) != 0
+			|| header->version != g_TelemetryVersion || header->recordSize != sizeof( TelemetryRecord ) )
+	{
+		Close();
+		return 2;
+	}
+
+	//Never Trust the Count Past the Mapped Bytes (Truncated or Still-Growing Files)
+	uint64_t mappedRecords = ( file_.Size() - sizeof( TelemetryFileHeader ) ) / sizeof( TelemetryRecord );
+	recordCount_ = std::min( header->recordCount, mappedRecords );
+
+	FILE* indexFile = fopen( ( path + ".idx" ).c_str(), "rb" );
+	if( indexFile != nullptr )
+	{
+		TelemetryIndexEntry entry;
+		while( fread( &entry, sizeof( entry ), 1, indexFile ) == 1 && entry.recordNumber < recordCount_ )
+		{
+			index_.push_back( entry );
+		}
+		fclose( indexFile );
+	}
+
+	return 0;
+}
+
+void TelemetryRecordReader::Close( void )
+{
+	file_.Close();
+	recordCount_ = 0;
+	index_.clear();
+}
+
+const TelemetryFileHeader* TelemetryRecordReader::GetHeader( void ) const
+{
+	return reinterpret_cast< const TelemetryFileHeader* >( const_cast< TelemetryMappedFile& >( file_ ).Data() );
+}
+
+const TelemetryRecord* TelemetryRecordReader::GetRecord( uint64_t recordNumber ) const
+{
+	if( recordNumber >= recordCount_ )
+	{
+		return nullptr;
+	}
+
+	return reinterpret_cast< const TelemetryRecord* >( const_cast< TelemetryMappedFile& >( file_ ).Data() + sizeof( TelemetryFileHeader ) ) + recordNumber;
+}
+
+/* Seek by Time
+*   Note:  The index narrows the search to one stride of records, which is then binary searched (records are time ordered)
+*   @param timeMs - monotonic time (same clock as TelemetryRecord::timeMs)
+*   Returns - number of the first record at or after timeMs, or GetRecordCount() if there is none
+*/
+uint64_t TelemetryRecordReader::FindFirstRecordAtOrAfter( double timeMs ) const
+{
+	uint64_t low = 0;
+	uint64_t high = recordCount_;
+
+	//Last Index Entry Before timeMs Bounds the Search From Below, the Next Entry From Above
+	for( size_t i = 0; i < index_.size(); i++ )
+	{
+		if( index_[i].timeMs < timeMs )
+		{
+			low = index_[i].recordNumber;
+		}
+		else
+		{
+			high = std::min( high, index_[i].recordNumber + 1 );
+			break;
+		}
+	}
+
+	while( low < high )
+	{
+		uint64_t mid = low + ( high - low ) / 2;
+		if( GetRecord( mid )->timeMs < timeMs )
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+double TelemetryRecordReader::ToWallTimeSec( double timeMs ) const
+{
+	const TelemetryFileHeader* header = GetHeader();
+	return static_cast< double >( header->openWallTimeSec ) + ( timeMs - header->openMonotonicMs ) / 1000.0;
+}
@@ -0,0 +1,231 @@
+#ifndef _TELEMETRY_RECORDER_
+#define _TELEMETRY_RECORDER_
+
+#include "OrientalCoreDefs.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <boost/lockfree/queue.hpp>
+#include <boost/static_assert.hpp>
+
+/*
+*  Binary Telemetry Recording
+*     Fixed-Size Records Appended to a Memory-Mapped File That Grows by Remapping
+*     Record() Only Queues the Record; a Writer Thread Copies it Into the File, Grows the File and Writes the Index
+*     File Layout:  TelemetryFileHeader, then TelemetryFileHeader::recordCount TelemetryRecords
+*     Index Layout (<file>.idx):  TelemetryIndexEntry For Every indexStride'th Record
+*     All Values Are Stored in Host Byte Order, Register Bytes Are Stored as Received (Big Endian)
+*/
+
+//Record Kinds
+enum TelemetryRecordKind
+{
+	TelemetryRegisterBlock = 1,		//Registers Read From a Slave (Status Polls, Readback, Telemetry Samples)
+	TelemetryMove = 2				//Position Written to a Slave, Starts a New Move ID
+};
+
+struct TelemetryRecord
+{
+	double timeMs;					//CAlternativeUtils::GetMonotonicTimeMs() When Recorded
+	uint32_t moveId;				//Slave's Most Recent Move ID (0 Before the First Move)
+	uint8_t slaveAddress;
+	uint8_t kind;					//TelemetryRecordKind
+	uint16_t startRegister;
+	uint16_t numRegisters;			//Registers Held in registerBytes (Truncated to maxRegisters_)
+	uint16_t reserved;
+	unsigned char registerBytes[44];
+
+	static const unsigned int maxRegisters_ = 22;
+};
+
+struct TelemetryFileHeader
+{
+	char magic[8];					//"OMTREC" Followed by Two Zero Bytes
+	uint32_t version;
+	uint32_t recordSize;			//sizeof( TelemetryRecord )
+	uint64_t recordCount;			//Records Committed So Far
+	double openMonotonicMs;			//Monotonic Clock When the File Was Created
+	int64_t openWallTimeSec;		//time() When the File Was Created, to Convert Record Times to Wall Time
+	uint32_t indexStride;
+	unsigned char reserved[20];
+};
+
+struct TelemetryIndexEntry
+{
+	double timeMs;
+	uint64_t recordNumber;
+};
+
+//Layouts Are Part of the File Format
+BOOST_STATIC_ASSERT( sizeof( TelemetryRecord ) == 64 );
+BOOST_STATIC_ASSERT( sizeof( TelemetryFileHeader ) == 64 );
+BOOST_STATIC_ASSERT( sizeof( TelemetryIndexEntry ) == 16 );
+
+/*  Platform Wrapper Around a Memory-Mapped File
+*     Writers Map the Whole File Read/Write and Grow it by Unmapping, Extending and Remapping
+*     Readers Map the Whole File Read Only
+*/
+class TelemetryMappedFile
+{
+	public:
+		TelemetryMappedFile();
+		~TelemetryMappedFile();
+
+		int OpenForWrite( const std::string& path, uint64_t initialBytes );
+		int OpenForRead( const std::string& path );
+		//Writers Only: Extend the File and Remap (Invalidates Previous Data() Pointers)
+		int Resize( uint64_t newBytes );
+		//Writers May Truncate to the Bytes Actually Used
+		void Close( uint64_t truncateBytes = 0 );
+
+		unsigned char* Data( void ) { return data_; }
+		uint64_t Size( void ) const { return size_; }
+		bool IsOpen( void ) const { return data_ != nullptr; }
+
+	private:
+		int Map( bool writable );
+		void Unmap( void );
+
+		unsigned char* data_;
+		uint64_t size_;
+		bool writable_;
+#ifdef WIN32
+		void* fileHandle_;
+		void* mappingHandle_;
+#else
+		int fd_;
+#endif
+
+		TelemetryMappedFile( const TelemetryMappedFile& );
+		TelemetryMappedFile& operator=( const TelemetryMappedFile& );
+};
+
+class TelemetryWriterThread;
+
+/*  Appends TelemetryRecords From Any Thread
+*     Note:  IsOpen() is Lock Free, so Callers Can Skip Building a Record When Recording is Off
+*     Note:  Record() Never Blocks or Touches the File (Callers Hold the Serial Line), a Full Queue Drops the Record and Counts it
+*/
+class TelemetryRecorder
+{
+	public:
+		static const uint64_t initialRecordCapacity_ = 16384;
+		static const uint32_t defaultIndexStride_ = 1024;
+		static const unsigned int queueCapacity_ = 4096;
+
+		TelemetryRecorder();
+		~TelemetryRecorder();
+
+		/* Create (or Overwrite) a Recording and its Index
+		*   @param path - recording file, the index is written to path + ".idx"
+		*   Returns - 0 if opened, otherwise non-zero
+		*/
+		int Open( const std::string& path, uint32_t indexStride = defaultIndexStride_ );
+		//Write the Queued Records, Truncate the Recording to the Records Written and Close it
+		void Close( void );
+
+		bool IsOpen( void ) const { return open_; }
+		std::string GetPath( void );
+		//Records Written to the File (Queued Records Are Not Counted Until the Writer Thread Has Written Them)
+		uint64_t GetRecordCount( void ) const { return recordCount_; }
+		//Records Dropped Because the Queue Was Full Since Open()
+		uint64_t GetDroppedCount( void ) const { return droppedCount_; }
+
+		/* Queue One Record of Raw Register Bytes For the Writer Thread
+		*   @param kind - TelemetryRecordKind
+		*   @param slaveAddress - Modbus address of the slave the registers belong to
+		*   @param startRegister - address of the first register in registerBytes
+		*   @param registerBytes[] - register bytes as transferred on the line
+		*   @param numBytes - bytes in registerBytes (truncated to TelemetryRecord::maxRegisters_ registers)
+		*   @param moveId - slave's current move ID
+		*   Returns - 0 if queued, otherwise non-zero (including when not open and when the queue is full)
+		*/
+		int Record( uint8_t kind, uint8_t slaveAddress, uint16_t startRegister, const unsigned char registerBytes[], unsigned int numBytes, uint32_t moveId );
+
+	private:
+		friend class TelemetryWriterThread;
+
+		typedef boost::lockfree::queue< TelemetryRecord, boost::lockfree::capacity< queueCapacity_ > > RecordQueue;
+
+		//Writer Thread (and Close()):  Move the Queued Records Into the File
+		void WriteQueued( void );
+
+		TelemetryFileHeader* Header( void ) { return reinterpret_cast< TelemetryFileHeader* >( file_.Data() ); }
+		TelemetryRecord* Records( void ) { return reinterpret_cast< TelemetryRecord* >( file_.Data() + sizeof( TelemetryFileHeader ) ); }
+
+		MMThreadLock lock_;
+		TelemetryMappedFile file_;
+		FILE* indexFile_;
+		std::string path_;
+		uint64_t recordCapacity_;
+		uint32_t indexStride_;
+		boost::atomic<bool> open_;
+		boost::atomic<uint64_t> recordCount_;
+		boost::atomic<uint64_t> droppedCount_;
+		RecordQueue queue_;
+		TelemetryWriterThread* writer_;
+
+		TelemetryRecorder( const TelemetryRecorder& );
+		TelemetryRecorder& operator=( const TelemetryRecorder& );
+};
+
+/*  Writer Thread: Wakes Every Few Milliseconds and Writes the Recorder's Queue Into the File
+*/
+class TelemetryWriterThread : public MMDeviceThreadBase
+{
+	public:
+		static const long writeIntervalMS_ = 5;
+
+		explicit TelemetryWriterThread( TelemetryRecorder& recorder ) : recorder_(recorder), stop_(false) {}
+
+		int svc( void );
+		int open (void*) { return 0;}
+		int close(unsigned long) {return 0;}
+
+		void Start() { stop_ = false; activate(); }
+		void Stop() { stop_ = true; }
+
+	private:
+		TelemetryRecorder& recorder_;
+		boost::atomic<bool> stop_;
+
+		TelemetryWriterThread& operator=( const TelemetryWriterThread& );
+};
+
+/*  Read-Only Access to a Recording (May Be Opened While it is Still Being Written; Sees the Records at Open)
+*/
+class TelemetryRecordReader
+{
+	public:
+		TelemetryRecordReader();
+		~TelemetryRecordReader();
+
+		/* Map a Recording and Load its Index (A Missing Index Falls Back to Binary Search)
+		*   Returns - 0 if the file is a valid recording, otherwise non-zero
+		*/
+		int Open( const std::string& path );
+		void Close( void );
+
+		uint64_t GetRecordCount( void ) const { return recordCount_; }
+		const TelemetryFileHeader* GetHeader( void ) const;
+		//Returns - the Record, or nullptr if recordNumber is Out of Range
+		const TelemetryRecord* GetRecord( uint64_t recordNumber ) const;
+
+		/* Seek by Time
+		*   @param timeMs - monotonic time (same clock as TelemetryRecord::timeMs)
+		*   Returns - number of the first record at or after timeMs, or GetRecordCount() if there is none
+		*/
+		uint64_t FindFirstRecordAtOrAfter( double timeMs ) const;
+
+		//Convert a Record Time to Seconds Since the Epoch Using the Header's Open Times
+		double ToWallTimeSec( double timeMs ) const;
+
+	private:
+		TelemetryMappedFile file_;
+		uint64_t recordCount_;
+		std::vector< TelemetryIndexEntry > index_;
+};
+
+#endif
@@ -0,0 +1,106 @@
+/*
+*  Bus Statistics Percentiles Stay Within a Bucket of the True Value and Reset Clears Every Slice
+*     A Percentile is the Upper Bound of its Bucket Capped at the Max, so it is Never Below the True Value and at Most 25% Above
+*/
+#include "CoreTestSupport.h"
+#include "BusStatistics.h"
+
+//True Percentile Bound:  At or Above the Exact Value, Within the Histogram's 25%
+static bool WithinBucket( uint32_t exactUs, uint32_t reportedUs )
+{
+	return reportedUs >= exactUs && static_cast< double >( reportedUs ) <= exactUs * 1.25;
+}
+
+int main( void )
+{
+	LatencyHistogram histogram;
+
+	//No Samples
+	CORE_CHECK_EQUAL( 0, histogram.GetCount() );
+	CORE_CHECK_EQUAL( 0, histogram.GetPercentileUs( 50 ) );
+	CORE_CHECK_EQUAL( 0, histogram.GetMaxUs() );
+
+	//A Single Sample is Every Percentile; Small Values Have Exact Buckets, Large Ones Are Capped at the Max
+	const uint32_t singles[] = { 0, 1, 3, 4, 5, 7, 8, 100, 1000, 65535, 1000000, 0xFFFFFFFF };
+	for( size_t i = 0; i < sizeof( singles ) / sizeof( singles[0] ); i++ )
+	{
+		histogram.Reset();
+		histogram.Record( singles[i] );
+		CORE_CHECK_EQUAL( 1, histogram.GetCount() );
+		CORE_CHECK_EQUAL( singles[i], histogram.GetPercentileUs( 50 ) );
+		CORE_CHECK_EQUAL( singles[i], histogram.GetMaxUs() );
+	}
+
+	//1..1000 us:  p50 = 500, p99 = 990
+	histogram.Reset();
+	for( uint32_t us = 1; us <= 1000; us++ )
+	{
+		histogram.Record( us );
+	}
+	CORE_CHECK_EQUAL( 1000, histogram.GetCount() );
+	CORE_CHECK_EQUAL( 1000, histogram.GetMaxUs() );
+	CORE_CHECK( WithinBucket( 500, histogram.GetPercentileUs( 50 ) ) );
+	CORE_CHECK( WithinBucket( 990, histogram.GetPercentileUs( 99 ) ) );
+	CORE_CHECK_EQUAL( 1000, histogram.GetPercentileUs( 100 ) );
+	CORE_CHECK_EQUAL( 1, histogram.GetPercentileUs( 0 ) );
+
+	//A Slow Tail Shows in p99 and the Max but Not in p50
+	histogram.Reset();
+	for( unsigned int i = 0; i < 980; i++ )
+	{
+		histogram.Record( 2000 );
+	}
+	for( unsigned int i = 0; i < 20; i++ )
+	{
+		histogram.Record( 50000 );
+	}
+	CORE_CHECK( WithinBucket( 2000, histogram.GetPercentileUs( 50 ) ) );
+	CORE_CHECK( WithinBucket( 50000, histogram.GetPercentileUs( 99 ) ) );
+	CORE_CHECK_EQUAL( 50000, histogram.GetMaxUs() );
+
+	histogram.Reset();
+	CORE_CHECK_EQUAL( 0, histogram.GetCount() );
+	CORE_CHECK_EQUAL( 0, histogram.GetMaxUs() );
+	CORE_CHECK_EQUAL( 0, histogram.GetPercentileUs( 99 ) );
+
+	//Slices:  Known Function Codes Have Their Own Slot, Addresses Above maxSlaveAddress_ Share the Last
+	BusStatistics stats;
+	stats.Record( 1, 0x03, BusOutcomeOk, 800 );
+	stats.Record( 1, 0x10, BusOutcomeTimeout, 20000 );
+	stats.Record( 2, 0x06, BusOutcomeCrcError, 900 );
+	stats.Record( 40, 0x2B, BusOutcomeException, 700 );
+	stats.RecordRetry( 1, 0x10 );
+	stats.RecordBusyReject( 2, 0x06 );
+
+	CORE_CHECK_EQUAL( 4, stats.GetTotal().GetTransactions() );
+	CORE_CHECK_EQUAL( 1, stats.GetTotal().GetTimeouts() );
+	CORE_CHECK_EQUAL( 1, stats.GetTotal().GetCrcErrors() );
+	CORE_CHECK_EQUAL( 1, stats.GetTotal().GetExceptions() );
+	CORE_CHECK_EQUAL( 1, stats.GetTotal().GetRetries() );
+	CORE_CHECK_EQUAL( 1, stats.GetTotal().GetBusyRejects() );
+	CORE_CHECK_EQUAL( 20000, stats.GetTotal().GetLatency().GetMaxUs() );
+	CORE_CHECK_EQUAL( 1, stats.GetByFunction( BusStatistics::FnRead ).GetTransactions() );
+	CORE_CHECK_EQUAL( 1, stats.GetByFunction( BusStatistics::FnMultiWrite ).GetRetries() );
+	CORE_CHECK_EQUAL( 1, stats.GetByFunction( BusStatistics::FnOther ).GetExceptions() );
+	CORE_CHECK_EQUAL( 2, stats.GetBySlave( 1 ).GetTransactions() );
+	CORE_CHECK( WithinBucket( 800, stats.GetBySlave( 1 ).GetLatency().GetPercentileUs( 50 ) ) );
+	CORE_CHECK_EQUAL( 1, stats.GetBySlave( 99 ).GetTransactions() );
+	CORE_CHECK_EQUAL( 1, stats.GetBySlave( BusStatistics::maxSlaveAddress_ + 1 ).GetTransactions() );
+
+	stats.Reset();
+	CORE_CHECK_EQUAL( 0, stats.GetTotal().GetTransactions() );
+	CORE_CHECK_EQUAL( 0, stats.GetTotal().GetRetries() );
+	CORE_CHECK_EQUAL( 0, stats.GetTotal().GetBusyRejects() );
+	CORE_CHECK_EQUAL( 0, stats.GetTotal().GetLatency().GetCount() );
+	CORE_CHECK_EQUAL( 0, stats.GetTotal().GetLatency().GetMaxUs() );
+	for( unsigned int slot = 0; slot < BusStatistics::NumFunctionSlots; slot++ )
+	{
+		CORE_CHECK_EQUAL( 0, stats.GetByFunction( static_cast< BusStatistics::FunctionSlot >( slot ) ).GetTransactions() );
+	}
+	for( unsigned int address = 0; address <= BusStatistics::maxSlaveAddress_ + 1; address++ )
+	{
+		CORE_CHECK_EQUAL( 0, stats.GetBySlave( static_cast< uint8_t >( address ) ).GetLatency().GetCount() );
+	}
+
+	return CoreTestResult( "BusStatisticsTest" );
+}
@@ -0,0 +1,79 @@
+/*
+*  Controller Log Statements Format on the Log Thread as Written
+*     "{}" and "{x}" Take the Arguments in Order, Placeholders Past the Last Argument Are Left in Place,
+*     and Text Past ControllerLogRecord::maxTextBytes_ is Cut Without Losing the Numeric Arguments
+*/
+#include "CoreTestSupport.h"
+#include "ControllerLog.h"
+#include <string>
+#include <vector>
+
+//Keeps Every Formatted Record
+class CapturingSink : public ControllerLogSink
+{
+	public:
+		void LogMessage( const char* text, bool /*debugOnly*/ ) { messages_.push_back( text ); }
+
+		std::vector< std::string > messages_;
+};
+
+int main( void )
+{
+	CapturingSink sink;
+	CORE_CHECK_EQUAL( 0, ControllerLog::Attach( &sink ) );
+	sink.SetLevel( LogLevelInfo );
+
+	//Outside Any Scope a Statement Has No Sink
+	ORIENTAL_LOG_ERROR( "Unscoped" );
+	ControllerLogScope logScope( &sink );
+
+	const unsigned char frame[] = { 0x01, 0xAB, 0xFF };
+	std::string longText( ControllerLogRecord::maxTextBytes_ + 40, 'a' );
+
+	ORIENTAL_LOG_INFO( "Slave {} Register {x}", 3u, 0x118u );
+	ORIENTAL_LOG_INFO( "Signed {} Hex {x}", -5, -1 );
+	ORIENTAL_LOG_INFO( "Speed {} Name {}", 1.5, "Focus" );
+	ORIENTAL_LOG_INFO( "Frame [{}]", ORIENTAL_LOG_BYTES( frame, sizeof( frame ) ) );
+	ORIENTAL_LOG_INFO( "a {} b {} c {x}", 7 );
+	ORIENTAL_LOG_INFO( "No Arguments {} {x}" );
+	ORIENTAL_LOG_INFO( "Not Placeholders {y} { } {", 1 );
+	ORIENTAL_LOG_INFO( "{}|{}|{}", longText, "dropped", 42 );
+	//Below the Run-Time Level
+	ORIENTAL_LOG_WARN( "Warn Kept" );
+	sink.SetLevel( LogLevelError );
+	ORIENTAL_LOG_WARN( "Warn Filtered" );
+
+	//Flushes the Ring Into sink
+	ControllerLog::Detach( &sink );
+
+	const char* expected[] = {
+		"Slave 3 Register 0x118",
+		"Signed -5 Hex 0xFFFFFFFFFFFFFFFF",
+		"Speed 1.5 Name Focus",
+		"Frame [01 AB FF]",
+		"a 7 b {} c {x}",
+		"No Arguments {} {x}",
+		"Not Placeholders {y} { } {",
+		nullptr,
+		"Warn Kept"
+	};
+	const size_t numExpected = sizeof( expected ) / sizeof( expected[0] );
+
+	CORE_CHECK_EQUAL( numExpected, sink.messages_.size() );
+	for( size_t i = 0; i < numExpected && i < sink.messages_.size(); i++ )
+	{
+		if( expected[i] != nullptr )
+		{
+			CORE_CHECK( sink.messages_[i] == expected[i] );
+		}
+	}
+
+	//Long Text Fills the Record, the Next Text Argument Gets Nothing, the Number Still Formats
+	if( sink.messages_.size() > 7 )
+	{
+		std::string truncated( ControllerLogRecord::maxTextBytes_, 'a' );
+		CORE_CHECK( sink.messages_[7] == truncated + "||42" );
+	}
+
+	return CoreTestResult( "ControllerLogFormatTest" );
+}
@@ -0,0 +1,157 @@
+/*
+*  Profiles Load From a File, Bad Settings Are Rejected Before Anything is Written,
+*  and Consecutive Registers Go Out as Multi-Writes of at Most maxProfileWriteRegs_ (10) Registers in Address Order
+*/
+#include "CoreTestSupport.h"
+#include "FrameRecordingTransport.h"
+#include "ControllerProfile.h"
+#include "OrientalCRK525PMAKD.h"
+#include "ControllerStatusMonitorThread.h"
+#include "SerialControllerBus.h"
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+static const uint8_t g_MultiWriteFunction = 0x10;
+
+static ControllerProfileSetting Setting( const char* registerName, long long value )
+{
+	ControllerProfileSetting setting;
+	setting.registerName = registerName;
+	setting.value = value;
+	setting.line = 1;
+	return setting;
+}
+
+//A Profile of One Setting That Must Not Validate
+static bool Rejected( OrientalCRK525MAKD& controller, const char* registerName, long long value )
+{
+	ControllerProfile profile;
+	profile.name = "Bad";
+	profile.settings.push_back( Setting( registerName, value ) );
+	std::string error;
+	return controller.ValidateProfile( profile, error ) != 0 && !error.empty();
+}
+
+static bool WriteText( const std::string& path, const char* text )
+{
+	FILE* file = fopen( path.c_str(), "w" );
+	if( file == nullptr )
+	{
+		return false;
+	}
+	fputs( text, file );
+	fclose( file );
+	return true;
+}
+
+int main( int argc, char* argv[] )
+{
+	std::string path = ( argc > 1 ) ? argv[1] : "ControllerProfileTest.profiles";
+	std::vector< ControllerProfile > profiles;
+	std::string error;
+
+	//Load:  Names, Decimal, Hex and Negative Values, Comments
+	CORE_CHECK( WriteText( path, "# Focus Profiles\n[Slow]\noperatingCurrent = 50\nstartSpeed = 0x64  # Hex\n\n[Limits]\nnegativeSoftwareLimit = -1000\n" ) );
+	CORE_CHECK_EQUAL( 0, ControllerProfileFile::Load( path, profiles, error ) );
+	CORE_CHECK_EQUAL( 2, profiles.size() );
+	if( profiles.size() == 2 )
+	{
+		CORE_CHECK( profiles[0].name == "Slow" );
+		CORE_CHECK_EQUAL( 2, profiles[0].settings.size() );
+		CORE_CHECK_EQUAL( 100, profiles[0].settings[1].value );
+		CORE_CHECK_EQUAL( -1000, profiles[1].settings[0].value );
+	}
+
+	//Syntax Errors Leave No Profiles
+	CORE_CHECK( WriteText( path, "[Slow]\noperatingCurrent = 50\nstartSpeed 100\n" ) );
+	CORE_CHECK( ControllerProfileFile::Load( path, profiles, error ) != 0 );
+	CORE_CHECK( profiles.empty() );
+	CORE_CHECK( WriteText( path, "operatingCurrent = 50\n" ) );
+	CORE_CHECK( ControllerProfileFile::Load( path, profiles, error ) != 0 );
+	CORE_CHECK( WriteText( path, "[Slow]\nstartSpeed = 12abc\n" ) );
+	CORE_CHECK( ControllerProfileFile::Load( path, profiles, error ) != 0 );
+	remove( path.c_str() );
+
+	SimulatedCRKTransport simulated;
+	simulated.SetUsbLatencyMs( 0 );
+	simulated.SetBaudRate( 1000000000 );
+	FrameRecordingTransport recording( &simulated );
+	SerialControllerBus bus( &recording );
+	OrientalCRK525MAKD controller( &bus, &ControllerBus::SerialCommunicate );
+	controller.setAddress( 1 );
+
+	//Values the Register Does Not Accept (operatingCurrent is 5 - 100%, standstillCurrent 5 - 50%) or That Do Not Fit its Width
+	CORE_CHECK( Rejected( controller, "operatingCurrent", 200 ) );
+	CORE_CHECK( Rejected( controller, "standstillCurrent", 0 ) );
+	CORE_CHECK( Rejected( controller, "operatingCurrent", 0x10000 ) );
+	CORE_CHECK( Rejected( controller, "startSpeed", 0x100000000LL ) );
+	CORE_CHECK( Rejected( controller, "accelRateType", 7 ) );
+
+	//Unknown Names and Addresses Outside the Parameter Area (posReg, the System Parameters)
+	CORE_CHECK( Rejected( controller, "noSuchRegister", 1 ) );
+	CORE_CHECK( Rejected( controller, "0x001C", 1 ) );
+	CORE_CHECK( Rejected( controller, "0x0380", 1 ) );
+	CORE_CHECK( Rejected( controller, "0x0228x", 1 ) );
+
+	//The Same Register Twice, by Name and by Address
+	ControllerProfile duplicate;
+	duplicate.name = "Duplicate";
+	duplicate.settings.push_back( Setting( "startSpeed", 100 ) );
+	duplicate.settings.push_back( Setting( "0x0228", 200 ) );
+	CORE_CHECK( controller.ValidateProfile( duplicate, error ) != 0 );
+
+	//A Rejected Profile Writes Nothing
+	recording.ClearFrames();
+	CORE_CHECK( controller.ApplyProfile( duplicate ) != 0 );
+	CORE_CHECK( recording.GetFrames().empty() );
+
+	//Out of Order Settings:  0x0224 - 0x0229 Merge, 0x021E - 0x021F Merge, the Gap at 0x0220 Starts a New Write
+	ControllerProfile merged;
+	merged.name = "Merged";
+	merged.settings.push_back( Setting( "startSpeed", 100 ) );
+	merged.settings.push_back( Setting( "standstillCurrent", 25 ) );
+	merged.settings.push_back( Setting( "commonAccelRate", 30000 ) );
+	merged.settings.push_back( Setting( "operatingCurrent", 50 ) );
+	merged.settings.push_back( Setting( "commonDecelRate", 30000 ) );
+	CORE_CHECK_EQUAL( 0, controller.ValidateProfile( merged, error ) );
+	recording.ClearFrames();
+	CORE_CHECK_EQUAL( 0, controller.ApplyProfile( merged ) );
+	CORE_CHECK_EQUAL( 2, recording.GetFrames().size() );
+	if( recording.GetFrames().size() == 2 )
+	{
+		CORE_CHECK_EQUAL( g_MultiWriteFunction, recording.GetFrames()[0][1] );
+		CORE_CHECK_EQUAL( 0x021E, FrameStartAddress( recording.GetFrames()[0] ) );
+		CORE_CHECK_EQUAL( 2, FrameRegisterCount( recording.GetFrames()[0] ) );
+		CORE_CHECK_EQUAL( 0x0224, FrameStartAddress( recording.GetFrames()[1] ) );
+		CORE_CHECK_EQUAL( 6, FrameRegisterCount( recording.GetFrames()[1] ) );
+		//startSpeed's Low Word Ends the Values, Ahead of the CRC
+		const std::vector< unsigned char >& frame = recording.GetFrames()[1];
+		CORE_CHECK_EQUAL( 100, frame[ frame.size() - 3 ] );
+	}
+
+	//Home Seeking 0x023A - 0x0245 is 12 Consecutive Registers:  Capped at 10, the Last Two Go in a Second Write
+	ControllerProfile capped;
+	capped.name = "Capped";
+	capped.settings.push_back( Setting( "0x0245", 10 ) );
+	capped.settings.push_back( Setting( "0x0244", 0 ) );
+	capped.settings.push_back( Setting( "0x0243", 0 ) );
+	capped.settings.push_back( Setting( "0x0242", 1 ) );
+	capped.settings.push_back( Setting( "0x0240", 0 ) );
+	capped.settings.push_back( Setting( "0x023E", 500 ) );
+	capped.settings.push_back( Setting( "0x023C", 1000 ) );
+	capped.settings.push_back( Setting( "0x023A", 1000 ) );
+	CORE_CHECK_EQUAL( 0, controller.ValidateProfile( capped, error ) );
+	recording.ClearFrames();
+	CORE_CHECK_EQUAL( 0, controller.ApplyProfile( capped ) );
+	CORE_CHECK_EQUAL( 2, recording.GetFrames().size() );
+	if( recording.GetFrames().size() == 2 )
+	{
+		CORE_CHECK_EQUAL( 0x023A, FrameStartAddress( recording.GetFrames()[0] ) );
+		CORE_CHECK_EQUAL( 10, FrameRegisterCount( recording.GetFrames()[0] ) );
+		CORE_CHECK_EQUAL( 0x0244, FrameStartAddress( recording.GetFrames()[1] ) );
+		CORE_CHECK_EQUAL( 2, FrameRegisterCount( recording.GetFrames()[1] ) );
+	}
+
+	return CoreTestResult( "ControllerProfileTest" );
+}
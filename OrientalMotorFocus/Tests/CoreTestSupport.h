@@ -0,0 +1,26 @@
+#ifndef _CORE_TEST_SUPPORT_
+#define _CORE_TEST_SUPPORT_
+
+#include <stdio.h>
+
+/*
+*  Checks For the Controller Core Tests
+*     Every Test is its Own Executable Registered With ctest; a Failed Check Prints Where it Failed and the Test Keeps Going
+*     main() Returns CoreTestResult(), Non-Zero if Any Check Failed
+*/
+static int g_CoreTestFailures = 0;
+
+#define CORE_CHECK( condition ) \
+	do { if( !( condition ) ) { fprintf( stderr, "%s(%d): CORE_CHECK( %s ) Failed\n", __FILE__, __LINE__, #condition ); g_CoreTestFailures++; } } while( 0 )
+
+#define CORE_CHECK_EQUAL( expected, actual ) \
+	do { long long e_ = (long long)( expected ), a_ = (long long)( actual ); \
+		if( e_ != a_ ) { fprintf( stderr, "%s(%d): CORE_CHECK_EQUAL( %s, %s ) Failed, %lld != %lld\n", __FILE__, __LINE__, #expected, #actual, e_, a_ ); g_CoreTestFailures++; } } while( 0 )
+
+static int CoreTestResult( const char* name )
+{
+	printf( "%s: %d Failed Check(s)\n", name, g_CoreTestFailures );
+	return ( g_CoreTestFailures == 0 ) ? 0 : 1;
+}
+
+#endif
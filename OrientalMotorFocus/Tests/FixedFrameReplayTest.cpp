@@ -0,0 +1,185 @@
+/*
+*  Every Fixed Frame Must be the Request the Run-Time Builders Send in its Place
+*     The Builders' Requests Are Captured Over the Simulated Slaves, Then the Fixed Frames Are Replayed Against the Capture
+*     Broadcast Frames Have No Run-Time Builder:  The Capture Holds the Builders' Addressed Request With Slave Address 0
+*     and its CRC Recomputed, Which Each Broadcast Frame Must Equal
+*     Usage:  FixedFrameReplayTest [capture file]
+*/
+#include "CoreTestSupport.h"
+#include "OrientalCRK525PMAKD.h"
+#include "SerialControllerBus.h"
+#include "SerialTransport.h"
+#include <string.h>
+#include <string>
+
+//Bytes of the Modbus CRC Closing Every Frame
+static const int g_CRCBytes = 2;
+
+/*  Forwards to a Transport, Keeping the Last Frame Written (Broadcast Frames Are Derived From it)
+*/
+class LastFrameTransport : public SerialTransport
+{
+	public:
+		LastFrameTransport( SerialTransport* wrapped ) : wrapped_(wrapped), len_(0) {}
+
+		int Configure( unsigned long baudRate ) { return wrapped_->Configure( baudRate ); }
+		int Write( const unsigned char buffer[], unsigned long len, unsigned long& bytesWritten )
+		{
+			len_ = ( len < sizeof( bytes_ ) ) ? len : sizeof( bytes_ );
+			memcpy( bytes_, buffer, len_ );
+			return wrapped_->Write( buffer, len, bytesWritten );
+		}
+		int Read( unsigned char buffer[], unsigned long len, unsigned long& bytesRead ) { return wrapped_->Read( buffer, len, bytesRead ); }
+
+		const unsigned char* GetBytes( void ) const { return bytes_; }
+		unsigned long GetLen( void ) const { return len_; }
+
+	private:
+		SerialTransport* wrapped_;
+		unsigned char bytes_[ 64 ];
+		unsigned long len_;
+};
+
+/*  Access to the Controller's Fixed Frames and the Run-Time Builders They Replace
+*/
+class ControllerCoreTest
+{
+	public:
+		static const int numFixedFrames_ = OrientalCRK525MAKD::NumFixedFrames;
+
+		static bool IsBroadcast( int id ) { return id >= OrientalCRK525MAKD::FrameBroadcastStart; }
+
+		static int SendFixedFrame( OrientalCRK525MAKD& controller, int id ) { return controller.SendFixedFrame( static_cast< OrientalCRK525MAKD::FixedFrameId >( id ) ); }
+
+		/* Send the Request Fixed Frame id Stands For Through the Run-Time Builders (Addressed, Broadcast Frames Included)
+		*   Returns - 0 or the builder's errCode
+		*/
+		static int SendBuilderFrame( OrientalCRK525MAKD& controller, int id )
+		{
+			switch( id )
+			{
+				case OrientalCRK525MAKD::FrameMonitorBlockRead:
+					return controller.ReadRegisters( &controller.CommandPosReg, OrientalCRK525MAKD::monitorBlockNumRegs_ );
+				case OrientalCRK525MAKD::FrameDriverStatusRead:
+					return controller.ReadRegisters( &controller.DriverStatusReg, controller.DriverStatusReg.getRegisterByteSize()/OrientalCRK525MAKD::baseRegisterByteSize_ );
+				case OrientalCRK525MAKD::FrameDiagnose:
+					return controller.testConnection( static_cast< uint16_t >( 0x1234 ) );
+				case OrientalCRK525MAKD::FrameCmd1Off:
+					return controller.serialWriteSingleRegister( controller.cmd1Reg, static_cast< uint16_t >( 0 ) );
+				case OrientalCRK525MAKD::FrameCmd1COn:
+					return controller.serialWriteSingleRegister( controller.cmd1Reg, static_cast< uint16_t >( cmd1BitsEnum16Bit::COn ) );
+				case OrientalCRK525MAKD::FrameCmd1M0:
+					return controller.serialWriteSingleRegister( controller.cmd1Reg, static_cast< uint16_t >( cmd1BitsEnum16Bit::M0 ) );
+				case OrientalCRK525MAKD::FrameCmd1M0COn:
+					return controller.serialWriteSingleRegister( controller.cmd1Reg, static_cast< uint16_t >( cmd1BitsEnum16Bit::M0 | cmd1BitsEnum16Bit::COn ) );
+				case OrientalCRK525MAKD::FrameCmd1StartM0COn:
+				case OrientalCRK525MAKD::FrameBroadcastStart:
+					return controller.serialWriteSingleRegister( controller.cmd1Reg, static_cast< uint16_t >( cmd1BitsEnum16Bit::Start | cmd1BitsEnum16Bit::M0 | cmd1BitsEnum16Bit::COn ) );
+				case OrientalCRK525MAKD::FrameCmd1FwdCOn:
+					return controller.serialWriteSingleRegister( controller.cmd1Reg, static_cast< uint16_t >( cmd1BitsEnum16Bit::Fwd | cmd1BitsEnum16Bit::COn ) );
+				case OrientalCRK525MAKD::FrameCmd1RvsCOn:
+					return controller.serialWriteSingleRegister( controller.cmd1Reg, static_cast< uint16_t >( cmd1BitsEnum16Bit::Rvs | cmd1BitsEnum16Bit::COn ) );
+				case OrientalCRK525MAKD::FrameCmd1StopCOn:
+					return controller.serialWriteSingleRegister( controller.cmd1Reg, static_cast< uint16_t >( cmd1BitsEnum16Bit::Stop | cmd1BitsEnum16Bit::COn ) );
+				case OrientalCRK525MAKD::FrameBroadcastStartInputRS485:
+					return controller.serialWriteSingleRegister( controller.startInputModeReg, static_cast< uint16_t >( inputTypeEnum16Bit::RS485 ) );
+				case OrientalCRK525MAKD::FrameBroadcastIOStopDisable:
+					return controller.serialWriteSingleRegister( controller.IOStopInputReg, static_cast< uint16_t >( genericEnableEnum16Bit::Disable ) );
+				case OrientalCRK525MAKD::FrameBroadcastRotationCCW:
+					return controller.serialWriteSingleRegister( controller.motorRotationDirReg, static_cast< uint16_t >( spinDirectionsEnum16Bit::CounterClockWise ) );
+			}
+			return -1;
+		}
+
+		/* Readdress an Addressed Request to Slave 0 and Recompute its CRC
+		*   Returns - 0 or -1 if the CRC could not be appended
+		*/
+		static int ToBroadcast( OrientalCRK525MAKD& controller, unsigned char frame[], int bufferSize, int len )
+		{
+			memset( frame, 0, sizeof( OrientalCRK525MAKD::ControllerAddressType ) );
+			return ( controller.appendCRCCheckValue( frame, bufferSize, len - g_CRCBytes ) == g_CRCBytes ) ? 0 : -1;
+		}
+};
+
+//Capture What the Builders Send For Every Fixed Frame of Slave address
+static void CaptureBuilderFrames( const std::string& capturePath, uint8_t address )
+{
+	//Moves Finish at Once and the Line Costs Nothing
+	SimulatedCRKTransport simulated;
+	simulated.SetUsbLatencyMs( 0 );
+	simulated.SetBaudRate( 1000000000 );
+	simulated.SetMotorSpeed( 1e9 );
+
+	CapturingSerialTransport capture( &simulated );
+	LastFrameTransport lastFrame( &simulated );
+	SerialControllerBus bus( &capture );
+	OrientalCRK525MAKD controller( &bus, &ControllerBus::SerialCommunicate );
+	CORE_CHECK_EQUAL( 0, controller.setAddress( address ) );
+
+	CORE_CHECK_EQUAL( 0, capture.Open( capturePath ) );
+
+	for( int id = 0; id < ControllerCoreTest::numFixedFrames_; id++ )
+	{
+		if( ControllerCoreTest::IsBroadcast( id ) == false )
+		{
+			CORE_CHECK_EQUAL( 0, ControllerCoreTest::SendBuilderFrame( controller, id ) );
+		}
+	}
+
+	//Addressed Requests Stay Out of the Capture, Only Their Broadcast Form is Written to it
+	bus.SetTransport( &lastFrame );
+	for( int id = 0; id < ControllerCoreTest::numFixedFrames_; id++ )
+	{
+		if( ControllerCoreTest::IsBroadcast( id ) )
+		{
+			CORE_CHECK_EQUAL( 0, ControllerCoreTest::SendBuilderFrame( controller, id ) );
+
+			unsigned char frame[ 64 ];
+			int len = static_cast< int >( lastFrame.GetLen() );
+			memcpy( frame, lastFrame.GetBytes(), len );
+			CORE_CHECK_EQUAL( 0, ControllerCoreTest::ToBroadcast( controller, frame, sizeof( frame ), len ) );
+
+			unsigned long bytesWritten;
+			CORE_CHECK_EQUAL( 0, capture.Write( frame, len, bytesWritten ) );
+		}
+	}
+
+	capture.Close();
+}
+
+//Replay Every Fixed Frame of Slave address Against the Capture
+static void ReplayFixedFrames( const std::string& capturePath, uint8_t address )
+{
+	ReplaySerialTransport replay;
+	CORE_CHECK_EQUAL( 0, replay.Load( capturePath ) );
+	replay.SetOriginalTiming( false );
+
+	SerialControllerBus bus( &replay );
+	OrientalCRK525MAKD controller( &bus, &ControllerBus::SerialCommunicate );
+	CORE_CHECK_EQUAL( 0, controller.setAddress( address ) );
+
+	for( int id = 0; id < ControllerCoreTest::numFixedFrames_; id++ )
+	{
+		CORE_CHECK_EQUAL( 0, ControllerCoreTest::SendFixedFrame( controller, id ) );
+	}
+
+	CORE_CHECK_EQUAL( 0, replay.GetMismatchCount() );
+	CORE_CHECK( replay.AtEnd() );
+}
+
+int main( int argc, char* argv[] )
+{
+	std::string capturePath = ( argc > 1 ) ? argv[1] : "FixedFrameReplayTest.cap";
+
+	//Lowest and Highest Slave Address, Frames Are Rebuilt by setAddress()
+	uint8_t addresses[] = { 1, 31 };
+	for( size_t i = 0; i < sizeof( addresses )/sizeof( addresses[0] ); i++ )
+	{
+		CaptureBuilderFrames( capturePath, addresses[i] );
+		ReplayFixedFrames( capturePath, addresses[i] );
+	}
+
+	remove( capturePath.c_str() );
+
+	return CoreTestResult( "FixedFrameReplayTest" );
+}
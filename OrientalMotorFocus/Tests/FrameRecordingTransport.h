@@ -0,0 +1,49 @@
+#ifndef _FRAME_RECORDING_TRANSPORT_
+#define _FRAME_RECORDING_TRANSPORT_
+
+#include "SerialTransport.h"
+#include <vector>
+
+/*  Test Decorator That Keeps Every Request Written Through Another Transport
+*     Frames Are Kept Whole (CRC Included), One Per Write() Call
+*/
+class FrameRecordingTransport : public SerialTransport
+{
+	public:
+		explicit FrameRecordingTransport( SerialTransport* wrapped ) : wrapped_(wrapped) {}
+
+		int Configure( unsigned long baudRate ) { return wrapped_->Configure( baudRate ); }
+
+		int Write( const unsigned char buffer[], unsigned long len, unsigned long& bytesWritten )
+		{
+			frames_.push_back( std::vector< unsigned char >( buffer, buffer + len ) );
+			return wrapped_->Write( buffer, len, bytesWritten );
+		}
+
+		int Read( unsigned char buffer[], unsigned long len, unsigned long& bytesRead ) { return wrapped_->Read( buffer, len, bytesRead ); }
+		int Purge( void ) { return wrapped_->Purge(); }
+
+		//Requests Written So Far
+		const std::vector< std::vector< unsigned char > >& GetFrames( void ) const { return frames_; }
+		void ClearFrames( void ) { frames_.clear(); }
+
+	private:
+		SerialTransport* wrapped_;
+		std::vector< std::vector< unsigned char > > frames_;
+};
+
+/* Register Address of a Request Frame (Bytes 2-3)
+*/
+inline uint16_t FrameStartAddress( const std::vector< unsigned char >& frame )
+{
+	return static_cast< uint16_t >( ( frame[2] << 8 ) | frame[3] );
+}
+
+/* Register Count of a Multi-Write or Read Frame (Bytes 4-5)
+*/
+inline uint16_t FrameRegisterCount( const std::vector< unsigned char >& frame )
+{
+	return static_cast< uint16_t >( ( frame[4] << 8 ) | frame[5] );
+}
+
+#endif
@@ -0,0 +1,77 @@
+/*
+*  Only Requests That Are Safe to Send Twice May be Retried by SerialControllerBus
+*     Reads and Diagnosis Always Are; Writes Are Unless They Reach posReg or cmd1Reg While Positioning is Incremental
+*     (a Repeated Relative Move Would Move Twice)
+*/
+#include "CoreTestSupport.h"
+#include "OrientalCRK525PMAKD.h"
+#include "SerialControllerBus.h"
+#include "SerialTransport.h"
+
+//Register Addresses the Requests Below Reach (See OrientalCRK525MAKD)
+static const uint16_t g_PosModeRegister = 0x0015;
+static const uint16_t g_PosRegister = 0x001C;
+static const uint16_t g_Cmd1Register = 0x001E;
+static const uint16_t g_CommandPosRegister = 0x0118;
+
+/* Request Header of functionCode at startAddress (the CRC is Never Looked at)
+*   @param word - register count (0x03, 0x10), value (0x06) or test value (0x08)
+*/
+static bool IsIdempotent( OrientalCRK525MAKD& controller, uint8_t address, uint8_t functionCode, uint16_t startAddress, uint16_t word )
+{
+	unsigned char request[] = { address, functionCode, static_cast< unsigned char >( startAddress >> 8 ), static_cast< unsigned char >( startAddress & 0xFF ),
+		static_cast< unsigned char >( word >> 8 ), static_cast< unsigned char >( word & 0xFF ), 0, 0 };
+	return controller.isIdempotentRequest( request, sizeof( request ) );
+}
+
+//Requests Whose Retry Does Not Depend on the Positioning Mode
+static void CheckModeIndependent( OrientalCRK525MAKD& controller )
+{
+	CORE_CHECK( IsIdempotent( controller, 1, functionCodes::registerRead, g_CommandPosRegister, 16 ) );
+	CORE_CHECK( IsIdempotent( controller, 1, functionCodes::registerRead, g_PosRegister, 2 ) );
+	CORE_CHECK( IsIdempotent( controller, 1, functionCodes::diagnose, 0x0000, 0x1234 ) );
+	CORE_CHECK( IsIdempotent( controller, 1, functionCodes::registerWrite, g_PosModeRegister, 1 ) );
+
+	//Multi-Writes Ending Just Before posReg or Starting Just After cmd1Reg
+	CORE_CHECK( IsIdempotent( controller, 1, functionCodes::multipleRegisterWrite, g_PosRegister - 2, 2 ) );
+	CORE_CHECK( IsIdempotent( controller, 1, functionCodes::multipleRegisterWrite, g_Cmd1Register + 1, 2 ) );
+
+	//Unknown Function Codes and Requests Too Short to Hold a Header Are Never Retried
+	CORE_CHECK( IsIdempotent( controller, 1, 0x05, g_PosModeRegister, 0xFF00 ) == false );
+	unsigned char shortRequest[] = { 1, functionCodes::registerRead, 0x01, 0x18, 0x00 };
+	CORE_CHECK( controller.isIdempotentRequest( shortRequest, sizeof( shortRequest ) ) == false );
+}
+
+//Writes Reaching posReg or cmd1Reg, idempotent in Absolute Positioning Only
+static void CheckMotionWrites( OrientalCRK525MAKD& controller, bool idempotent )
+{
+	CORE_CHECK_EQUAL( idempotent, IsIdempotent( controller, 1, functionCodes::registerWrite, g_Cmd1Register, cmd1BitsEnum16Bit::Start ) );
+	CORE_CHECK_EQUAL( idempotent, IsIdempotent( controller, 0, functionCodes::registerWrite, g_Cmd1Register, cmd1BitsEnum16Bit::Start ) );
+	CORE_CHECK_EQUAL( idempotent, IsIdempotent( controller, 1, functionCodes::multipleRegisterWrite, g_PosRegister, 2 ) );
+	CORE_CHECK_EQUAL( idempotent, IsIdempotent( controller, 1, functionCodes::multipleRegisterWrite, g_PosRegister + 1, 1 ) );
+	CORE_CHECK_EQUAL( idempotent, IsIdempotent( controller, 1, functionCodes::multipleRegisterWrite, g_PosRegister - 2, 3 ) );
+}
+
+int main( void )
+{
+	SimulatedCRKTransport simulated;
+	simulated.SetUsbLatencyMs( 0 );
+	simulated.SetBaudRate( 1000000000 );
+
+	SerialControllerBus bus( &simulated );
+	OrientalCRK525MAKD controller( &bus, &ControllerBus::SerialCommunicate );
+	controller.setAddress( 1 );
+
+	CORE_CHECK( controller.IsAbsolutePositioning() == false );
+	CheckModeIndependent( controller );
+	CheckMotionWrites( controller, false );
+
+	CORE_CHECK_EQUAL( 0, controller.SetAbsolutePositioning( true ) );
+	CheckModeIndependent( controller );
+	CheckMotionWrites( controller, true );
+
+	CORE_CHECK_EQUAL( 0, controller.SetAbsolutePositioning( false ) );
+	CheckMotionWrites( controller, false );
+
+	return CoreTestResult( "IdempotentRequestTest" );
+}
@@ -0,0 +1,157 @@
+/*
+*  The Motion Planner Picks Triangular Moves Below the Speed Limit and Trapezoidal Ones at it, Stops Small Moves Gently,
+*  and a Planned Move Goes Out as One Multi-Write From decelRateReg:  Decel, Accel, Speed, Position (Rates Clamped to the Register)
+*/
+#include "CoreTestSupport.h"
+#include "FrameRecordingTransport.h"
+#include "MotionPlanner.h"
+#include "OrientalCRK525PMAKD.h"
+#include "ControllerStatusMonitorThread.h"
+#include "SerialControllerBus.h"
+#include <math.h>
+#include <vector>
+
+//0.72 Degree Step (500 Steps/rev) at the Default Limits:  5000 Hz, 25000 Hz/s, Starting at 100 Hz
+static const double g_StepAngleDeg = 0.72;
+static const double g_TravelUmPerRev = 25;
+static const double g_MaxSpeedHz = 5000;
+static const double g_AccelHzPerS = 25000;
+
+static const uint16_t g_DecelRateRegister = 0x0016;
+static const uint8_t g_MultiWriteFunction = 0x10;
+
+static bool Near( double expected, double actual )
+{
+	return fabs( expected - actual ) <= 1e-6 * ( fabs( expected ) + 1 );
+}
+
+//Big Endian 32 Bit Value at Register Index reg of a Multi-Write's Values (After the 7 Byte Header)
+static uint32_t FrameValue( const std::vector< unsigned char >& frame, unsigned int reg )
+{
+	size_t idx = 7 + reg * 2;
+	return ( static_cast< uint32_t >( frame[idx] ) << 24 ) | ( frame[idx + 1] << 16 ) | ( frame[idx + 2] << 8 ) | frame[idx + 3];
+}
+
+/* Plan, Write a Move With it and Return the Planned Move Frame (Empty if None Went Out)
+*/
+static std::vector< unsigned char > WritePlanned( OrientalCRK525MAKD& controller, FrameRecordingTransport& recording, const MotionPlan& plan, int steps )
+{
+	controller.SetNextMovePlan( &plan );
+	recording.ClearFrames();
+	CORE_CHECK_EQUAL( 0, controller.WritePos( steps ) );
+
+	for( size_t i = 0; i < recording.GetFrames().size(); i++ )
+	{
+		const std::vector< unsigned char >& frame = recording.GetFrames()[i];
+		if( frame[1] == g_MultiWriteFunction && FrameStartAddress( frame ) == g_DecelRateRegister )
+		{
+			return frame;
+		}
+	}
+
+	return std::vector< unsigned char >();
+}
+
+int main( void )
+{
+	MotionPlanner planner;
+	MotionPlan plan;
+
+	//Nothing to Plan
+	CORE_CHECK( planner.Plan( 0, g_StepAngleDeg, g_TravelUmPerRev, plan ) != 0 );
+	CORE_CHECK( planner.Plan( 100, 0, g_TravelUmPerRev, plan ) != 0 );
+	CORE_CHECK( planner.Plan( 100, g_StepAngleDeg, 0, plan ) != 0 );
+
+	//Large Move:  Trapezoidal, Cruising at the Limit and Stopping Hard (Travel Time Outweighs the Ringing)
+	CORE_CHECK_EQUAL( 0, planner.Plan( 1000, g_StepAngleDeg, g_TravelUmPerRev, plan ) );
+	CORE_CHECK( Near( g_MaxSpeedHz, plan.speedHz ) );
+	CORE_CHECK( Near( g_AccelHzPerS, plan.accelHzPerS ) );
+	CORE_CHECK( Near( g_AccelHzPerS, plan.decelHzPerS ) );
+	CORE_CHECK( plan.settleMs > 0 );
+
+	//Direction Does Not Matter
+	MotionPlan reverse;
+	CORE_CHECK_EQUAL( 0, planner.Plan( -1000, g_StepAngleDeg, g_TravelUmPerRev, reverse ) );
+	CORE_CHECK( Near( plan.moveMs, reverse.moveMs ) );
+
+	//Small Move:  Triangular, Peaking Where the Ramps Meet, and Stopping Gentler Than it Accelerates
+	CORE_CHECK_EQUAL( 0, planner.Plan( 10, g_StepAngleDeg, g_TravelUmPerRev, plan ) );
+	CORE_CHECK( plan.speedHz < g_MaxSpeedHz );
+	CORE_CHECK( plan.decelHzPerS < plan.accelHzPerS );
+	double peakHz;
+	double moveS = MotionPlanner::MoveTimeS( 10, planner.GetConfig().startSpeedHz, g_MaxSpeedHz, plan.accelHzPerS, plan.decelHzPerS, peakHz );
+	CORE_CHECK( Near( peakHz, plan.speedHz ) );
+	CORE_CHECK( Near( 1000 * moveS, plan.moveMs ) );
+	double startHz = planner.GetConfig().startSpeedHz;
+	CORE_CHECK( Near( 10, ( peakHz * peakHz - startHz * startHz ) * ( 1 / ( 2 * plan.accelHzPerS ) + 1 / ( 2 * plan.decelHzPerS ) ) ) );
+
+	//The Gentle Stop Beats Stopping Hard Once Settling is Counted
+	double hardMs = 1000 * MotionPlanner::MoveTimeS( 10, startHz, g_MaxSpeedHz, g_AccelHzPerS, g_AccelHzPerS, peakHz )
+		+ planner.SettleMs( g_AccelHzPerS * g_StepAngleDeg / 360, g_TravelUmPerRev );
+	CORE_CHECK( plan.moveMs + plan.settleMs < hardMs );
+
+	//Trapezoidal Time is the Ramps Plus the Cruise
+	moveS = MotionPlanner::MoveTimeS( 1000, 100, 5000, 25000, 25000, peakHz );
+	CORE_CHECK( Near( 5000, peakHz ) );
+	CORE_CHECK( Near( 2 * 4900.0 / 25000 + ( 1000 - ( 5000.0 * 5000 - 100 * 100 ) / 25000 ) / 5000, moveS ) );
+
+	SimulatedCRKTransport simulated;
+	simulated.SetUsbLatencyMs( 0 );
+	simulated.SetBaudRate( 1000000000 );
+	FrameRecordingTransport recording( &simulated );
+	SerialControllerBus bus( &recording );
+	OrientalCRK525MAKD controller( &bus, &ControllerBus::SerialCommunicate );
+	controller.setAddress( 1 );
+	CORE_CHECK_EQUAL( 0, controller.EnableMotionPlans( true ) );
+
+	//Frame Order:  decelRateReg, accelRateReg, operatingSpeedReg, posReg; Rates in 0.001 ms/kHz
+	plan.speedHz = 4000;
+	plan.accelHzPerS = 20000;
+	plan.decelHzPerS = 50000;
+	std::vector< unsigned char > frame = WritePlanned( controller, recording, plan, 1234 );
+	CORE_CHECK( !frame.empty() );
+	if( !frame.empty() )
+	{
+		CORE_CHECK_EQUAL( 8, FrameRegisterCount( frame ) );
+		CORE_CHECK_EQUAL( 20000, FrameValue( frame, 0 ) );
+		CORE_CHECK_EQUAL( 50000, FrameValue( frame, 2 ) );
+		CORE_CHECK_EQUAL( 4000, FrameValue( frame, 4 ) );
+		CORE_CHECK_EQUAL( 1234, FrameValue( frame, 6 ) );
+	}
+
+	//Clamps:  Rates at or Below 1 kHz/s Take the Register's Slowest (1000000), Huge Rates its Fastest (1); Speed to 1 - 500000 Hz
+	plan.speedHz = 1e7;
+	plan.accelHzPerS = 2e10;
+	plan.decelHzPerS = 500;
+	frame = WritePlanned( controller, recording, plan, -20 );
+	CORE_CHECK( !frame.empty() );
+	if( !frame.empty() )
+	{
+		CORE_CHECK_EQUAL( 1000000, FrameValue( frame, 0 ) );
+		CORE_CHECK_EQUAL( 1, FrameValue( frame, 2 ) );
+		CORE_CHECK_EQUAL( 500000, FrameValue( frame, 4 ) );
+		CORE_CHECK_EQUAL( static_cast< uint32_t >( -20 ), FrameValue( frame, 6 ) );
+	}
+
+	plan.speedHz = 0;
+	plan.accelHzPerS = 1000;
+	plan.decelHzPerS = 1001;
+	frame = WritePlanned( controller, recording, plan, 5 );
+	CORE_CHECK( !frame.empty() );
+	if( !frame.empty() )
+	{
+		CORE_CHECK_EQUAL( 999001, FrameValue( frame, 0 ) );
+		CORE_CHECK_EQUAL( 1000000, FrameValue( frame, 2 ) );
+		CORE_CHECK_EQUAL( 1, FrameValue( frame, 4 ) );
+	}
+
+	//Without a Staged Plan Only the Position is Written
+	recording.ClearFrames();
+	CORE_CHECK_EQUAL( 0, controller.WritePos( 5 ) );
+	for( size_t i = 0; i < recording.GetFrames().size(); i++ )
+	{
+		CORE_CHECK( FrameStartAddress( recording.GetFrames()[i] ) != g_DecelRateRegister );
+	}
+
+	return CoreTestResult( "MotionPlannerTest" );
+}
@@ -0,0 +1,106 @@
+/*
+*  Position Readback Comes From the Cached Monitor Block Whenever it is Still Valid
+*     A Block Read at Rest Stays Fresh Until InvalidatePosReadback(); One Read While Moving (or Within moveOutputLagMS_ of
+*     MarkPosReadbackMoving()) Ages Out After GetReadbackMaxAgeMS().  Bus Transactions Show Which Reads Reached the Slave
+*/
+#include "CoreTestSupport.h"
+#include "OrientalCRK525PMAKD.h"
+#include "ControllerStatusMonitorThread.h"
+#include "SerialControllerBus.h"
+#include "SerialTransport.h"
+#include "AlternativeUtils.h"
+#include "ReadWritePolicies.h"
+
+//Longer Than OrientalCRK525MAKD::moveOutputLagMS_
+static const long g_PastMoveOutputLagMS = 100;
+
+//Transactions on bus So Far
+static unsigned long Transactions( SerialControllerBus& bus )
+{
+	return bus.GetBusStatistics().GetTotal().GetTransactions();
+}
+
+/* Read the Position Through the Cache
+*   @param busReads - set to the transactions the read took
+*   Returns - the position, or 0 if the read failed (a failed check)
+*/
+static int32_t ReadPos( OrientalCRK525MAKD& controller, SerialControllerBus& bus, unsigned long& busReads )
+{
+	unsigned long startTransactions = Transactions( bus );
+
+	unsigned char buffer[ sizeof( int32_t ) ];
+	int32_t pos = 0;
+	CORE_CHECK_EQUAL( sizeof( buffer ), controller.ReadPosBuffer( buffer, sizeof( buffer ) ) );
+	ReadWrite< int32_t, true >::write( buffer, sizeof( buffer ), pos );
+
+	busReads = Transactions( bus ) - startTransactions;
+	return pos;
+}
+
+int main( void )
+{
+	//Moves Finish at Once and the Line Costs Nothing
+	SimulatedCRKTransport simulated;
+	simulated.SetUsbLatencyMs( 0 );
+	simulated.SetBaudRate( 1000000000 );
+	simulated.SetMotorSpeed( 1e9 );
+
+	SerialControllerBus bus( &simulated );
+	OrientalCRK525MAKD controller( &bus, &ControllerBus::SerialCommunicate );
+	controller.setAddress( 1 );
+	//Blocks Read While Moving Are Only Good For the Read That Took Them
+	controller.SetReadbackMaxAgeMS( 0 );
+
+	unsigned long busReads;
+
+	//A Resting Block Answers Every Read Until it is Invalidated
+	int32_t restingPos = ReadPos( controller, bus, busReads );
+	CORE_CHECK_EQUAL( 1, busReads );
+	CORE_CHECK_EQUAL( restingPos, ReadPos( controller, bus, busReads ) );
+	CORE_CHECK_EQUAL( 0, busReads );
+
+	controller.InvalidatePosReadback();
+	ReadPos( controller, bus, busReads );
+	CORE_CHECK_EQUAL( 1, busReads );
+	ReadPos( controller, bus, busReads );
+	CORE_CHECK_EQUAL( 0, busReads );
+
+	//Within moveOutputLagMS_ of a Start Blocks Count as Moving (MOVE May Not be On Yet) and Age Out
+	controller.MarkPosReadbackMoving();
+	ReadPos( controller, bus, busReads );
+	CORE_CHECK_EQUAL( 1, busReads );
+	ReadPos( controller, bus, busReads );
+	CORE_CHECK_EQUAL( 1, busReads );
+
+	//Past the Lag, With MOVE Off, the Next Block Rests Again
+	CAlternativeUtils::SleepMs( g_PastMoveOutputLagMS );
+	ReadPos( controller, bus, busReads );
+	CORE_CHECK_EQUAL( 1, busReads );
+	ReadPos( controller, bus, busReads );
+	CORE_CHECK_EQUAL( 0, busReads );
+
+	//A Moving Block Stays Fresh For GetReadbackMaxAgeMS()
+	controller.SetReadbackMaxAgeMS( 10000 );
+	controller.MarkPosReadbackMoving();
+	ReadPos( controller, bus, busReads );
+	CORE_CHECK_EQUAL( 1, busReads );
+	ReadPos( controller, bus, busReads );
+	CORE_CHECK_EQUAL( 0, busReads );
+	controller.SetReadbackMaxAgeMS( 0 );
+	CAlternativeUtils::SleepMs( g_PastMoveOutputLagMS );
+
+	//A Position Write Never Leaves the Pre-Move Block Cached
+	int32_t startPos = ReadPos( controller, bus, busReads );
+	CORE_CHECK_EQUAL( 0, controller.WritePos( 500 ) );
+	int32_t movedPos = ReadPos( controller, bus, busReads );
+	CORE_CHECK_EQUAL( 1, busReads );
+	CORE_CHECK_EQUAL( 500, movedPos - startPos );
+
+	CAlternativeUtils::SleepMs( g_PastMoveOutputLagMS );
+	CORE_CHECK_EQUAL( movedPos, ReadPos( controller, bus, busReads ) );
+	CORE_CHECK_EQUAL( 1, busReads );
+	CORE_CHECK_EQUAL( movedPos, ReadPos( controller, bus, busReads ) );
+	CORE_CHECK_EQUAL( 0, busReads );
+
+	return CoreTestResult( "ReadbackCacheTest" );
+}
@@ -0,0 +1,99 @@
+/*
+*  A Recording Reads Back in Order and Seeks by Time Through its Index
+*     Records Enough to Span Many Index Strides and Several File Growths (the Writer Thread Doubles the Mapping),
+*     Then Checks FindFirstRecordAtOrAfter() Against a Linear Scan
+*/
+#include "CoreTestSupport.h"
+#include "TelemetryRecorder.h"
+#include "AlternativeUtils.h"
+#include <string>
+
+//Small Stride so the Index Has Many Entries
+static const uint32_t g_IndexStride = 100;
+//Past the First Two Growths of the File
+static const uint32_t g_NumRecords = 4 * TelemetryRecorder::initialRecordCapacity_ + 123;
+//Less Than the Queue Holds, so No Record is Dropped
+static const uint32_t g_BatchRecords = TelemetryRecorder::queueCapacity_ / 2;
+
+//Reference Seek:  First Record at or After timeMs by Linear Scan
+static uint64_t LinearFind( const TelemetryRecordReader& reader, double timeMs )
+{
+	for( uint64_t i = 0; i < reader.GetRecordCount(); i++ )
+	{
+		if( reader.GetRecord( i )->timeMs >= timeMs )
+		{
+			return i;
+		}
+	}
+
+	return reader.GetRecordCount();
+}
+
+int main( int argc, char* argv[] )
+{
+	std::string path = ( argc > 1 ) ? argv[1] : "TelemetryRecorderTest.rec";
+
+	TelemetryRecorder recorder;
+	CORE_CHECK_EQUAL( 0, recorder.Open( path, g_IndexStride ) );
+
+	unsigned char registerBytes[ 4 ];
+	for( uint32_t i = 0; i < g_NumRecords; i++ )
+	{
+		registerBytes[0] = static_cast< unsigned char >( i >> 24 );
+		registerBytes[1] = static_cast< unsigned char >( i >> 16 );
+		registerBytes[2] = static_cast< unsigned char >( i >> 8 );
+		registerBytes[3] = static_cast< unsigned char >( i );
+		CORE_CHECK_EQUAL( 0, recorder.Record( TelemetryRegisterBlock, 1, 0x0118, registerBytes, sizeof( registerBytes ), i ) );
+
+		//Let the Writer Thread Catch Up Between Batches
+		if( ( i + 1 ) % g_BatchRecords == 0 )
+		{
+			while( recorder.GetRecordCount() < i + 1 )
+			{
+				CAlternativeUtils::SleepMs( 1 );
+			}
+		}
+	}
+
+	recorder.Close();
+	CORE_CHECK_EQUAL( g_NumRecords, recorder.GetRecordCount() );
+	CORE_CHECK_EQUAL( 0, recorder.GetDroppedCount() );
+
+	TelemetryRecordReader reader;
+	CORE_CHECK_EQUAL( 0, reader.Open( path ) );
+	CORE_CHECK_EQUAL( g_NumRecords, reader.GetRecordCount() );
+	CORE_CHECK_EQUAL( g_IndexStride, reader.GetHeader()->indexStride );
+
+	//Every Record Survived Growth in Order
+	for( uint32_t i = 0; i < reader.GetRecordCount(); i++ )
+	{
+		const TelemetryRecord* record = reader.GetRecord( i );
+		CORE_CHECK_EQUAL( i, record->moveId );
+		CORE_CHECK_EQUAL( 2, record->numRegisters );
+		CORE_CHECK_EQUAL( i & 0xFF, record->registerBytes[3] );
+		if( i > 0 )
+		{
+			CORE_CHECK( record->timeMs >= reader.GetRecord( i - 1 )->timeMs );
+		}
+	}
+	CORE_CHECK( reader.GetRecord( g_NumRecords ) == nullptr );
+
+	//Seeks on Stride Boundaries, Between Them, Around Each Growth and at Both Ends
+	const uint64_t seekRecords[] = { 0, 1, g_IndexStride - 1, g_IndexStride, g_IndexStride + 1, 5 * g_IndexStride + 37,
+										TelemetryRecorder::initialRecordCapacity_ - 1, TelemetryRecorder::initialRecordCapacity_,
+										2 * TelemetryRecorder::initialRecordCapacity_, g_NumRecords - 1 };
+	for( size_t i = 0; i < sizeof( seekRecords ) / sizeof( seekRecords[0] ); i++ )
+	{
+		double timeMs = reader.GetRecord( seekRecords[i] )->timeMs;
+		CORE_CHECK_EQUAL( LinearFind( reader, timeMs ), reader.FindFirstRecordAtOrAfter( timeMs ) );
+		//Just Past a Record's Time Lands on the Next Distinct Time
+		CORE_CHECK_EQUAL( LinearFind( reader, timeMs + 1e-6 ), reader.FindFirstRecordAtOrAfter( timeMs + 1e-6 ) );
+	}
+
+	CORE_CHECK_EQUAL( 0, reader.FindFirstRecordAtOrAfter( reader.GetRecord( 0 )->timeMs - 1.0 ) );
+	CORE_CHECK_EQUAL( g_NumRecords, reader.FindFirstRecordAtOrAfter( reader.GetRecord( g_NumRecords - 1 )->timeMs + 1.0 ) );
+
+	reader.Close();
+
+	return CoreTestResult( "TelemetryRecorderTest" );
+}
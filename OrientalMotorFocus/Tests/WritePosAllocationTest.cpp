@@ -0,0 +1,81 @@
+/*
+*  The Position Write Path Must Not Touch the Heap Once Warmed Up
+*     Repeats the Controller Side of OrientalMotorFocus::OnPosition() (Range Check, Optional Motion Plan, WritePos())
+*     Through a SerialControllerBus Over the Simulated Slaves, Counting Allocations With AllocationCounter
+*     Note:  OnPosition() Itself Needs MMDevice; Everything Below its Property Handling is Covered Here
+*/
+#include "CoreTestSupport.h"
+#include "OrientalCRK525PMAKD.h"
+#include "ControllerStatusMonitorThread.h"
+#include "SerialControllerBus.h"
+#include "SerialTransport.h"
+#include "MotionPlanner.h"
+#include "AllocationCounter.h"
+
+static const unsigned long g_RoundTrips = 1000;
+static const double g_TravelUmPerRev = 100;
+
+//One OnPosition() Write of steps (Negated as the Focus Does), 0 or the errCode
+static int PositionRoundTrip( OrientalCRK525MAKD& controller, const MotionPlanner& planner, int steps, bool planned )
+{
+	if( controller.IsPosInRange( steps ) == false )
+	{
+		return DEVICE_UNKNOWN_POSITION;
+	}
+
+	MotionPlan plan;
+	if( planned && planner.Plan( steps, controller.GetCurrentBaseAnglePartition(), g_TravelUmPerRev, plan ) == 0 )
+	{
+		controller.SetNextMovePlan( &plan );
+	}
+
+	int errCode = controller.WritePos( steps * -1 );
+	controller.SetNextMovePlan( nullptr );
+
+	return errCode;
+}
+
+//Allocations Over g_RoundTrips Writes, After One Untimed Write Builds the Simulated Slave
+static unsigned long CountRoundTripAllocations( OrientalCRK525MAKD& controller, const MotionPlanner& planner, bool planned )
+{
+	int errors = 0;
+
+	CORE_CHECK_EQUAL( 0, PositionRoundTrip( controller, planner, 100, planned ) );
+
+	unsigned long startAllocs = AllocationCounter::GetCount();
+	for( unsigned long i = 0; i < g_RoundTrips; i++ )
+	{
+		if( PositionRoundTrip( controller, planner, ( i % 2 == 0 ) ? -100 : 100, planned ) != 0 )
+		{
+			errors++;
+		}
+	}
+	unsigned long allocs = AllocationCounter::GetCount() - startAllocs;
+
+	CORE_CHECK_EQUAL( 0, errors );
+	return allocs;
+}
+
+int main( void )
+{
+	CORE_CHECK( AllocationCounter::IsCounting() );
+
+	//Moves Finish at Once and the Line Costs Nothing, so Every Write is Accepted
+	SimulatedCRKTransport simulated;
+	simulated.SetUsbLatencyMs( 0 );
+	simulated.SetBaudRate( 1000000000 );
+	simulated.SetMotorSpeed( 1e9 );
+
+	SerialControllerBus bus( &simulated );
+	OrientalCRK525MAKD controller( &bus, &ControllerBus::SerialCommunicate );
+	controller.setAddress( 1 );
+	MotionPlanner planner;
+
+	CORE_CHECK_EQUAL( 0, CountRoundTripAllocations( controller, planner, false ) );
+	CORE_CHECK_EQUAL( 0, CountRoundTripAllocations( controller, planner, true ) );
+
+	//Every Write Went Over the Bus
+	CORE_CHECK( bus.GetBusStatistics().GetTotal().GetTransactions() >= 3 * 2 * g_RoundTrips );
+
+	return CoreTestResult( "WritePosAllocationTest" );
+}
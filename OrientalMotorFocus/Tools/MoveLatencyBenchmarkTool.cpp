@@ -0,0 +1,93 @@
+/*
+*  Command Line Move Latency Benchmark (No Micro-Manager, No Hardware)
+*     Runs MoveLatencyBenchmark on One Controller Over SimulatedCRKTransport at the Hub's Default Simulation Settings
+*     Usage:  MoveLatencyBenchmark [repeats] [report file]
+*        repeats - moves per step size (MoveLatencyBenchmark::defaultRepeats_ if omitted)
+*        report file - also write the results as JSON (the focus device's Move Latency Report File format)
+*     Note:  Moves Are Written Straight to the Controller (Incremental, No Motion Planner), So They Leave Out the Focus Device's
+*            Property Handling; Everything From WritePos() Down (Controller, Bus, Transport) is Measured
+*     Exit Code is 0 Only if Every Move Settled and the Report Was Written
+*/
+#include "MoveLatencyBenchmark.h"
+#include "OrientalCRK525PMAKD.h"
+#include "ControllerStatusMonitorThread.h"
+#include "SerialControllerBus.h"
+#include "SerialTransport.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//ThorLabs DM10 Knob on a 0.72 Degree Step, as the Focus Device is Usually Configured
+static const double g_TravelPerRevUm = 25;
+static const double g_TotalTravelUm = 275;
+static const double g_StepsPerRev = 500;
+
+/*  One Controller as a Stage:  um Are Converted to Steps and Written as Incremental Moves
+*/
+class ControllerStage : public BenchmarkedStage
+{
+	public:
+		explicit ControllerStage( AbstractControllerInterface& controller ) : controller_(controller), targetSteps_(0) {}
+
+		int GetPositionUm( double& posUm ) { posUm = targetSteps_ * g_TravelPerRevUm / g_StepsPerRev; return 0; }
+		int GetLimits( double& lowerUm, double& upperUm ) { lowerUm = 0; upperUm = g_TotalTravelUm; return 0; }
+
+		int SetPositionUm( double posUm )
+		{
+			long steps = static_cast< long >( floor( posUm * g_StepsPerRev / g_TravelPerRevUm + 0.5 ) );
+			int ret = controller_.WritePos( static_cast< int >( steps - targetSteps_ ) );
+			if( ret == 0 )
+			{
+				targetSteps_ = steps;
+			}
+			return ret;
+		}
+
+	private:
+		AbstractControllerInterface& controller_;
+		long targetSteps_;
+
+		ControllerStage& operator=( const ControllerStage& );
+};
+
+int main( int argc, char* argv[] )
+{
+	unsigned long repeats = MoveLatencyBenchmark::defaultRepeats_;
+
+	if( argc > 1 )
+	{
+		repeats = strtoul( argv[1], nullptr, 10 );
+		if( repeats == 0 )
+		{
+			fprintf( stderr, "Usage: %s [repeats] [report file]\n", argv[0] );
+			return 2;
+		}
+	}
+
+	SimulatedCRKTransport simulated;
+	SerialControllerBus bus( &simulated );
+	OrientalCRK525MAKD controller( &bus, &ControllerBus::SerialCommunicate );
+	controller.setAddress( 1 );
+
+	ControllerStage stage( controller );
+	MoveLatencyBenchmark benchmark( stage, &controller );
+	int errCode = benchmark.Run( static_cast< unsigned int >( repeats ) );
+
+	printf( "%s", benchmark.Summary().c_str() );
+
+	if( argc > 2 )
+	{
+		MoveLatencyBusInfo busInfo;
+		busInfo.simulated = true;
+		busInfo.baudRate = simulated.GetBaudRate();
+		busInfo.usbLatencyMs = simulated.GetUsbLatencyMs();
+		busInfo.motorSpeedStepsPerSec = simulated.GetMotorSpeed();
+		if( benchmark.WriteJson( argv[2], busInfo ) != 0 )
+		{
+			fprintf( stderr, "Could Not Write Report File %s\n", argv[2] );
+			return 1;
+		}
+	}
+
+	return ( errCode == 0 ) ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+/*
+*  Command Line Protocol Benchmark (No Micro-Manager, No Hardware)
+*     Runs ProtocolBenchmark With Allocation Counting, Plus Full Transactions Over the Simulated Slaves
+*     Usage:  ProtocolBenchmark [iterations] [capture file]
+*        iterations - operations per measurement (ProtocolBenchmark::defaultIterations_ if omitted)
+*        capture file - also record every byte on the simulated line (replay it through the hub's Bus Replay File)
+*     Exit Code is 0 Only if Every Operation Ran Allocation-Free Where Required
+*/
+#include "ProtocolBenchmark.h"
+#include "SerialTransport.h"
+#include "AllocationCounter.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+int main( int argc, char* argv[] )
+{
+	unsigned long iterations = ProtocolBenchmark::defaultIterations_;
+
+	if( argc > 1 )
+	{
+		iterations = strtoul( argv[1], nullptr, 10 );
+		if( iterations == 0 )
+		{
+			fprintf( stderr, "Usage: %s [iterations] [capture file]\n", argv[0] );
+			return 2;
+		}
+	}
+
+	//The Line Costs Nothing, so Transactions Time the Bus and Protocol Layers Only
+	SimulatedCRKTransport simulated;
+	simulated.SetUsbLatencyMs( 0 );
+	simulated.SetBaudRate( 1000000000 );
+
+	CapturingSerialTransport capture( &simulated );
+	SerialTransport* transport = &simulated;
+	if( argc > 2 )
+	{
+		if( capture.Open( argv[2] ) != 0 )
+		{
+			fprintf( stderr, "Could Not Open Capture File %s\n", argv[2] );
+			return 2;
+		}
+		transport = &capture;
+	}
+
+	ProtocolBenchmark benchmark;
+	benchmark.SetTransport( transport );
+	int errCode = benchmark.Run( iterations );
+
+	printf( "%s", benchmark.Report().c_str() );
+	if( AllocationCounter::IsCounting() == false )
+	{
+		printf( "Allocations Not Counted\n" );
+	}
+
+	benchmark.SetTransport( nullptr );
+	capture.Close();
+
+	return ( errCode == 0 ) ? 0 : 1;
+}
@@ -125,7 +125,7 @@ class LinearEnumWrapper : public CRTPEnumWrapperBase< LinearEnumWrapper<Inheriti
 		  return typeValueToEnumMap;
 	  }
 
-	  for( std::vector<T>::size_type i = 0; i < typedValues.size(); ++i )
+	  for( typename std::vector<T>::size_type i = 0; i < typedValues.size(); ++i )
 	  {
 		  typeValueToEnumMap[ typedValues[i] ] = static_cast< BaseEnumType >(TopEnumSpace::MinBound + i);
 	  }
@@ -7,6 +7,7 @@
 #include "ReadWritePolicies.h"
 #include <boost/static_assert.hpp>
 #include "smartEnum.h"
+#include "ControllerLog.h"
 
 class AbstractControllerInterfaceFactory;
 
@@ -249,19 +250,16 @@ namespace {
 					uniqueDeviceRegistersMap[ deviceAddress ][ registerAddress ] = basePointer;
 				}
 
-				std::ostringstream os;
-				os << "The Register Address Being Registered is " << registerAddress;
-				AbstractControllerInterfaceFactory::LogMessage( os.str() );
-
 				std::map< uint32_t, AbstractRegisterBase* >::iterator it = uniqueDeviceRegistersMap[deviceAddress].find( registerAddress );
 
 				if( it != uniqueDeviceRegistersMap[deviceAddress].end() )
 				{
 					//Error Handling
+					ORIENTAL_LOG_WARN( "Register {x} Already Registered For Device {x}", registerAddress, deviceAddress );
 					return 1;
 				}
 
-				AbstractControllerInterfaceFactory::LogMessage( "Registered" );
+				ORIENTAL_LOG_TRACE( "Registered Register {x} For Device {x}", registerAddress, deviceAddress );
 
 				uniqueDeviceRegistersMap[deviceAddress][ registerAddress ] = basePointer;
 